@@ -0,0 +1,411 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/* C++ Headers */
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <bench.h>
+#include <ff/Profiler.h>
+#include <ff/tester/simulate.h>
+
+/* Logging Configuration */
+#include <ff/logging.h>
+
+namespace ff {
+namespace bench {
+
+::std::vector<Benchmark> & registry() {
+  static ::std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+Registrar::Registrar(
+    ::std::string const & name,
+    Setup const & setup,
+    ::std::vector<Params> const & params) {
+  registry().push_back(Benchmark{name, setup, params});
+}
+
+::std::string const DEALER("dealer");
+
+::std::string const & partyName(size_t const i) {
+  // A deque, so that growing it does not move earlier names.
+  static ::std::deque<::std::string> names;
+  while (names.size() <= i) {
+    names.push_back("party" + ::std::to_string(names.size()));
+  }
+  return names[i];
+}
+
+::std::unique_ptr<Fronctocol> script(::std::vector<Step> && steps) {
+  ::std::shared_ptr<::std::vector<Step>> shared =
+      ::std::make_shared<::std::vector<Step>>(::std::move(steps));
+  ::std::shared_ptr<size_t> current = ::std::make_shared<size_t>(0);
+
+  ::std::function<void(Fronctocol *, Fronctocol *)> invokeStep =
+      [shared, current](Fronctocol * prev, Fronctocol * self) {
+        Step & step = (*shared)[*current];
+        PeerSet ps(self->getPeers());
+        if (!step.withDealer) {
+          ps.remove(DEALER);
+        }
+        self->invoke(step.next(prev), ps);
+      };
+
+  return ::std::unique_ptr<Fronctocol>(
+      new Tester(
+          [invokeStep](Fronctocol * self) {
+            invokeStep(nullptr, self);
+          },
+          [shared, current, invokeStep](
+              Fronctocol & f, Fronctocol * self) {
+            (*current)++;
+            if (*current < shared->size()) {
+              invokeStep(&f, self);
+            } else {
+              self->complete();
+            }
+          },
+          ff::tester::failTestOnReceive<
+              ::std::string,
+              PeerSet,
+              IncomingMessage,
+              OutgoingMessage>(),
+          ff::tester::failTestOnPromise<
+              ::std::string,
+              PeerSet,
+              IncomingMessage,
+              OutgoingMessage>()));
+}
+
+::std::unique_ptr<Fronctocol>
+dealer(::std::vector<::std::unique_ptr<Fronctocol>> && houses) {
+  ::std::shared_ptr<::std::vector<::std::unique_ptr<Fronctocol>>>
+      shared = ::std::make_shared<
+          ::std::vector<::std::unique_ptr<Fronctocol>>>(
+          ::std::move(houses));
+  ::std::shared_ptr<size_t> remaining =
+      ::std::make_shared<size_t>(shared->size());
+
+  return ::std::unique_ptr<Fronctocol>(
+      new Tester(
+          [shared](Fronctocol * self) {
+            for (::std::unique_ptr<Fronctocol> & house : *shared) {
+              self->invoke(::std::move(house), self->getPeers());
+            }
+            shared->clear();
+          },
+          [remaining](Fronctocol &, Fronctocol * self) {
+            (*remaining)--;
+            if (*remaining == 0) {
+              self->complete();
+            }
+          }));
+}
+
+/**
+ * Totals for all iterations of one benchmark case.
+ */
+struct Totals {
+  size_t iterations = 0;
+  size_t ops = 0;
+  double seconds = 0.0;
+  size_t rounds = 0;
+  size_t messages = 0;
+  size_t bytes = 0;
+  size_t randomnessBytes = 0;
+  double simulatedSeconds = 0.0;
+  double maxUtilization = 0.0;
+};
+
+/**
+ * When simulate is set, runs use ff::tester::simulateTests with this
+ * network model, rather than ff::tester::runTests.
+ */
+struct Network {
+  bool simulate = false;
+  ff::tester::NetworkModel<::std::string> model;
+};
+
+static bool runCase(
+    Benchmark const & bench,
+    Params const & params,
+    size_t const iterations,
+    Network const & network,
+    Totals & totals) {
+  ::std::function<::std::unique_ptr<IncomingMessage>(
+      ::std::string const &, OutgoingMessage &)>
+      converter =
+          ff::posixnet::outgoingToIncomingMessage<::std::string>;
+
+  for (size_t i = 0; i < iterations; i++) {
+    Run run(params);
+    bench.setup(run);
+
+    ff::tester::RunStats<::std::string> stats;
+    ff::tester::SimStats<::std::string> sim_stats;
+    ::std::chrono::steady_clock::time_point const start =
+        ::std::chrono::steady_clock::now();
+    bool success;
+    if (network.simulate) {
+      success = ff::tester::simulateTests<
+          ::std::string,
+          PeerSet,
+          IncomingMessage,
+          OutgoingMessage>(
+          run.tests, converter, network.model, &sim_stats);
+    } else {
+      success = ff::tester::runTests<
+          ::std::string,
+          PeerSet,
+          IncomingMessage,
+          OutgoingMessage>(
+          run.tests,
+          converter,
+          (uint64_t)start.time_since_epoch().count(),
+          &stats);
+    }
+    ::std::chrono::duration<double> const elapsed =
+        ::std::chrono::steady_clock::now() - start;
+
+    if (!success) {
+      log_error(
+          "Benchmark %s failed (parties=%zu, length=%zu, bits=%zu)",
+          bench.name.c_str(),
+          params.parties,
+          params.length,
+          params.modulusBits);
+      return false;
+    }
+
+    totals.iterations++;
+    totals.ops += run.ops;
+    totals.seconds += elapsed.count();
+    if (network.simulate) {
+      totals.rounds += sim_stats.rounds;
+      totals.messages += sim_stats.messages;
+      totals.bytes += sim_stats.bytes;
+      for (::std::pair<
+               ::std::pair<::std::string, ::std::string> const,
+               ff::tester::SimStats<::std::string>::Link> const & link :
+           sim_stats.links) {
+        if (link.first.first == DEALER) {
+          totals.randomnessBytes += link.second.bytes;
+        }
+      }
+      totals.simulatedSeconds += sim_stats.wallTime;
+      totals.maxUtilization = ::std::max(
+          totals.maxUtilization, sim_stats.maxUtilization());
+    } else {
+      totals.rounds += stats.rounds;
+      totals.messages += stats.messages;
+      totals.bytes += stats.bytes;
+      totals.randomnessBytes += stats.bytesBySender[DEALER];
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Runs the case once more, untimed, with each participant profiled.
+ * Writes a Chrome trace to
+ * <prefix><name>-<parties>-<length>-<bits>.json, and the summaries of
+ * all participants but the dealer to stderr.
+ */
+static bool profileCase(
+    Benchmark const & bench,
+    Params const & params,
+    ::std::string const & prefix) {
+  ::std::function<::std::unique_ptr<IncomingMessage>(
+      ::std::string const &, OutgoingMessage &)>
+      converter =
+          ff::posixnet::outgoingToIncomingMessage<::std::string>;
+
+  Run run(params);
+  bench.setup(run);
+
+  ff::tester::RunStats<::std::string> stats;
+  stats.profile = true;
+  bool const success = ff::tester::runTests<
+      ::std::string,
+      PeerSet,
+      IncomingMessage,
+      OutgoingMessage>(run.tests, converter, 0, &stats);
+  if (!success) {
+    return false;
+  }
+
+  ::std::vector<ff::Profiler const *> profilers;
+  for (::std::pair<::std::string const, ff::Profiler> const & profiler :
+       stats.profilers) {
+    profilers.push_back(&profiler.second);
+    if (profiler.first != DEALER) {
+      profiler.second.writeSummary(stderr);
+    }
+  }
+
+  ::std::string const path = prefix + bench.name + "-" +
+      ::std::to_string(params.parties) + "-" +
+      ::std::to_string(params.length) + "-" +
+      ::std::to_string(params.modulusBits) + ".json";
+  FILE * out = fopen(path.c_str(), "w");
+  if (out == nullptr) {
+    log_error("Cannot open trace file %s", path.c_str());
+    return false;
+  }
+  bool const written = ff::Profiler::writeChromeTrace(out, profilers);
+  fclose(out);
+  return written;
+}
+
+static void printCase(
+    Benchmark const & bench,
+    Params const & params,
+    Totals const & totals,
+    Network const & network,
+    bool const first) {
+  double const n = static_cast<double>(totals.iterations);
+  printf(
+      "%s    {\"name\": \"%s\", \"parties\": %zu, \"length\": %zu, "
+      "\"modulus_bits\": %zu, \"iterations\": %zu, "
+      "\"seconds\": %.6f, \"ops_per_sec\": %.3f, "
+      "\"rounds\": %.1f, \"messages\": %.1f, \"bytes\": %.1f, "
+      "\"randomness_bytes\": %.1f",
+      first ? "" : ",\n",
+      bench.name.c_str(),
+      params.parties,
+      params.length,
+      params.modulusBits,
+      totals.iterations,
+      totals.seconds / n,
+      static_cast<double>(totals.ops) / totals.seconds,
+      static_cast<double>(totals.rounds) / n,
+      static_cast<double>(totals.messages) / n,
+      static_cast<double>(totals.bytes) / n,
+      static_cast<double>(totals.randomnessBytes) / n);
+  if (network.simulate) {
+    printf(
+        ", \"simulated_seconds\": %.6f, \"max_link_utilization\": %.4f",
+        totals.simulatedSeconds / n,
+        totals.maxUtilization);
+  }
+  printf("}");
+  fflush(stdout);
+}
+
+} // namespace bench
+} // namespace ff
+
+static void usage(char const * argv0) {
+  fprintf(
+      stderr,
+      "Usage: %s [--filter=<substring>] [--iterations=<n>] [--list]\n"
+      "          [--latency-ms=<ms>] [--bandwidth-mbps=<Mbit/s>]\n"
+      "          [--jitter-ms=<ms>] [--trace=<path prefix>]\n"
+      "Writes one JSON record per benchmark case to stdout. Any\n"
+      "network option runs the cases in the network simulator.\n"
+      "--trace profiles one extra run of each case and writes a\n"
+      "Chrome trace per case.\n",
+      argv0);
+}
+
+int main(int argc, char * argv[]) {
+  ::std::string filter;
+  size_t iterations = 3;
+  bool list = false;
+  ff::bench::Network network;
+  bool trace = false;
+  ::std::string trace_prefix;
+
+  for (int i = 1; i < argc; i++) {
+    if (0 == strncmp(argv[i], "--filter=", 9)) {
+      filter = ::std::string(argv[i] + 9);
+    } else if (0 == strncmp(argv[i], "--iterations=", 13)) {
+      iterations = strtoul(argv[i] + 13, nullptr, 10);
+    } else if (0 == strcmp(argv[i], "--list")) {
+      list = true;
+    } else if (0 == strncmp(argv[i], "--latency-ms=", 13)) {
+      network.simulate = true;
+      network.model.defaultLink.latency =
+          strtod(argv[i] + 13, nullptr) / 1000.0;
+    } else if (0 == strncmp(argv[i], "--bandwidth-mbps=", 17)) {
+      network.simulate = true;
+      network.model.defaultLink.bandwidth =
+          strtod(argv[i] + 17, nullptr) * 1000000.0 / 8.0;
+    } else if (0 == strncmp(argv[i], "--trace=", 8)) {
+      trace = true;
+      trace_prefix = ::std::string(argv[i] + 8);
+    } else if (0 == strncmp(argv[i], "--jitter-ms=", 12)) {
+      network.simulate = true;
+      network.model.defaultLink.jitter =
+          strtod(argv[i] + 12, nullptr) / 1000.0;
+    } else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (iterations == 0) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  bool success = true;
+  bool first = true;
+  if (!list) {
+    printf("{\"benchmarks\": [\n");
+  }
+  for (ff::bench::Benchmark const & bench : ff::bench::registry()) {
+    if (bench.name.find(filter) == ::std::string::npos) {
+      continue;
+    }
+    if (list) {
+      printf("%s\n", bench.name.c_str());
+      continue;
+    }
+
+    for (ff::bench::Params const & params : bench.params) {
+      LOG_ORGANIZATION = "bench";
+      log_info(
+          "Running %s (parties=%zu, length=%zu, bits=%zu)",
+          bench.name.c_str(),
+          params.parties,
+          params.length,
+          params.modulusBits);
+      ff::bench::Totals totals;
+      if (ff::bench::runCase(
+              bench, params, iterations, network, totals)) {
+        ff::bench::printCase(bench, params, totals, network, first);
+        first = false;
+      } else {
+        success = false;
+      }
+      if (trace &&
+          !ff::bench::profileCase(bench, params, trace_prefix)) {
+        success = false;
+      }
+    }
+  }
+  if (!list) {
+    printf("\n]}\n");
+  }
+
+  return success ? 0 : 1;
+}
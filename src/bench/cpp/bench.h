@@ -0,0 +1,223 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+#ifndef FF_BENCH_BENCH_H_
+#define FF_BENCH_BENCH_H_
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <ff/Fronctocol.h>
+#include <ff/Message.h>
+#include <ff/PeerSet.h>
+#include <ff/Promise.h>
+#include <ff/VectorPeerSet.h>
+#include <ff/posixnet/posixnet.h>
+#include <ff/tester/Tester.h>
+#include <ff/tester/runTests.h>
+#include <mpc/ObservationList.h>
+#include <mpc/Randomness.h>
+#include <mpc/templates.h>
+
+/* Logging Configuration */
+#include <ff/logging.h>
+
+/* Macro to shorten the correct list of fronctocol template parameters */
+#define BENCH_TYPES \
+  std::string, PeerSet, IncomingMessage, OutgoingMessage
+
+namespace ff {
+namespace bench {
+
+using IncomingMessage = ff::posixnet::IncomingMessage<::std::string>;
+using OutgoingMessage = ff::posixnet::OutgoingMessage<::std::string>;
+
+using PeerSet = ff::VectorPeerSet<::std::string>;
+
+using Fronctocol = ff::Fronctocol<
+    ::std::string,
+    PeerSet,
+    IncomingMessage,
+    OutgoingMessage>;
+
+using Tester = ff::tester::
+    Tester<::std::string, PeerSet, IncomingMessage, OutgoingMessage>;
+
+template<typename Result_T>
+using PromiseFronctocol = ff::PromiseFronctocol<
+    ::std::string,
+    PeerSet,
+    IncomingMessage,
+    OutgoingMessage,
+    Result_T>;
+
+/**
+ * Sizes of a single benchmark case. modulusBits selects the Mersenne
+ * prime (2^modulusBits - 1) for benchmarks which take a modulus, and
+ * is only reported by the others.
+ */
+struct Params {
+  size_t parties;
+  size_t length;
+  size_t modulusBits;
+};
+
+/**
+ * State for one run of one benchmark case. The setup function fills
+ * tests with a fronctocol per participant and sets ops to the number
+ * of operations (elements compared, multiplied, sorted, ...) performed
+ * by the run. Anything the fronctocols point at is kept alive in
+ * storage until the run finishes.
+ */
+struct Run {
+  Params const params;
+  ::std::map<::std::string, ::std::unique_ptr<Fronctocol>> tests;
+  size_t ops = 0;
+
+  Run(Params const & p) : params(p) {
+  }
+
+  template<typename T, typename... Args_T>
+  T & make(Args_T &&... args) {
+    ::std::shared_ptr<T> ptr =
+        ::std::make_shared<T>(::std::forward<Args_T>(args)...);
+    this->storage.push_back(ptr);
+    return *ptr;
+  }
+
+private:
+  ::std::vector<::std::shared_ptr<void>> storage;
+};
+
+using Setup = ::std::function<void(Run &)>;
+
+struct Benchmark {
+  ::std::string name;
+  Setup setup;
+  ::std::vector<Params> params;
+};
+
+::std::vector<Benchmark> & registry();
+
+/**
+ * Static instances of Registrar add a benchmark to the registry.
+ */
+struct Registrar {
+  Registrar(
+      ::std::string const & name,
+      Setup const & setup,
+      ::std::vector<Params> const & params);
+};
+
+/**
+ * Identities used by all benchmarks. The revealer is always party 0.
+ */
+extern ::std::string const DEALER;
+::std::string const & partyName(size_t const i);
+
+/**
+ * One step of a participant's script. next is given the fronctocol
+ * completed by the previous step (nullptr for the first step) and
+ * returns the fronctocol to invoke. When withDealer is false the
+ * dealer is removed from the step's peers.
+ */
+struct Step {
+  bool withDealer;
+  ::std::function<::std::unique_ptr<Fronctocol>(Fronctocol * prev)>
+      next;
+};
+
+/**
+ * A participant which invokes each step in order and completes after
+ * the last step completes.
+ */
+::std::unique_ptr<Fronctocol> script(::std::vector<Step> && steps);
+
+/**
+ * A dealer which invokes all of the houses at once and completes after
+ * they have all completed.
+ */
+::std::unique_ptr<Fronctocol>
+dealer(::std::vector<::std::unique_ptr<Fronctocol>> && houses);
+
+template<typename Number_T>
+Number_T mersenne(size_t const bits) {
+  return (Number_T(1) << bits) - 1;
+}
+
+/**
+ * Secret shares an observation list whose first key column holds a
+ * random permutation of 1..n_records. Other columns are zero.
+ */
+template<typename Number_T>
+::std::vector<ff::mpc::ObservationList<Number_T>> shareObservations(
+    size_t const n_parties,
+    size_t const n_records,
+    size_t const n_keys,
+    size_t const n_arith,
+    size_t const n_xor,
+    Number_T const modulus) {
+  ::std::vector<Number_T> perm(n_records);
+  for (size_t i = 0; i < n_records; i++) {
+    perm[i] = static_cast<Number_T>(i + 1);
+  }
+  for (size_t i = 0; i + 1 < n_records; i++) {
+    size_t const j = i + ff::mpc::randomModP<size_t>(n_records - i);
+    ::std::swap(perm[i], perm[j]);
+  }
+
+  ::std::vector<ff::mpc::ObservationList<Number_T>> shares(n_parties);
+  for (ff::mpc::ObservationList<Number_T> & list : shares) {
+    list.numKeyCols = n_keys;
+    list.numArithmeticPayloadCols = n_arith;
+    list.numXORPayloadCols = n_xor;
+    list.elements.resize(n_records);
+  }
+
+  ::std::vector<Number_T> vals;
+  ::std::vector<Boolean_t> bits;
+  for (size_t i = 0; i < n_records; i++) {
+    for (size_t j = 0; j < n_keys; j++) {
+      ff::mpc::arithmeticSecretShare(
+          n_parties, modulus, j == 0 ? perm[i] : Number_T(0), vals);
+      for (size_t k = 0; k < n_parties; k++) {
+        shares[k].elements[i].keyCols.push_back(vals[k]);
+      }
+    }
+    for (size_t j = 0; j < n_arith; j++) {
+      ff::mpc::arithmeticSecretShare(
+          n_parties, modulus, Number_T(0), vals);
+      for (size_t k = 0; k < n_parties; k++) {
+        shares[k].elements[i].arithmeticPayloadCols.push_back(vals[k]);
+      }
+    }
+    for (size_t j = 0; j < n_xor; j++) {
+      ff::mpc::xorSecretShare(n_parties, Boolean_t(0), bits);
+      for (size_t k = 0; k < n_parties; k++) {
+        shares[k].elements[i].XORPayloadCols.push_back(bits[k]);
+      }
+    }
+  }
+
+  return shares;
+}
+
+} // namespace bench
+} // namespace ff
+
+#define LOG_UNCLUDE
+#include <ff/logging.h>
+
+#endif // FF_BENCH_BENCH_H_
@@ -0,0 +1,102 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <bench.h>
+
+#include <mpc/Batch.h>
+#include <mpc/Compare.h>
+#include <mpc/CompareDealer.h>
+#include <mpc/Randomness.h>
+
+/* Logging Configuration */
+#include <ff/logging.h>
+
+using namespace ff::mpc;
+using namespace ff::bench;
+
+template<typename Number_T>
+static void compare(Run & run) {
+  using Info_T = CompareInfo<std::string, Number_T, Number_T>;
+  using Patron_T =
+      CompareRandomnessPatron<BENCH_TYPES, Number_T, Number_T>;
+
+  size_t const n_parties = run.params.parties;
+  size_t const length = run.params.length;
+  Number_T const p = mersenne<Number_T>(run.params.modulusBits);
+
+  Info_T const & info = run.make<Info_T>(p, &partyName(0));
+
+  std::vector<std::unique_ptr<Fronctocol>> houses;
+  houses.emplace_back(
+      new CompareRandomnessHouse<BENCH_TYPES, Number_T, Number_T>(
+          &info));
+  run.tests[DEALER] = dealer(std::move(houses));
+
+  std::vector<std::vector<Number_T>> xs(n_parties);
+  std::vector<std::vector<Number_T>> ys(n_parties);
+  std::vector<Number_T> shares;
+  for (size_t i = 0; i < length; i++) {
+    arithmeticSecretShare(n_parties, p, randomModP(p / 2), shares);
+    for (size_t j = 0; j < n_parties; j++) {
+      xs[j].push_back(shares[j]);
+    }
+    arithmeticSecretShare(n_parties, p, randomModP(p / 2), shares);
+    for (size_t j = 0; j < n_parties; j++) {
+      ys[j].push_back(shares[j]);
+    }
+  }
+
+  for (size_t i = 0; i < n_parties; i++) {
+    std::vector<Number_T> & x =
+        run.make<std::vector<Number_T>>(std::move(xs[i]));
+    std::vector<Number_T> & y =
+        run.make<std::vector<Number_T>>(std::move(ys[i]));
+
+    Step patron;
+    patron.withDealer = true;
+    patron.next = [&info, length](Fronctocol *) {
+      return std::unique_ptr<Fronctocol>(
+          new Patron_T(&info, &DEALER, length));
+    };
+
+    Step cmp;
+    cmp.withDealer = false;
+    cmp.next = [&info, &x, &y](Fronctocol * prev) {
+      Patron_T & patron = static_cast<Patron_T &>(*prev);
+      std::vector<std::unique_ptr<Fronctocol>> children;
+      children.reserve(x.size());
+      for (size_t j = 0; j < x.size(); j++) {
+        children.emplace_back(
+            new Compare<BENCH_TYPES, Number_T, Number_T>(
+                x[j], y[j], &info, patron.compareDispenser->get()));
+      }
+      return std::unique_ptr<Fronctocol>(
+          new Batch<BENCH_TYPES>(std::move(children)));
+    };
+
+    run.tests[partyName(i)] = script({patron, cmp});
+  }
+
+  run.ops = length;
+}
+
+static Registrar compare32(
+    "compare",
+    compare<uint32_t>,
+    {{2, 16, 31}, {3, 16, 31}, {5, 16, 31}, {3, 128, 31}});
+
+static Registrar compare64(
+    "compare", compare<uint64_t>, {{3, 16, 61}, {3, 128, 61}});
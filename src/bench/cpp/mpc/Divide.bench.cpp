@@ -0,0 +1,127 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <bench.h>
+
+#include <mpc/Batch.h>
+#include <mpc/Compare.h>
+#include <mpc/Divide.h>
+#include <mpc/DivideDealer.h>
+#include <mpc/PrefixOr.h>
+#include <mpc/Randomness.h>
+
+/* Logging Configuration */
+#include <ff/logging.h>
+
+using namespace ff::mpc;
+using namespace ff::bench;
+
+/**
+ * Divides random dividends by random divisors of about half the
+ * modulus width.
+ */
+template<typename Number_T>
+static void divide(Run & run) {
+  using CompareInfo_T = CompareInfo<std::string, Number_T, Number_T>;
+  using Info_T = DivideInfo<std::string, Number_T, Number_T>;
+  using Patron_T =
+      DivideRandomnessPatron<BENCH_TYPES, Number_T, Number_T>;
+
+  size_t const n_parties = run.params.parties;
+  size_t const length = run.params.length;
+  Number_T const p = mersenne<Number_T>(run.params.modulusBits);
+  Number_T const divisorBound = Number_T(1)
+      << (run.params.modulusBits / 2);
+
+  CompareInfo_T const & compareInfo =
+      run.make<CompareInfo_T>(p, &partyName(0));
+  PrefixOrInfo<std::string, Number_T> const prefInfo(
+      p, compareInfo.ell, &partyName(0));
+  Info_T const & info = run.make<Info_T>(
+      &partyName(0),
+      p,
+      compareInfo.ell,
+      prefInfo.lambda,
+      prefInfo.lagrangePolynomialStorage,
+      &compareInfo);
+
+  std::vector<std::unique_ptr<Fronctocol>> houses;
+  houses.emplace_back(
+      new DivideRandomnessHouse<BENCH_TYPES, Number_T, Number_T>(
+          &info));
+  run.tests[DEALER] = dealer(std::move(houses));
+
+  std::vector<std::vector<Number_T>> xs(n_parties);
+  std::vector<std::vector<Number_T>> ys(n_parties);
+  std::vector<Number_T> shares;
+  for (size_t i = 0; i < length; i++) {
+    arithmeticSecretShare(n_parties, p, randomModP(p), shares);
+    for (size_t j = 0; j < n_parties; j++) {
+      xs[j].push_back(shares[j]);
+    }
+    arithmeticSecretShare(
+        n_parties, p, 1 + randomModP(divisorBound), shares);
+    for (size_t j = 0; j < n_parties; j++) {
+      ys[j].push_back(shares[j]);
+    }
+  }
+
+  for (size_t i = 0; i < n_parties; i++) {
+    std::vector<Number_T> & x =
+        run.make<std::vector<Number_T>>(std::move(xs[i]));
+    std::vector<Number_T> & y =
+        run.make<std::vector<Number_T>>(std::move(ys[i]));
+    std::vector<Number_T> & z =
+        run.make<std::vector<Number_T>>(length, Number_T(0));
+
+    Step patron;
+    patron.withDealer = true;
+    patron.next = [&info, length](Fronctocol *) {
+      return std::unique_ptr<Fronctocol>(
+          new Patron_T(&info, &DEALER, length));
+    };
+
+    Step div;
+    div.withDealer = false;
+    div.next = [&info, &x, &y, &z](Fronctocol * prev) {
+      Patron_T & patron = static_cast<Patron_T &>(*prev);
+      std::vector<std::unique_ptr<Fronctocol>> children;
+      children.reserve(x.size());
+      for (size_t j = 0; j < x.size(); j++) {
+        children.emplace_back(
+            new Divide<BENCH_TYPES, Number_T, Number_T>(
+                x[j],
+                y[j],
+                &z[j],
+                &info,
+                patron.divideDispenser->get()));
+      }
+      return std::unique_ptr<Fronctocol>(
+          new Batch<BENCH_TYPES>(std::move(children)));
+    };
+
+    run.tests[partyName(i)] = script({patron, div});
+  }
+
+  run.ops = length;
+}
+
+static Registrar divide32(
+    "divide",
+    divide<uint32_t>,
+    {{2, 4, 31}, {3, 4, 31}, {5, 4, 31}});
+
+static Registrar divide64("divide", divide<uint64_t>, {{3, 4, 61}});
@@ -0,0 +1,115 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <bench.h>
+
+#include <mpc/Multiply.h>
+#include <mpc/Randomness.h>
+#include <mpc/RandomnessDealer.h>
+
+/* Logging Configuration */
+#include <ff/logging.h>
+
+using namespace ff::mpc;
+using namespace ff::bench;
+
+template<typename Number_T>
+static void multiply(Run & run) {
+  using Dispenser_T =
+      RandomnessDispenser<BeaverTriple<Number_T>, BeaverInfo<Number_T>>;
+
+  size_t const n_parties = run.params.parties;
+  size_t const length = run.params.length;
+  Number_T const p = mersenne<Number_T>(run.params.modulusBits);
+
+  MultiplyInfo<std::string, BeaverInfo<Number_T>> const & info =
+      run.make<MultiplyInfo<std::string, BeaverInfo<Number_T>>>(
+          &partyName(0), BeaverInfo<Number_T>(p));
+
+  std::vector<std::unique_ptr<Fronctocol>> houses;
+  houses.emplace_back(new RandomnessHouse<
+                      BENCH_TYPES,
+                      BeaverTriple<Number_T>,
+                      BeaverInfo<Number_T>>());
+  run.tests[DEALER] = dealer(std::move(houses));
+
+  std::vector<std::vector<Number_T>> xs(n_parties);
+  std::vector<std::vector<Number_T>> ys(n_parties);
+  std::vector<Number_T> shares;
+  for (size_t i = 0; i < length; i++) {
+    arithmeticSecretShare(n_parties, p, randomModP(p), shares);
+    for (size_t j = 0; j < n_parties; j++) {
+      xs[j].push_back(shares[j]);
+    }
+    arithmeticSecretShare(n_parties, p, randomModP(p), shares);
+    for (size_t j = 0; j < n_parties; j++) {
+      ys[j].push_back(shares[j]);
+    }
+  }
+
+  for (size_t i = 0; i < n_parties; i++) {
+    std::vector<Number_T> & x =
+        run.make<std::vector<Number_T>>(std::move(xs[i]));
+    std::vector<Number_T> & y =
+        run.make<std::vector<Number_T>>(std::move(ys[i]));
+    std::vector<Number_T> & z = run.make<std::vector<Number_T>>();
+
+    Step patron;
+    patron.withDealer = true;
+    patron.next = [&info, length](Fronctocol *) {
+      return std::unique_ptr<Fronctocol>(new RandomnessPatron<
+                                         BENCH_TYPES,
+                                         BeaverTriple<Number_T>,
+                                         BeaverInfo<Number_T>>(
+          DEALER, length, info.info));
+    };
+
+    Step mult;
+    mult.withDealer = false;
+    mult.next = [&info, &x, &y, &z](Fronctocol * prev) {
+      std::unique_ptr<Dispenser_T> & dispenser =
+          static_cast<PromiseFronctocol<Dispenser_T> &>(*prev).result;
+      std::vector<BeaverTriple<Number_T>> beavers;
+      beavers.reserve(x.size());
+      for (size_t j = 0; j < x.size(); j++) {
+        beavers.push_back(dispenser->get());
+      }
+      return std::unique_ptr<Fronctocol>(
+          new BatchedMultiply<BENCH_TYPES, Number_T>(
+              std::move(x),
+              std::move(y),
+              &z,
+              std::move(beavers),
+              &info));
+    };
+
+    run.tests[partyName(i)] = script({patron, mult});
+  }
+
+  run.ops = length;
+}
+
+static Registrar multiply32(
+    "multiply",
+    multiply<uint32_t>,
+    {{2, 64, 31},
+     {3, 64, 31},
+     {5, 64, 31},
+     {3, 1024, 31},
+     {3, 16384, 31}});
+
+static Registrar multiply64(
+    "multiply", multiply<uint64_t>, {{3, 64, 61}, {3, 1024, 61}});
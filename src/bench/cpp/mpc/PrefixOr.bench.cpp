@@ -0,0 +1,95 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <bench.h>
+
+#include <mpc/PrefixOr.h>
+#include <mpc/PrefixOrDealer.h>
+#include <mpc/Randomness.h>
+#include <mpc/simplePrime.h>
+
+/* Logging Configuration */
+#include <ff/logging.h>
+
+using namespace ff::mpc;
+using namespace ff::bench;
+
+/**
+ * One prefix-or over a list of secret shared bits. The modulus is the
+ * smallest prime larger than length + 1, so modulusBits is unused.
+ */
+template<typename Number_T, PrefixOrStrategy Strategy>
+static void prefixOr(Run & run) {
+  using Info_T = PrefixOrInfo<std::string, Number_T>;
+  using Patron_T = PrefixOrRandomnessPatron<BENCH_TYPES, Number_T>;
+
+  size_t const n_parties = run.params.parties;
+  size_t const length = run.params.length;
+  Number_T const s = nextPrime(static_cast<Number_T>(length + 2));
+
+  Info_T const & info =
+      run.make<Info_T>(s, length, &partyName(0), Strategy);
+
+  std::vector<std::unique_ptr<Fronctocol>> houses;
+  houses.emplace_back(
+      new PrefixOrRandomnessHouse<BENCH_TYPES, Number_T>(&info));
+  run.tests[DEALER] = dealer(std::move(houses));
+
+  std::vector<std::vector<Number_T>> xs(n_parties);
+  std::vector<Number_T> shares;
+  for (size_t i = 0; i < length; i++) {
+    arithmeticSecretShare(
+        n_parties, s, randomModP<Number_T>(2), shares);
+    for (size_t j = 0; j < n_parties; j++) {
+      xs[j].push_back(shares[j]);
+    }
+  }
+
+  for (size_t i = 0; i < n_parties; i++) {
+    std::vector<Number_T> & x =
+        run.make<std::vector<Number_T>>(std::move(xs[i]));
+
+    Step patron;
+    patron.withDealer = true;
+    patron.next = [&info](Fronctocol *) {
+      return std::unique_ptr<Fronctocol>(
+          new Patron_T(&info, &DEALER, 1UL));
+    };
+
+    Step por;
+    por.withDealer = false;
+    por.next = [&info, &x](Fronctocol * prev) {
+      Patron_T & patron = static_cast<Patron_T &>(*prev);
+      return std::unique_ptr<Fronctocol>(
+          new PrefixOr<BENCH_TYPES, Number_T>(
+              x, &info, patron.prefixOrDispenser->get()));
+    };
+
+    run.tests[partyName(i)] = script({patron, por});
+  }
+
+  run.ops = length;
+}
+
+static Registrar prefixOr32(
+    "prefix_or",
+    prefixOr<uint32_t, PrefixOrStrategy::sqrtBlocks>,
+    {{2, 64, 0}, {3, 64, 0}, {5, 64, 0}, {3, 256, 0}, {3, 1024, 0}});
+
+static Registrar prefixOrLogDepth32(
+    "prefix_or_log_depth",
+    prefixOr<uint32_t, PrefixOrStrategy::logDepth>,
+    {{2, 64, 0}, {3, 64, 0}, {5, 64, 0}, {3, 256, 0}, {3, 1024, 0}});
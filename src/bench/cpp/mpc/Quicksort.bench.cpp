@@ -0,0 +1,64 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <bench.h>
+
+#include <mpc/Compare.h>
+#include <mpc/ObservationList.h>
+#include <mpc/Quicksort.h>
+#include <mpc/QuicksortDealer.h>
+
+/* Logging Configuration */
+#include <ff/logging.h>
+
+using namespace ff::mpc;
+using namespace ff::bench;
+
+/**
+ * Sorts a list with one key, one arithmetic and one XOR column.
+ */
+template<typename Number_T>
+static void quicksort(Run & run) {
+  using Info_T = CompareInfo<std::string, Number_T, Number_T>;
+
+  size_t const n_parties = run.params.parties;
+  size_t const length = run.params.length;
+  Number_T const p = mersenne<Number_T>(run.params.modulusBits);
+
+  Info_T const & info = run.make<Info_T>(p, &partyName(0));
+
+  run.tests[DEALER] = std::unique_ptr<Fronctocol>(
+      new QuicksortRandomnessHouse<BENCH_TYPES, Number_T, Number_T>(
+          info, length, 1));
+
+  std::vector<ObservationList<Number_T>> lists =
+      shareObservations<Number_T>(n_parties, length, 1, 1, 1, p);
+
+  for (size_t i = 0; i < n_parties; i++) {
+    ObservationList<Number_T> & list =
+        run.make<ObservationList<Number_T>>(std::move(lists[i]));
+    run.tests[partyName(i)] = std::unique_ptr<Fronctocol>(
+        new QuickSortFronctocol<BENCH_TYPES, Number_T, Number_T>(
+            &list, info, &partyName(0), &DEALER));
+  }
+
+  run.ops = length;
+}
+
+static Registrar quicksort64(
+    "quicksort",
+    quicksort<uint64_t>,
+    {{2, 32, 31}, {3, 32, 31}, {5, 32, 31}, {3, 128, 31}, {3, 32, 61}});
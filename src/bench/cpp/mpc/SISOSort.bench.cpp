@@ -0,0 +1,63 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <bench.h>
+
+#include <mpc/ObservationList.h>
+#include <mpc/SISOSort.h>
+#include <mpc/SISOSortDealer.h>
+
+/* Logging Configuration */
+#include <ff/logging.h>
+
+using namespace ff::mpc;
+using namespace ff::bench;
+
+/**
+ * Shuffles and sorts a list with one key, one arithmetic and one XOR
+ * column.
+ */
+template<typename Number_T>
+static void sisoSort(Run & run) {
+  size_t const n_parties = run.params.parties;
+  size_t const length = run.params.length;
+  Number_T const p = mersenne<Number_T>(run.params.modulusBits);
+
+  run.tests[DEALER] = std::unique_ptr<Fronctocol>(
+      new SISOSortRandomnessHouse<BENCH_TYPES, Number_T, Number_T>(
+          length, p, &partyName(0), &DEALER));
+
+  std::vector<ObservationList<Number_T>> lists =
+      shareObservations<Number_T>(n_parties, length, 1, 1, 1, p);
+
+  for (size_t i = 0; i < n_parties; i++) {
+    ObservationList<Number_T> & list =
+        run.make<ObservationList<Number_T>>(std::move(lists[i]));
+    run.tests[partyName(i)] = std::unique_ptr<Fronctocol>(
+        new SISOSort<BENCH_TYPES, Number_T, Number_T>(
+            list, p, &partyName(0), &DEALER));
+  }
+
+  run.ops = length;
+}
+
+static Registrar sisoSort32(
+    "siso_sort",
+    sisoSort<uint32_t>,
+    {{2, 32, 31}, {3, 32, 31}, {5, 32, 31}, {3, 128, 31}});
+
+static Registrar sisoSort64(
+    "siso_sort", sisoSort<uint64_t>, {{3, 32, 61}});
@@ -0,0 +1,172 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <bench.h>
+
+#include <mpc/Multiply.h>
+#include <mpc/ObservationList.h>
+#include <mpc/Randomness.h>
+#include <mpc/RandomnessDealer.h>
+#include <mpc/Waksman.h>
+
+/* Logging Configuration */
+#include <ff/logging.h>
+
+using namespace ff::mpc;
+using namespace ff::bench;
+
+/**
+ * Randomness collected by one party before it can shuffle.
+ */
+template<typename Number_T>
+struct WaksmanInputs {
+  ObservationList<Number_T> list;
+  WaksmanBits<Number_T> bits;
+  std::unique_ptr<
+      RandomnessDispenser<BeaverTriple<Number_T>, BeaverInfo<Number_T>>>
+      beavers;
+  std::unique_ptr<
+      RandomnessDispenser<BeaverTriple<Number_T>, BeaverInfo<Number_T>>>
+      keyBeavers;
+  std::unique_ptr<
+      RandomnessDispenser<BeaverTriple<Boolean_t>, BooleanBeaverInfo>>
+      xorBeavers;
+};
+
+/**
+ * Requests n instances of randomness from the dealer, after passing the
+ * previous step's fronctocol to collect.
+ */
+template<typename Rand_T, typename Info_T>
+static Step patronStep(
+    size_t const n,
+    Info_T const & info,
+    std::function<void(Fronctocol *)> const & collect) {
+  Step step;
+  step.withDealer = true;
+  step.next = [n, info, collect](Fronctocol * prev) {
+    if (collect) {
+      collect(prev);
+    }
+    return std::unique_ptr<Fronctocol>(
+        new RandomnessPatron<BENCH_TYPES, Rand_T, Info_T>(
+            DEALER, n, info));
+  };
+  return step;
+}
+
+template<typename Rand_T, typename Info_T>
+static std::unique_ptr<RandomnessDispenser<Rand_T, Info_T>>
+patronResult(Fronctocol * prev) {
+  using Dispenser_T = RandomnessDispenser<Rand_T, Info_T>;
+  return std::move(
+      static_cast<PromiseFronctocol<Dispenser_T> &>(*prev).result);
+}
+
+/**
+ * Shuffles a list with one key, one arithmetic and one XOR column.
+ */
+template<typename Number_T>
+static void waksman(Run & run) {
+  using Beaver_T = BeaverTriple<Number_T>;
+  using BeaverInfo_T = BeaverInfo<Number_T>;
+  using XORBeaver_T = BeaverTriple<Boolean_t>;
+
+  size_t const n_parties = run.params.parties;
+  size_t const length = run.params.length;
+  Number_T const p = mersenne<Number_T>(run.params.modulusBits);
+
+  size_t d = 1;
+  while (((size_t)1 << d) < length) {
+    d++;
+  }
+  size_t const expanded = (size_t)1 << d;
+  size_t const swaps = expanded * (d - 1) + 1;
+  WaksmanInfo<Number_T> const info(p, p, expanded, d, swaps);
+
+  std::vector<std::unique_ptr<Fronctocol>> houses;
+  houses.emplace_back(new RandomnessHouse<
+                      BENCH_TYPES,
+                      WaksmanBits<Number_T>,
+                      WaksmanInfo<Number_T>>());
+  houses.emplace_back(
+      new RandomnessHouse<BENCH_TYPES, Beaver_T, BeaverInfo_T>());
+  houses.emplace_back(
+      new RandomnessHouse<BENCH_TYPES, Beaver_T, BeaverInfo_T>());
+  houses.emplace_back(new RandomnessHouse<
+                      BENCH_TYPES,
+                      XORBeaver_T,
+                      BooleanBeaverInfo>());
+  run.tests[DEALER] = dealer(std::move(houses));
+
+  std::vector<ObservationList<Number_T>> lists =
+      shareObservations<Number_T>(n_parties, length, 1, 1, 1, p);
+
+  for (size_t i = 0; i < n_parties; i++) {
+    WaksmanInputs<Number_T> & in = run.make<WaksmanInputs<Number_T>>();
+    in.list = std::move(lists[i]);
+
+    Step bits = patronStep<WaksmanBits<Number_T>>(1, info, nullptr);
+    Step beavers = patronStep<Beaver_T>(
+        swaps, BeaverInfo_T(p), [&in](Fronctocol * prev) {
+          in.bits = patronResult<
+                        WaksmanBits<Number_T>,
+                        WaksmanInfo<Number_T>>(prev)
+                        ->get();
+        });
+    Step keyBeavers = patronStep<Beaver_T>(
+        swaps, BeaverInfo_T(p), [&in](Fronctocol * prev) {
+          in.beavers = patronResult<Beaver_T, BeaverInfo_T>(prev);
+        });
+    Step xorBeavers = patronStep<XORBeaver_T>(
+        2 * swaps, BooleanBeaverInfo(), [&in](Fronctocol * prev) {
+          in.keyBeavers = patronResult<Beaver_T, BeaverInfo_T>(prev);
+        });
+
+    Step shuffle;
+    shuffle.withDealer = false;
+    shuffle.next = [&in, p, d](Fronctocol * prev) {
+      in.xorBeavers =
+          patronResult<XORBeaver_T, BooleanBeaverInfo>(prev);
+      return std::unique_ptr<Fronctocol>(
+          new WaksmanShuffle<BENCH_TYPES, Number_T>(
+              in.list,
+              p,
+              p,
+              in.bits,
+              d,
+              std::move(in.beavers),
+              std::move(in.keyBeavers),
+              std::move(in.xorBeavers),
+              &partyName(0)));
+    };
+
+    run.tests[partyName(i)] =
+        script({bits, beavers, keyBeavers, xorBeavers, shuffle});
+  }
+
+  run.ops = length;
+}
+
+static Registrar waksman64(
+    "waksman_shuffle",
+    waksman<uint64_t>,
+    {{2, 64, 61},
+     {3, 64, 61},
+     {5, 64, 61},
+     {3, 256, 61},
+     {3, 1024, 61}});
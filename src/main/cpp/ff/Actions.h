@@ -9,6 +9,7 @@
 
 /* C++ Headers */
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 
@@ -25,7 +26,14 @@ template<
     typename OutgoingMessage_T>
 class Fronctocol;
 
-enum class ActionType { send, invoke, complete, await, abortion };
+enum class ActionType {
+  send,
+  invoke,
+  complete,
+  await,
+  compute,
+  abortion
+};
 
 template<
     typename Identity_T,
@@ -153,6 +161,31 @@ struct AwaitAction : public Action<
   }
 };
 
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+struct ComputeAction : public Action<
+                           Identity_T,
+                           PeerSet_T,
+                           IncomingMessage_T,
+                           OutgoingMessage_T> {
+  ::std::function<void()> task;
+  ::std::function<void()> then;
+
+  ComputeAction(
+      ::std::function<void()> task, ::std::function<void()> then) :
+      Action<
+          Identity_T,
+          PeerSet_T,
+          IncomingMessage_T,
+          OutgoingMessage_T>(ActionType::compute),
+      task(::std::move(task)),
+      then(::std::move(then)) {
+  }
+};
+
 template<
     typename Identity_T,
     typename PeerSet_T,
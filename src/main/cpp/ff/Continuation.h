@@ -0,0 +1,169 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+#ifndef FF_CONTINUATION_H_
+#define FF_CONTINUATION_H_
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <ff/Fronctocol.h>
+#include <ff/Message.h>
+#include <ff/Promise.h>
+
+/* logging configuration */
+#include <ff/logging.h>
+
+namespace ff {
+
+/**
+ * An IncomingMessage holding a copy of the unread remainder of another
+ * message, kept for a continuation which has not yet been registered.
+ */
+template<typename Identity_T>
+class BufferedMessage : public IncomingMessage<Identity_T> {
+private:
+  ::std::vector<uint8_t> buffer;
+  size_t place = 0;
+
+public:
+  BufferedMessage(IncomingMessage<Identity_T> & msg);
+
+  size_t remove(void * buf, size_t const len) override;
+  size_t length() const override;
+  void clear() override;
+};
+
+/**
+ * A Fronctocol whose control flow is written as a chain of
+ * continuations, rather than as a state machine spread across
+ * handleComplete, handlePromise and handleReceive.
+ *
+ * Each of invokeThen, awaitThen and receiveThen starts waiting for
+ * one event, and calls its continuation when that event happens.
+ * Continuations may start more waits, so a protocol reads top to
+ * bottom:
+ *
+ *   this->invokeThen(std::move(reveal), this->getPeers(),
+ *       [this](Reveal_T & r) {
+ *         this->receiveThen(peer, [this](Message_T & msg) {
+ *           ...
+ *           this->complete();
+ *         });
+ *       });
+ *
+ * Any number of waits may be outstanding at once, so independent
+ * children can run side by side. Messages from a peer are handed to
+ * that peer's receive continuations in order, and are buffered if they
+ * arrive before a continuation is waiting for them.
+ *
+ * Subclasses implement init() and name(). The handle* methods belong
+ * to this class. A child completion or promise which nobody is
+ * waiting for aborts the fronctocol, as does completing while a
+ * buffered message was never received.
+ */
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+class ContinuationFronctocol : public Fronctocol<
+                                  Identity_T,
+                                  PeerSet_T,
+                                  IncomingMessage_T,
+                                  OutgoingMessage_T> {
+public:
+  using Fronctocol_T = Fronctocol<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T>;
+  using Message_T = IncomingMessage<Identity_T>;
+
+  void handleReceive(IncomingMessage_T & msg) final;
+  void handleComplete(Fronctocol_T & f) final;
+  void handlePromise(Fronctocol_T & f) final;
+
+protected:
+  /**
+   * Invokes f, and calls then(F_T &) with f once it completes.
+   */
+  template<typename F_T, typename Then_T>
+  void invokeThen(
+      ::std::unique_ptr<F_T> f, PeerSet_T const & p, Then_T then);
+
+  /**
+   * Awaits the promise, and calls then(std::unique_ptr<Result_T>) with
+   * its result once the promised fronctocol completes.
+   */
+  template<typename Result_T, typename Then_T>
+  void awaitThen(
+      ::std::unique_ptr<Promise<
+          Identity_T,
+          PeerSet_T,
+          IncomingMessage_T,
+          OutgoingMessage_T,
+          Result_T>> promise,
+      Then_T then);
+
+  /**
+   * Calls then with the next message from peer.
+   */
+  void receiveThen(
+      Identity_T const & peer, ::std::function<void(Message_T &)> then);
+
+  /**
+   * The number of waits which have not yet been resumed.
+   */
+  size_t numWaiting() const;
+
+  /**
+   * Completes the fronctocol, or aborts it if any message is still
+   * buffered, since no continuation will ever receive it.
+   */
+  void complete();
+
+private:
+  ::std::map<
+      Fronctocol_T const *,
+      ::std::function<void(Fronctocol_T &)>>
+      completeWaits;
+
+  // Each returns its resumption if f is its promise, or else nullptr.
+  ::std::vector<
+      ::std::function<::std::function<void()>(Fronctocol_T &)>>
+      promiseWaits;
+
+  ::std::map<
+      Identity_T,
+      ::std::deque<::std::function<void(Message_T &)>>>
+      receiveWaits;
+
+  ::std::map<
+      Identity_T,
+      ::std::deque<::std::unique_ptr<BufferedMessage<Identity_T>>>>
+      bufferedMessages;
+};
+
+#include <ff/Continuation.t.h>
+
+} // namespace ff
+
+#define LOG_UNCLUDE
+#include <ff/logging.h>
+
+#endif // FF_CONTINUATION_H_
@@ -0,0 +1,231 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+template<typename Identity_T>
+BufferedMessage<Identity_T>::BufferedMessage(
+    IncomingMessage<Identity_T> & msg) :
+    IncomingMessage<Identity_T>(msg.sender), buffer(msg.length()) {
+  if (!this->buffer.empty()) {
+    this->buffer.resize(msg.remove(&this->buffer[0], msg.length()));
+  }
+}
+
+template<typename Identity_T>
+size_t
+BufferedMessage<Identity_T>::remove(void * buf, size_t const len) {
+  size_t const n = len < this->length() ? len : this->length();
+  if (n > 0) {
+    ::std::memcpy(buf, &this->buffer[this->place], n);
+  }
+  this->place += n;
+  return n;
+}
+
+template<typename Identity_T>
+size_t BufferedMessage<Identity_T>::length() const {
+  return this->buffer.size() - this->place;
+}
+
+template<typename Identity_T>
+void BufferedMessage<Identity_T>::clear() {
+  this->place = this->buffer.size();
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+void ContinuationFronctocol<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::handleReceive(IncomingMessage_T & msg) {
+  auto waits = this->receiveWaits.find(msg.sender);
+  if (waits == this->receiveWaits.end() || waits->second.empty()) {
+    this->bufferedMessages[msg.sender].emplace_back(
+        new BufferedMessage<Identity_T>(msg));
+    return;
+  }
+
+  ::std::function<void(Message_T &)> then =
+      ::std::move(waits->second.front());
+  waits->second.pop_front();
+  then(msg);
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+void ContinuationFronctocol<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::handleComplete(Fronctocol_T & f) {
+  auto wait = this->completeWaits.find(&f);
+  if (wait == this->completeWaits.end()) {
+    log_error("%s: unexpected handleComplete", this->name().c_str());
+    this->abort();
+    return;
+  }
+
+  ::std::function<void(Fronctocol_T &)> then =
+      ::std::move(wait->second);
+  this->completeWaits.erase(wait);
+  then(f);
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+void ContinuationFronctocol<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::handlePromise(Fronctocol_T & f) {
+  for (auto wait = this->promiseWaits.begin();
+       wait != this->promiseWaits.end();
+       wait++) {
+    ::std::function<void()> resume = (*wait)(f);
+    if (resume) {
+      this->promiseWaits.erase(wait);
+      resume();
+      return;
+    }
+  }
+
+  log_error("%s: unexpected handlePromise", this->name().c_str());
+  this->abort();
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+template<typename F_T, typename Then_T>
+void ContinuationFronctocol<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::
+    invokeThen(
+        ::std::unique_ptr<F_T> f, PeerSet_T const & p, Then_T then) {
+  Fronctocol_T const * const key = f.get();
+  this->completeWaits.emplace(key, [then](Fronctocol_T & done) {
+    then(static_cast<F_T &>(done));
+  });
+  this->invoke(::std::move(f), p);
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+template<typename Result_T, typename Then_T>
+void ContinuationFronctocol<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::
+    awaitThen(
+        ::std::unique_ptr<Promise<
+            Identity_T,
+            PeerSet_T,
+            IncomingMessage_T,
+            OutgoingMessage_T,
+            Result_T>> promise,
+        Then_T then) {
+  // std::function must be copyable, so the promise is shared.
+  ::std::shared_ptr<Promise<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T,
+      Result_T>>
+      shared(::std::move(promise));
+  this->await(*shared);
+  this->promiseWaits.emplace_back(
+      [shared, then](Fronctocol_T & done) -> ::std::function<void()> {
+        ::std::shared_ptr<::std::unique_ptr<Result_T>> result =
+            ::std::make_shared<::std::unique_ptr<Result_T>>(
+                shared->getResult(done));
+        if (*result == nullptr) {
+          return nullptr;
+        }
+        return [then, result]() { then(::std::move(*result)); };
+      });
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+void ContinuationFronctocol<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::
+    receiveThen(
+        Identity_T const & peer,
+        ::std::function<void(Message_T &)> then) {
+  auto buffered = this->bufferedMessages.find(peer);
+  if (buffered == this->bufferedMessages.end() ||
+      buffered->second.empty()) {
+    this->receiveWaits[peer].emplace_back(::std::move(then));
+    return;
+  }
+
+  ::std::unique_ptr<BufferedMessage<Identity_T>> msg =
+      ::std::move(buffered->second.front());
+  buffered->second.pop_front();
+  then(*msg);
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+size_t ContinuationFronctocol<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::numWaiting() const {
+  size_t n = this->completeWaits.size() + this->promiseWaits.size();
+  for (auto const & waits : this->receiveWaits) {
+    n += waits.second.size();
+  }
+  return n;
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+void ContinuationFronctocol<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::complete() {
+  for (auto const & buffered : this->bufferedMessages) {
+    if (!buffered.second.empty()) {
+      log_error(
+          "%s: completed with %zu unreceived message(s)",
+          this->name().c_str(),
+          buffered.second.size());
+      this->abort();
+      return;
+    }
+  }
+
+  this->Fronctocol_T::complete();
+}
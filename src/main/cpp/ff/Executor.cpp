@@ -0,0 +1,162 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <ff/Executor.h>
+
+namespace ff {
+
+/* The executor and worker index of the current thread, if any. */
+static thread_local Executor const * currentExecutor = nullptr;
+static thread_local size_t currentWorker = 0;
+
+Executor::Executor(size_t const threads) : queued(0), nextWorker(0) {
+  size_t num_threads = threads;
+  if (num_threads == 0) {
+    num_threads = ::std::thread::hardware_concurrency();
+  }
+  if (num_threads == 0) {
+    num_threads = 1;
+  }
+
+  for (size_t i = 0; i < num_threads; i++) {
+    this->workers.emplace_back(new Worker());
+  }
+  for (size_t i = 0; i < num_threads; i++) {
+    this->threads.emplace_back([this, i]() { this->work(i); });
+  }
+}
+
+Executor::~Executor() {
+  {
+    ::std::lock_guard<::std::mutex> lock(this->sleepMutex);
+    this->stopping = true;
+  }
+  this->wake.notify_all();
+  for (::std::thread & thread : this->threads) {
+    thread.join();
+  }
+}
+
+void Executor::post(::std::function<void()> task) {
+  size_t index;
+  if (currentExecutor == this) {
+    index = currentWorker;
+  } else {
+    index = this->nextWorker++ % this->workers.size();
+  }
+
+  {
+    Worker & worker = *this->workers[index];
+    ::std::lock_guard<::std::mutex> lock(worker.mutex);
+    // Counted under the lock, so a take() never sees the task first.
+    this->queued++;
+    worker.tasks.push_back(::std::move(task));
+  }
+
+  {
+    ::std::lock_guard<::std::mutex> lock(this->sleepMutex);
+  }
+  this->wake.notify_one();
+}
+
+size_t Executor::numThreads() const {
+  return this->threads.size();
+}
+
+bool Executor::take(
+    size_t const index, ::std::function<void()> & task) {
+  {
+    Worker & worker = *this->workers[index];
+    ::std::lock_guard<::std::mutex> lock(worker.mutex);
+    if (!worker.tasks.empty()) {
+      task = ::std::move(worker.tasks.back());
+      worker.tasks.pop_back();
+      this->queued--;
+      return true;
+    }
+  }
+
+  for (size_t i = 1; i < this->workers.size(); i++) {
+    Worker & victim =
+        *this->workers[(index + i) % this->workers.size()];
+    ::std::lock_guard<::std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      task = ::std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      this->queued--;
+      return true;
+    }
+  }
+  return false;
+}
+
+void Executor::work(size_t const index) {
+  currentExecutor = this;
+  currentWorker = index;
+
+  while (true) {
+    ::std::function<void()> task;
+    if (this->take(index, task)) {
+      task();
+      continue;
+    }
+
+    ::std::unique_lock<::std::mutex> lock(this->sleepMutex);
+    this->wake.wait(lock, [this]() {
+      return this->stopping || this->queued.load() > 0;
+    });
+    if (this->stopping && this->queued.load() == 0) {
+      return;
+    }
+  }
+}
+
+Executor::Strand::Strand(Executor & e) :
+    executor(e), state(new State()) {
+}
+
+void Executor::Strand::post(::std::function<void()> task) {
+  ::std::shared_ptr<State> const s = this->state;
+  bool schedule;
+  {
+    ::std::lock_guard<::std::mutex> lock(s->mutex);
+    s->tasks.push_back(::std::move(task));
+    schedule = !s->running;
+    s->running = true;
+  }
+
+  if (schedule) {
+    this->executor.post([s]() { Strand::drain(*s); });
+  }
+}
+
+void Executor::Strand::drain(State & s) {
+  while (true) {
+    ::std::function<void()> task;
+    {
+      ::std::lock_guard<::std::mutex> lock(s.mutex);
+      if (s.tasks.empty()) {
+        s.running = false;
+        return;
+      }
+      task = ::std::move(s.tasks.front());
+      s.tasks.pop_front();
+    }
+    task();
+  }
+}
+
+} // namespace ff
@@ -0,0 +1,104 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+#ifndef FF_EXECUTOR_H_
+#define FF_EXECUTOR_H_
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+
+namespace ff {
+
+/**
+ * A work-stealing thread pool. Each worker has its own queue of tasks:
+ * tasks posted from a worker go to the back of its own queue, and other
+ * tasks are spread round robin. Workers run tasks from the back of their
+ * own queue, and steal from the front of others' when theirs is empty.
+ *
+ * Tasks run in no particular order. A Strand runs the tasks posted to it
+ * in order, and never two at once, which is how work for one
+ * FronctocolsManager is kept serial.
+ */
+class Executor {
+public:
+  /**
+   * Starts the given number of worker threads, or one per hardware
+   * thread if threads is 0.
+   */
+  explicit Executor(size_t const threads = 0);
+  Executor(Executor const &) = delete;
+  Executor & operator=(Executor const &) = delete;
+
+  /**
+   * Runs all tasks which have been posted, then joins the workers.
+   */
+  ~Executor();
+
+  void post(::std::function<void()> task);
+
+  size_t numThreads() const;
+
+  class Strand {
+  public:
+    explicit Strand(Executor & executor);
+    Strand(Strand const &) = delete;
+    Strand & operator=(Strand const &) = delete;
+
+    /**
+     * Posts a task to run after all tasks previously posted to this
+     * strand. The strand may be destroyed before its tasks run.
+     */
+    void post(::std::function<void()> task);
+
+  private:
+    struct State {
+      ::std::mutex mutex;
+      ::std::deque<::std::function<void()>> tasks;
+      bool running = false;
+    };
+
+    Executor & executor;
+    ::std::shared_ptr<State> state;
+
+    static void drain(State & state);
+  };
+
+private:
+  struct Worker {
+    ::std::mutex mutex;
+    ::std::deque<::std::function<void()>> tasks;
+  };
+
+  ::std::vector<::std::unique_ptr<Worker>> workers;
+  ::std::vector<::std::thread> threads;
+
+  /* Tasks posted and not yet taken by a worker. */
+  ::std::atomic<size_t> queued;
+  ::std::atomic<size_t> nextWorker;
+
+  ::std::mutex sleepMutex;
+  ::std::condition_variable wake;
+  bool stopping = false;
+
+  bool take(size_t const index, ::std::function<void()> & task);
+  void work(size_t const index);
+};
+
+} // namespace ff
+
+#endif // FF_EXECUTOR_H_
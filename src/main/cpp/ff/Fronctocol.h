@@ -9,6 +9,7 @@
 
 /* C++ Headers */
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 
@@ -17,6 +18,7 @@
 /* Fortissimo Headers */
 #include <ff/Actions.h>
 #include <ff/FronctocolHandler.h>
+#include <ff/Pool.h>
 #include <ff/Promise.h>
 #include <ff/Util.h>
 
@@ -82,6 +84,18 @@ public:
     return this->handler->id;
   }
 
+  /**
+   * The Pools of this fronctocol's manager, shared with every other
+   * fronctocol it runs. getPool<T>() is the Pool of objects of type T.
+   */
+  Pools & getPools() const {
+    return this->handler->pools;
+  }
+  template<typename T>
+  Pool<T> & getPool() const {
+    return this->handler->pools.template get<T>();
+  }
+
   /**
    * Sends a message to a peer fronctocol on another server.
    */
@@ -134,6 +148,19 @@ public:
              OutgoingMessage_T,
              Result_T> & pf);
 
+  /**
+   * Runs task, a purely local computation, then calls then as an update
+   * of this fronctocol, in which it may send, invoke or complete as in
+   * any handler.
+   *
+   * If the manager has an offloader, such as a SessionRunner's
+   * Executor, task runs on another thread while this fronctocol keeps
+   * handling its events. Task must only touch data which nothing else
+   * touches until then is called. Otherwise task runs immediately.
+   */
+  void compute(
+      ::std::function<void()> task, ::std::function<void()> then);
+
   /**
    * Indicates to the framework that something went terribly wrong and
    * the protocol should be aborted.
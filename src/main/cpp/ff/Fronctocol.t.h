@@ -136,6 +136,27 @@ void Fronctocol<
           OutgoingMessage_T>(pf.promisedFronctocol));
 }
 
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+void Fronctocol<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::
+    compute(
+        ::std::function<void()> task, ::std::function<void()> then) {
+  log_assert(nullptr != this->actions);
+  this->actions->emplace_back(
+      new ComputeAction<
+          Identity_T,
+          PeerSet_T,
+          IncomingMessage_T,
+          OutgoingMessage_T>(::std::move(task), ::std::move(then)));
+}
+
 template<
     typename Identity_T,
     typename PeerSet_T,
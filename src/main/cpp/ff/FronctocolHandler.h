@@ -10,6 +10,7 @@
 /* C++ Headers */
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -18,6 +19,7 @@
 /* Fortissimo Headers */
 #include <ff/Actions.h>
 #include <ff/Fronctocol.h>
+#include <ff/Pool.h>
 #include <ff/Util.h>
 
 /* Logging Config */
@@ -40,6 +42,7 @@ template<
 struct FronctocolHandler {
   fronctocolId_t id = FRONCTOCOLID_INVALID;
   Identity_T const & self;
+  Pools & pools;
   FronctocolHandler<
       Identity_T,
       PeerSet_T,
@@ -72,14 +75,28 @@ struct FronctocolHandler {
   bool completed = false;
   bool collected = false;
 
+  /**
+   * This fronctocol's instance number in the manager's Profiler, if
+   * any.
+   */
+  size_t profileInstance = 0;
+
   explicit FronctocolHandler(
-      Identity_T const & s, PeerSet_T const & p) :
-      self(s), peers(p) {
+      Identity_T const & s, Pools & pools, PeerSet_T const & p) :
+      self(s), pools(pools), peers(p) {
   }
 
-  explicit FronctocolHandler(Identity_T const & s) : self(s) {
+  explicit FronctocolHandler(Identity_T const & s, Pools & pools) :
+      self(s), pools(pools) {
   }
 
+  /**
+   * Returns this handler to the state of a newly constructed one with
+   * the given peers, releasing its fronctocol but keeping the capacity
+   * of its containers, so that the FronctocolsManager may recycle it.
+   */
+  void reset(PeerSet_T const & p);
+
   void init(::std::vector<::std::unique_ptr<Action<
                 Identity_T,
                 PeerSet_T,
@@ -114,6 +131,13 @@ struct FronctocolHandler {
           PeerSet_T,
           IncomingMessage_T,
           OutgoingMessage_T>>> * actions);
+  void handleComputed(
+      ::std::function<void()> const & then,
+      ::std::vector<::std::unique_ptr<Action<
+          Identity_T,
+          PeerSet_T,
+          IncomingMessage_T,
+          OutgoingMessage_T>>> * actions);
 
   LogTimer timer;
 };
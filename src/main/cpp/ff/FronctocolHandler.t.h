@@ -2,6 +2,30 @@
  * Copyright Stealth Software Technologies, Inc.
  */
 
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+void FronctocolHandler<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::reset(PeerSet_T const & p) {
+  this->id = FRONCTOCOLID_INVALID;
+  this->parent = nullptr;
+  this->cradle.clear();
+  this->womb.clear();
+  this->peers = p;
+  this->implementation = nullptr;
+  this->incomingMessageCaches.clear();
+  this->promised = false;
+  this->completed = false;
+  this->collected = false;
+  this->profileInstance = 0;
+  this->timer = LogTimer();
+}
+
 template<
     typename Identity_T,
     typename PeerSet_T,
@@ -95,3 +119,25 @@ void FronctocolHandler<
   this->implementation->handlePromise(fronctocol);
   this->implementation->setActions(nullptr);
 }
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+void FronctocolHandler<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::
+    handleComputed(
+        ::std::function<void()> const & then,
+        ::std::vector<::std::unique_ptr<Action<
+            Identity_T,
+            PeerSet_T,
+            IncomingMessage_T,
+            OutgoingMessage_T>>> * actions) {
+  this->implementation->setActions(actions);
+  then();
+  this->implementation->setActions(nullptr);
+}
@@ -13,7 +13,6 @@
 #include <map>
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -23,6 +22,8 @@
 #include <ff/Actions.h>
 #include <ff/Fronctocol.h>
 #include <ff/FronctocolHandler.h>
+#include <ff/Pool.h>
+#include <ff/Profiler.h>
 #include <ff/Util.h>
 
 /* logging configuration */
@@ -43,21 +44,42 @@ private:
   Identity_T const & self;
 
   /**
-   * Generates the next ID by incrementing.
+   * Counts the fronctocols invoked so far, including main.
    */
-  fronctocolId_t fronctocolIdGenerator = 1;
+  size_t fronctocolCount = 1;
 
   /**
-   * Map (with ownership) of existing fronctocol IDs to fronctcols.
+   * Pools of any type, shared by the fronctocols through
+   * Fronctocol::getPool. Declared before the fronctocols, so that it
+   * outlives them, and held by pointer, so that the handlers'
+   * references to it survive moving this.
    */
-  ::std::unordered_map<
-      fronctocolId_t,
-      ::std::unique_ptr<FronctocolHandler<
-          Identity_T,
-          PeerSet_T,
-          IncomingMessage_T,
-          OutgoingMessage_T>>>
+  ::std::unique_ptr<Pools> pools;
+
+  /**
+   * Slots (with ownership) of existing fronctocols, indexed by their
+   * IDs. IDs are dense: a freed slot's ID is reused by a later invoke.
+   * Empty slots are nullptr.
+   */
+  ::std::vector<::std::unique_ptr<FronctocolHandler<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T>>>
       fronctocols;
+  ::std::vector<fronctocolId_t> freeIds;
+  size_t numLiveFronctocols = 0;
+
+  /**
+   * Recycles FronctocolHandlers, along with the capacity of their
+   * containers and message caches.
+   */
+  Pool<FronctocolHandler<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T>>
+      handlerPool;
 
   /**
    * Flags used to indicate completion status of the protocol.
@@ -66,6 +88,42 @@ private:
   bool finished = false;
   bool aborted = false;
 
+  /**
+   * Optional instrumentation, not owned by this.
+   */
+  Profiler * profiler = nullptr;
+
+public:
+  /**
+   * Runs a compute task on another thread, then arranges for
+   * handleComputed to be called with the given compute ID on the
+   * thread which runs this manager.
+   */
+  using Offloader_T = ::std::function<void(
+      ::std::function<void()> task, size_t const computeId)>;
+
+private:
+  /**
+   * Where compute tasks are run, if not immediately.
+   */
+  Offloader_T offloader;
+
+  /**
+   * The continuations of offloaded compute tasks, by compute ID, and
+   * the number of tasks offloaded so far.
+   */
+  struct PendingCompute {
+    fronctocolId_t id;
+    Fronctocol<
+        Identity_T,
+        PeerSet_T,
+        IncomingMessage_T,
+        OutgoingMessage_T> const * fronctocol;
+    ::std::function<void()> then;
+  };
+  ::std::map<size_t, PendingCompute> pendingComputes;
+  size_t numOffloaded = 0;
+
 public:
   FronctocolsManager(Identity_T const & self);
   /**
@@ -100,11 +158,38 @@ public:
    * Aborted indicates that connections should be forcibly closed because
    * something went wrong.
    */
+  /**
+   * Resumes the fronctocol whose compute task was given this ID after
+   * the task has finished.
+   */
+  void handleComputed(
+      size_t const computeId,
+      ::std::vector<::std::unique_ptr<OutgoingMessage_T>> * omsgs);
+
   bool isFinished() const;
   bool isClosed() const;
   bool isAborted() const;
 
   size_t getNumFronctocols() const;
+  size_t getNumLiveFronctocols() const;
+
+  /**
+   * Records each fronctocol's spans and messages in the profiler, or
+   * stops profiling if it is nullptr. It must outlive this, and should
+   * be set before init.
+   */
+  void setProfiler(Profiler * profiler);
+
+  /**
+   * Offloads compute tasks, or runs them immediately if offloader is
+   * empty. It should be set before init.
+   */
+  void setOffloader(Offloader_T offloader);
+
+  /**
+   * The number of compute tasks which have been offloaded so far.
+   */
+  size_t getNumOffloaded() const;
 
 private:
   /**
@@ -211,8 +296,55 @@ private:
           IncomingMessage_T,
           OutgoingMessage_T> & action,
       ::std::vector<::std::unique_ptr<OutgoingMessage_T>> * omsgs);
+  void handleComputeAction(
+      FronctocolHandler<
+          Identity_T,
+          PeerSet_T,
+          IncomingMessage_T,
+          OutgoingMessage_T> & handler,
+      ComputeAction<
+          Identity_T,
+          PeerSet_T,
+          IncomingMessage_T,
+          OutgoingMessage_T> & action,
+      ::std::vector<::std::unique_ptr<OutgoingMessage_T>> * omsgs);
   void handleAbort(
       ::std::vector<::std::unique_ptr<OutgoingMessage_T>> * omsgs);
+
+  /**
+   * Calls the continuation of a compute task as an update of handler.
+   */
+  void resumeCompute(
+      FronctocolHandler<
+          Identity_T,
+          PeerSet_T,
+          IncomingMessage_T,
+          OutgoingMessage_T> & handler,
+      ::std::function<void()> const & then,
+      ::std::vector<::std::unique_ptr<OutgoingMessage_T>> * omsgs);
+
+  /**
+   * Helpers for the fronctocol slots and handler pool.
+   */
+  ::std::unique_ptr<FronctocolHandler<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T>>
+  newHandler(PeerSet_T const & peers);
+  fronctocolId_t reserveId();
+  void emplaceFronctocol(::std::unique_ptr<FronctocolHandler<
+                             Identity_T,
+                             PeerSet_T,
+                             IncomingMessage_T,
+                             OutgoingMessage_T>> handler);
+  FronctocolHandler<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T> *
+  findFronctocol(fronctocolId_t const id);
+  void eraseFronctocol(fronctocolId_t const id);
 };
 
 #include <ff/FronctocolsManager.t.h>
@@ -14,23 +14,20 @@ FronctocolsManager<
     PeerSet_T,
     IncomingMessage_T,
     OutgoingMessage_T>::FronctocolsManager(Identity_T const & self) :
-    self(self) {
-  this->fronctocols[MAIN_ID] = ::std::unique_ptr<FronctocolHandler<
-      Identity_T,
-      PeerSet_T,
-      IncomingMessage_T,
-      OutgoingMessage_T>>(
-      new FronctocolHandler<
-          Identity_T,
-          PeerSet_T,
-          IncomingMessage_T,
-          OutgoingMessage_T>(this->self));
-  FronctocolHandler<
+    self(self), pools(new Pools()) {
+  ::std::unique_ptr<FronctocolHandler<
       Identity_T,
       PeerSet_T,
       IncomingMessage_T,
-      OutgoingMessage_T> & main_handler = *this->fronctocols[MAIN_ID];
-  main_handler.id = MAIN_ID;
+      OutgoingMessage_T>>
+      main_handler(new FronctocolHandler<
+                   Identity_T,
+                   PeerSet_T,
+                   IncomingMessage_T,
+                   OutgoingMessage_T>(this->self, *this->pools));
+  main_handler->id = this->reserveId();
+  log_assert(main_handler->id == MAIN_ID);
+  this->emplaceFronctocol(::std::move(main_handler));
 }
 
 template<
@@ -54,7 +51,7 @@ void FronctocolsManager<
   log_assert(!this->initialized, "Init invoked multiple times");
 
   /* Step 1. Insert an empty FronctocolHandler for main with peers and ID
-   * 0 into the fronctocols map. */
+   * 0 into the fronctocols slots. */
   FronctocolHandler<
       Identity_T,
       PeerSet_T,
@@ -64,14 +61,18 @@ void FronctocolsManager<
   main_handler.implementation = ::std::move(main);
   main_handler.implementation->setHandler(&main_handler);
   main_handler.peers = peers;
-  main_handler.peers.forEach([](Identity_T const &,
-                                fronctocolId_t & id,
-                                bool &) { id = MAIN_ID; });
+  main_handler.peers.visit([](Identity_T const &,
+                              fronctocolId_t & id,
+                              bool &) { id = MAIN_ID; });
   main_handler.timer = log_time_start_ctx(
       (::std::string("FF: ") + main_handler.implementation->name() +
        "; ID: " + ::std::to_string(main_handler.id))
           .c_str(),
       "parent: none");
+  if (this->profiler != nullptr) {
+    main_handler.profileInstance = this->profiler->addInstance(
+        main_handler.implementation->name(), Profiler::NONE);
+  }
 
   /* Step 2. Set this's initialized flag. */
   this->initialized = true;
@@ -84,7 +85,13 @@ void FronctocolsManager<
       OutgoingMessage_T>>>
       actions;
   log_time_update(main_handler.timer, "main init start");
-  main_handler.init(&actions);
+  {
+    Profiler::Scope scope(
+        this->profiler,
+        main_handler.profileInstance,
+        Profiler::SpanKind::init);
+    main_handler.init(&actions);
+  }
   log_time_update(main_handler.timer, "main init end");
   this->handleActions(main_handler, actions, omsgs);
 
@@ -150,16 +157,13 @@ void FronctocolsManager<
     return;
   }
 
-  /* Step 4. look up the fronctocol in the map of fronctocols. */
-  typename std::unordered_map<
-      fronctocolId_t,
-      std::unique_ptr<FronctocolHandler<
-          Identity_T,
-          PeerSet_T,
-          IncomingMessage_T,
-          OutgoingMessage_T>>>::iterator finder =
-      this->fronctocols.find(fronctocol_id);
-  if (finder == this->fronctocols.end()) {
+  /* Step 4. look up the fronctocol in the fronctocols slots. */
+  FronctocolHandler<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T> * finder = this->findFronctocol(fronctocol_id);
+  if (finder == nullptr) {
     log_warn(
         "Cannot handle message from %s for non-existant fronctocol %lu",
         identity_to_string(imsg.sender).c_str(),
@@ -169,19 +173,19 @@ void FronctocolsManager<
   }
 
   /* Step 4. Check if this message needs to be cached. */
-  if (!this->initialized || !finder->second->peers.hasAllPeerIds()) {
-    finder->second->incomingMessageCaches.push_back(
+  if (!this->initialized || !finder->peers.hasAllPeerIds()) {
+    finder->incomingMessageCaches.push_back(
         imsg.createCache(ctrl_blk));
     return;
   }
 
-  if_debug if (!finder->second->peers.hasPeer(imsg.sender)) {
+  if_debug if (!finder->peers.hasPeer(imsg.sender)) {
     log_warn("message from non participant in fronctocol");
   }
-  log_assert(finder->second->incomingMessageCaches.size() == 0);
+  log_assert(finder->incomingMessageCaches.size() == 0);
 
   /* Step 5. delegate to the appropriate sub-handler. */
-  this->distributeMessage(ctrl_blk, imsg, *finder->second, omsgs);
+  this->distributeMessage(ctrl_blk, imsg, *finder, omsgs);
 }
 
 template<
@@ -281,6 +285,15 @@ void FronctocolsManager<
               IncomingMessage_T,
               OutgoingMessage_T> &>(*actions[i]),
           omsgs);
+    } else if (actions[i]->type == ActionType::compute) {
+      this->handleComputeAction(
+          handler,
+          static_cast<ComputeAction<
+              Identity_T,
+              PeerSet_T,
+              IncomingMessage_T,
+              OutgoingMessage_T> &>(*actions[i]),
+          omsgs);
     } else if (actions[i]->type == ActionType::abortion) {
       log_error("Abort action occured");
       this->handleAbort(omsgs);
@@ -337,7 +350,13 @@ void FronctocolsManager<
             actions;
         log_time_update(
             parent.cradle[i]->timer, "init after sync start");
-        parent.cradle[i]->init(&actions);
+        {
+          Profiler::Scope scope(
+              this->profiler,
+              parent.cradle[i]->profileInstance,
+              Profiler::SpanKind::init);
+          parent.cradle[i]->init(&actions);
+        }
         log_time_update(parent.cradle[i]->timer, "init after sync end");
         this->handleActions(*parent.cradle[i], actions, omsgs);
 
@@ -369,11 +388,7 @@ void FronctocolsManager<
 
   /* Step 4. If none of the above succeeded, add a new fronctocol to the
    * womb. */
-  parent.womb.emplace_back(new FronctocolHandler<
-                           Identity_T,
-                           PeerSet_T,
-                           IncomingMessage_T,
-                           OutgoingMessage_T>(this->self, peerset));
+  parent.womb.push_back(this->newHandler(peerset));
   parent.womb[parent.womb.size() - 1]->peers.setId(
       imsg.sender, peer_id);
 }
@@ -408,7 +423,13 @@ void FronctocolsManager<
       OutgoingMessage_T>>>
       actions;
   log_time_update(handler.timer, "handle receive start");
-  handler.handleReceive(imsg, &actions);
+  {
+    Profiler::Scope scope(
+        this->profiler,
+        handler.profileInstance,
+        Profiler::SpanKind::receive);
+    handler.handleReceive(imsg, &actions);
+  }
   log_time_update(handler.timer, "handle receive end");
   this->handleActions(handler, actions, omsgs);
 }
@@ -444,7 +465,7 @@ void FronctocolsManager<
     }
     log_debug("erasing fronctocol %lu", handler.id);
     log_time_update(handler.timer, "freed after complete message");
-    this->fronctocols.erase(handler.id);
+    this->eraseFronctocol(handler.id);
   }
 }
 
@@ -475,7 +496,7 @@ void FronctocolsManager<
   if_debug {
     size_t n_peers = 0;
     bool has_self = false;
-    action.peers.forEach(
+    action.peers.visit(
         [&](Identity_T const & peer, fronctocolId_t &, bool &) {
           n_peers++;
           if (peer == this->self) {
@@ -491,7 +512,8 @@ void FronctocolsManager<
     }
   }
 
-  fronctocolId_t child_id = this->fronctocolIdGenerator++;
+  fronctocolId_t child_id = this->reserveId();
+  this->fronctocolCount++;
   ::std::unique_ptr<FronctocolHandler<
       Identity_T,
       PeerSet_T,
@@ -517,16 +539,7 @@ void FronctocolsManager<
       parent.womb.erase(parent.womb.begin() + (ssize_t)i);
     } else // Step 3. If none found in womb, make a new one.
     {
-      child_handler = ::std::unique_ptr<FronctocolHandler<
-          Identity_T,
-          PeerSet_T,
-          IncomingMessage_T,
-          OutgoingMessage_T>>(
-          new FronctocolHandler<
-              Identity_T,
-              PeerSet_T,
-              IncomingMessage_T,
-              OutgoingMessage_T>(this->self, action.peers));
+      child_handler = this->newHandler(action.peers);
       child_handler->peers.setId(this->self, child_id);
     }
   }
@@ -547,9 +560,13 @@ void FronctocolsManager<
       (::std::string("child: ") + std::to_string(child_handler->id) +
        ((action.promised) ? ", promise" : ", invoke"))
           .c_str());
+  if (this->profiler != nullptr) {
+    child_handler->profileInstance = this->profiler->addInstance(
+        child_handler->implementation->name(), parent.profileInstance);
+  }
 
   /* Step 5. Send a sync message to each of the child's peers. */
-  child_handler->peers.forEach(
+  child_handler->peers.visit(
       [&](Identity_T const & peer, fronctocolId_t &, bool &) {
         if (peer == this->self) {
           return;
@@ -572,39 +589,54 @@ void FronctocolsManager<
         omsg->template write<PeerSet_T>(child_handler->peers);
         omsg->template write<fronctocolId_t>(child_handler->id);
 
+        if (this->profiler != nullptr) {
+          this->profiler->recordSend(
+              child_handler->profileInstance, omsg->length());
+        }
         omsgs->push_back(::std::move(omsg));
       });
 
-  /* Step 6. Either invoke the child, or insert it into the parent's cradle. */
-  if (child_handler->peers.hasAllPeerIds()) {
-    log_debug(
-        "init fronctocol %lu from invoke action", child_handler->id);
+  /* Step 6. Enter the child's ID and handler into the FronctocolsManager,
+   * before it may run. */
+  FronctocolHandler<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T> & child = *child_handler;
+  this->emplaceFronctocol(::std::move(child_handler));
+
+  /* Step 7. Either invoke the child, or insert it into the parent's cradle. */
+  if (child.peers.hasAllPeerIds()) {
+    log_debug("init fronctocol %lu from invoke action", child.id);
     ::std::vector<::std::unique_ptr<Action<
         Identity_T,
         PeerSet_T,
         IncomingMessage_T,
         OutgoingMessage_T>>>
         actions;
-    log_time_update(child_handler->timer, "init immediately start");
-    child_handler->init(&actions);
-    log_time_update(child_handler->timer, "init immediately end");
-    this->handleActions(*child_handler, actions, omsgs);
+    log_time_update(child.timer, "init immediately start");
+    {
+      Profiler::Scope scope(
+          this->profiler,
+          child.profileInstance,
+          Profiler::SpanKind::init);
+      child.init(&actions);
+    }
+    log_time_update(child.timer, "init immediately end");
+    this->handleActions(child, actions, omsgs);
 
     for (::std::unique_ptr<typename IncomingMessage_T::Cache> &
-             imsg_cache : child_handler->incomingMessageCaches) {
+             imsg_cache : child.incomingMessageCaches) {
       this->distributeMessage(
           imsg_cache->controlBlock,
           *imsg_cache->uncache(),
-          *child_handler,
+          child,
           omsgs);
     }
-    child_handler->incomingMessageCaches.clear();
+    child.incomingMessageCaches.clear();
   } else {
-    parent.cradle.push_back(child_handler.get());
+    parent.cradle.push_back(&child);
   }
-
-  /* Step 7. Enter the child's ID and handler into the FronctocolsManager. */
-  this->fronctocols[child_handler->id] = ::std::move(child_handler);
 }
 
 template<
@@ -666,6 +698,9 @@ void FronctocolsManager<
   omsg->prepend((void *)buf, sizeof(uint8_t) + sizeof(fronctocolId_t));
 
   /* Step 3. Add it to the outgoing messages list. */
+  if (this->profiler != nullptr) {
+    this->profiler->recordSend(handler.profileInstance, omsg->length());
+  }
   omsgs->push_back(::std::move(omsg));
 }
 
@@ -699,7 +734,7 @@ void FronctocolsManager<
   handler.peers.setCompleted(this->self);
 
   /* Step 3. Send a complete message to each of f's peers. */
-  handler.peers.forEach(
+  handler.peers.visit(
       [&](Identity_T const & peer, fronctocolId_t & id, bool &) {
         if (peer == this->self) {
           return;
@@ -716,6 +751,10 @@ void FronctocolsManager<
         omsg->template write<uint8_t>(CTRLBLK_COMPLETE);
         omsg->template write<fronctocolId_t>(id);
 
+        if (this->profiler != nullptr) {
+          this->profiler->recordSend(
+              handler.profileInstance, omsg->length());
+        }
         omsgs->push_back(::std::move(omsg));
       });
 
@@ -733,12 +772,20 @@ void FronctocolsManager<
       if (handler.promised) {
         log_time_update(
             handler.parent->timer, "handle promise on complete start");
+        Profiler::Scope scope(
+            this->profiler,
+            handler.parent->profileInstance,
+            Profiler::SpanKind::promise);
         handler.parent->handlePromise(
             *handler.implementation, &actions);
         log_time_update(
             handler.parent->timer, "handle promise on complete end");
       } else if (!handler.promised) {
         log_time_update(handler.parent->timer, "handle complete start");
+        Profiler::Scope scope(
+            this->profiler,
+            handler.parent->profileInstance,
+            Profiler::SpanKind::complete);
         handler.parent->handleComplete(
             *handler.implementation, &actions);
         log_time_update(handler.parent->timer, "handle complete end");
@@ -755,7 +802,7 @@ void FronctocolsManager<
   /* if it was collected, and all peers are completed, remove it */
   if (handler.collected && handler.peers.checkAllComplete()) {
     log_time_update(handler.timer, "freed immediately");
-    this->fronctocols.erase(handler.id);
+    this->eraseFronctocol(handler.id);
   }
 }
 
@@ -782,23 +829,19 @@ void FronctocolsManager<
             OutgoingMessage_T> & action,
         ::std::vector<::std::unique_ptr<OutgoingMessage_T>> * omsgs) {
   /* Step 1. Check for erroneous calls to await */
-  typename ::std::unordered_map<
-      fronctocolId_t,
-      ::std::unique_ptr<FronctocolHandler<
-          Identity_T,
-          PeerSet_T,
-          IncomingMessage_T,
-          OutgoingMessage_T>>>::iterator finder =
-      this->fronctocols.find(action.awaitedFronctocol->getId());
-  log_assert(
-      finder != this->fronctocols.end(),
-      "Cannot await a nonexistant fronctocol");
+  FronctocolHandler<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T> * finder =
+      this->findFronctocol(action.awaitedFronctocol->getId());
+  log_assert(finder != nullptr, "Cannot await a nonexistant fronctocol");
 
   FronctocolHandler<
       Identity_T,
       PeerSet_T,
       IncomingMessage_T,
-      OutgoingMessage_T> & awaited = *finder->second;
+      OutgoingMessage_T> & awaited = *finder;
   log_assert(awaited.promised, "Awaited fronctocol is not a promise.");
 
   log_debug(
@@ -822,7 +865,13 @@ void FronctocolsManager<
         OutgoingMessage_T>>>
         actions;
     log_time_update(handler.timer, "handle promise on await start");
-    handler.handlePromise(*awaited.implementation, &actions);
+    {
+      Profiler::Scope scope(
+          this->profiler,
+          handler.profileInstance,
+          Profiler::SpanKind::promise);
+      handler.handlePromise(*awaited.implementation, &actions);
+    }
     log_time_update(handler.timer, "handle promise on await end");
     this->handleActions(handler, actions, omsgs);
 
@@ -830,11 +879,131 @@ void FronctocolsManager<
 
     if (awaited.peers.checkAllComplete()) {
       log_time_update(awaited.timer, "freed after awaited");
-      this->fronctocols.erase(awaited.id);
+      this->eraseFronctocol(awaited.id);
     }
   }
 }
 
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+void FronctocolsManager<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::
+    handleComputeAction(
+        FronctocolHandler<
+            Identity_T,
+            PeerSet_T,
+            IncomingMessage_T,
+            OutgoingMessage_T> & handler,
+        ComputeAction<
+            Identity_T,
+            PeerSet_T,
+            IncomingMessage_T,
+            OutgoingMessage_T> & action,
+        ::std::vector<::std::unique_ptr<OutgoingMessage_T>> * omsgs) {
+  /* Step 1. Without an offloader, run the task and resume now. */
+  if (!this->offloader) {
+    action.task();
+    this->resumeCompute(handler, action.then, omsgs);
+    return;
+  }
+
+  /* Step 2. Otherwise keep the continuation until the task is done. */
+  size_t const compute_id = this->numOffloaded++;
+  PendingCompute pending;
+  pending.id = handler.id;
+  pending.fronctocol = handler.implementation.get();
+  pending.then = ::std::move(action.then);
+  this->pendingComputes.emplace(compute_id, ::std::move(pending));
+
+  log_time_update(handler.timer, "offloaded compute");
+  this->offloader(::std::move(action.task), compute_id);
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+void FronctocolsManager<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::
+    handleComputed(
+        size_t const computeId,
+        ::std::vector<::std::unique_ptr<OutgoingMessage_T>> * omsgs) {
+  typename ::std::map<size_t, PendingCompute>::iterator finder =
+      this->pendingComputes.find(computeId);
+  if (finder == this->pendingComputes.end()) {
+    log_warn("Cannot resume non-existant compute %zu", computeId);
+    return;
+  }
+  PendingCompute pending = ::std::move(finder->second);
+  this->pendingComputes.erase(finder);
+
+  if (this->isAborted()) {
+    return;
+  }
+
+  /* The fronctocol's ID may have been reused, if it completed. */
+  FronctocolHandler<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T> * handler = this->findFronctocol(pending.id);
+  if (handler == nullptr ||
+      handler->implementation.get() != pending.fronctocol ||
+      handler->completed) {
+    log_warn(
+        "Dropping compute %zu of a completed fronctocol", computeId);
+    return;
+  }
+
+  this->resumeCompute(*handler, pending.then, omsgs);
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+void FronctocolsManager<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::
+    resumeCompute(
+        FronctocolHandler<
+            Identity_T,
+            PeerSet_T,
+            IncomingMessage_T,
+            OutgoingMessage_T> & handler,
+        ::std::function<void()> const & then,
+        ::std::vector<::std::unique_ptr<OutgoingMessage_T>> * omsgs) {
+  ::std::vector<::std::unique_ptr<Action<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T>>>
+      actions;
+  log_time_update(handler.timer, "handle computed start");
+  {
+    Profiler::Scope scope(
+        this->profiler,
+        handler.profileInstance,
+        Profiler::SpanKind::compute);
+    handler.handleComputed(then, &actions);
+  }
+  log_time_update(handler.timer, "handle computed end");
+  this->handleActions(handler, actions, omsgs);
+}
+
 template<
     typename Identity_T,
     typename PeerSet_T,
@@ -847,16 +1016,13 @@ void FronctocolsManager<
     OutgoingMessage_T>::
     handleAbort(
         ::std::vector<::std::unique_ptr<OutgoingMessage_T>> * omsgs) {
-  typename ::std::unordered_map<
-      fronctocolId_t,
-      ::std::unique_ptr<FronctocolHandler<
-          Identity_T,
-          PeerSet_T,
-          IncomingMessage_T,
-          OutgoingMessage_T>>>::iterator finder =
-      this->fronctocols.find(0);
-  if (finder != this->fronctocols.end()) {
-    finder->second->peers.forEach(
+  FronctocolHandler<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T> * finder = this->findFronctocol(MAIN_ID);
+  if (finder != nullptr) {
+    finder->peers.visit(
         [&](Identity_T const & peer, fronctocolId_t &, bool &) {
           if (peer == this->self) {
             return;
@@ -896,7 +1062,7 @@ bool FronctocolsManager<
     PeerSet_T,
     IncomingMessage_T,
     OutgoingMessage_T>::isClosed() const {
-  return this->finished && this->fronctocols.size() == 0;
+  return this->finished && this->numLiveFronctocols == 0;
 }
 
 template<
@@ -922,5 +1088,174 @@ size_t FronctocolsManager<
     PeerSet_T,
     IncomingMessage_T,
     OutgoingMessage_T>::getNumFronctocols() const {
-  return this->fronctocolIdGenerator;
+  return this->fronctocolCount;
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+size_t FronctocolsManager<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::getNumLiveFronctocols() const {
+  return this->numLiveFronctocols;
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+void FronctocolsManager<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::setProfiler(Profiler * p) {
+  this->profiler = p;
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+void FronctocolsManager<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::setOffloader(Offloader_T o) {
+  this->offloader = ::std::move(o);
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+size_t FronctocolsManager<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::getNumOffloaded() const {
+  return this->numOffloaded;
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+::std::unique_ptr<FronctocolHandler<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>>
+FronctocolsManager<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::newHandler(PeerSet_T const & peers) {
+  ::std::unique_ptr<FronctocolHandler<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T>>
+      handler = this->handlerPool.take(this->self, *this->pools);
+  handler->reset(peers);
+  return handler;
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+fronctocolId_t FronctocolsManager<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::reserveId() {
+  if (this->freeIds.empty()) {
+    this->fronctocols.emplace_back(nullptr);
+    return (fronctocolId_t)(this->fronctocols.size() - 1);
+  }
+
+  fronctocolId_t id = this->freeIds.back();
+  this->freeIds.pop_back();
+  return id;
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+void FronctocolsManager<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::
+    emplaceFronctocol(::std::unique_ptr<FronctocolHandler<
+                          Identity_T,
+                          PeerSet_T,
+                          IncomingMessage_T,
+                          OutgoingMessage_T>> handler) {
+  log_assert(handler->id < this->fronctocols.size());
+  log_assert(this->fronctocols[handler->id] == nullptr);
+  this->numLiveFronctocols++;
+  this->fronctocols[handler->id] = ::std::move(handler);
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+FronctocolHandler<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T> *
+FronctocolsManager<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::findFronctocol(fronctocolId_t const id) {
+  if (id >= this->fronctocols.size()) {
+    return nullptr;
+  }
+  return this->fronctocols[id].get();
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+void FronctocolsManager<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::eraseFronctocol(fronctocolId_t const id) {
+  log_assert(this->findFronctocol(id) != nullptr);
+  ::std::unique_ptr<FronctocolHandler<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T>>
+      handler = ::std::move(this->fronctocols[id]);
+  this->numLiveFronctocols--;
+
+  /* Main's ID is never reused, since it is the root of the protocol. */
+  if (id != MAIN_ID) {
+    this->freeIds.push_back(id);
+  }
+
+  /* Release the fronctocol itself now, but keep the handler's storage. */
+  handler->implementation = nullptr;
+  handler->incomingMessageCaches.clear();
+  this->handlerPool.give(::std::move(handler));
 }
@@ -108,6 +108,13 @@ public:
    */
   virtual void clear() = 0;
 
+  /**
+   * Hints that at least nchars more bytes will be added to the message,
+   * so that an implementation may allocate once. By default, nothing.
+   */
+  virtual void reserve(size_t const) {
+  }
+
   /**
    * Writes a value of the given type to this message.
    *
@@ -10,6 +10,7 @@
 /* C++ Headers */
 #include <cstdint>
 #include <functional>
+#include <utility>
 
 /* 3rd Party Headers */
 
@@ -57,6 +58,25 @@ struct PeerSet {
   virtual void
       forEach(::std::function<void(Identity_T const &)>) const = 0;
 
+  /**
+   * Template visitors equivalent to the two forEach methods. Fortissimo
+   * calls these on its concrete PeerSet_T, so an implementation may
+   * hide them with non-virtual versions to avoid the ::std::function
+   * indirection. These defaults forward to forEach.
+   */
+  template<typename F>
+  void visit(F && f) {
+    using Visitor_T = ::std::function<void(
+        Identity_T const &, fronctocolId_t &, bool &)>;
+    this->forEach(Visitor_T(::std::forward<F>(f)));
+  }
+
+  template<typename F>
+  void visitIdentities(F && f) const {
+    this->forEach(::std::function<void(Identity_T const &)>(
+        ::std::forward<F>(f)));
+  }
+
   /**
    * Add or remove a peer to this PeerSet.
    * Only use these before a corresponding fronctocol has been invoked.
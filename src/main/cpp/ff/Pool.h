@@ -0,0 +1,97 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+#ifndef FF_POOL_H_
+#define FF_POOL_H_
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+
+namespace ff {
+
+/**
+ * A free list of heap objects, so that frequently created and destroyed
+ * objects may be recycled rather than reallocated. Recycled objects are
+ * returned as-is, and the caller is responsible for resetting them.
+ *
+ * Pools are not thread safe, and are intended to be owned by a single
+ * FronctocolsManager (or fronctocol).
+ */
+template<typename T>
+class Pool {
+private:
+  ::std::vector<::std::unique_ptr<T>> freeList;
+
+public:
+  Pool() = default;
+  Pool(Pool const &) = delete;
+  Pool & operator=(Pool const &) = delete;
+  Pool(Pool &&) = default;
+  Pool & operator=(Pool &&) = default;
+
+  /**
+   * Takes a recycled object from the pool, or constructs a new one
+   * from the given arguments if the pool is empty.
+   */
+  template<typename... Args_T>
+  ::std::unique_ptr<T> take(Args_T &&... args);
+
+  /**
+   * Returns an object to the pool for later reuse.
+   */
+  void give(::std::unique_ptr<T> obj);
+
+  /**
+   * The number of objects waiting for reuse.
+   */
+  size_t size() const;
+};
+
+/**
+ * One Pool for each type of object, created on first use. Every
+ * FronctocolsManager owns one, which its fronctocols reach through
+ * Fronctocol::getPool, so that objects given back by one fronctocol
+ * may be taken by another.
+ */
+class Pools {
+private:
+  struct AnyPool {
+    virtual ~AnyPool() = default;
+  };
+
+  template<typename T>
+  struct TypedPool : public AnyPool {
+    Pool<T> pool;
+  };
+
+  ::std::map<::std::type_index, ::std::unique_ptr<AnyPool>> pools;
+
+public:
+  Pools() = default;
+  Pools(Pools const &) = delete;
+  Pools & operator=(Pools const &) = delete;
+
+  /**
+   * The Pool of objects of type T.
+   */
+  template<typename T>
+  Pool<T> & get();
+};
+
+#include <ff/Pool.t.h>
+
+} // namespace ff
+
+#endif // FF_POOL_H_
@@ -0,0 +1,36 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+template<typename T>
+template<typename... Args_T>
+::std::unique_ptr<T> Pool<T>::take(Args_T &&... args) {
+  if (this->freeList.empty()) {
+    return ::std::unique_ptr<T>(new T(::std::forward<Args_T>(args)...));
+  }
+
+  ::std::unique_ptr<T> ret = ::std::move(this->freeList.back());
+  this->freeList.pop_back();
+  return ret;
+}
+
+template<typename T>
+void Pool<T>::give(::std::unique_ptr<T> obj) {
+  if (obj != nullptr) {
+    this->freeList.push_back(::std::move(obj));
+  }
+}
+
+template<typename T>
+size_t Pool<T>::size() const {
+  return this->freeList.size();
+}
+
+template<typename T>
+Pool<T> & Pools::get() {
+  ::std::unique_ptr<AnyPool> & any = this->pools[typeid(T)];
+  if (any == nullptr) {
+    any.reset(new TypedPool<T>());
+  }
+  return static_cast<TypedPool<T> &>(*any).pool;
+}
@@ -0,0 +1,259 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+#include <cinttypes>
+#include <cstdio>
+#include <time.h>
+
+/* C++ Headers */
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <ff/Profiler.h>
+
+namespace ff {
+
+size_t constexpr Profiler::NONE;
+
+static uint64_t wallNow() {
+  ::std::chrono::nanoseconds const now =
+      ::std::chrono::duration_cast<::std::chrono::nanoseconds>(
+          ::std::chrono::steady_clock::now().time_since_epoch());
+  return (uint64_t)now.count();
+}
+
+static uint64_t cpuNow() {
+  struct timespec ts;
+  if (0 != clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts)) {
+    return 0;
+  }
+  return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+static char const * kindName(Profiler::SpanKind const kind) {
+  switch (kind) {
+    case Profiler::SpanKind::init:
+      return "init";
+    case Profiler::SpanKind::receive:
+      return "receive";
+    case Profiler::SpanKind::complete:
+      return "complete";
+    case Profiler::SpanKind::promise:
+      return "promise";
+    case Profiler::SpanKind::compute:
+      return "compute";
+  }
+  return "unknown";
+}
+
+/* Escapes a string for use inside a JSON string literal. */
+static ::std::string jsonEscape(::std::string const & str) {
+  ::std::string out;
+  out.reserve(str.size());
+  for (char const c : str) {
+    if (c == '"' || c == '\\') {
+      out.push_back('\\');
+      out.push_back(c);
+    } else if ((unsigned char)c < 0x20) {
+      char buf[8];
+      snprintf(buf, sizeof(buf), "\\u%04x", (unsigned)c);
+      out += buf;
+    } else {
+      out.push_back(c);
+    }
+  }
+  return out;
+}
+
+Profiler::Scope::Scope(
+    Profiler * p, size_t const instance, SpanKind const kind) :
+    profiler(p),
+    instance(instance),
+    kind(kind),
+    start(p == nullptr ? 0 : wallNow()),
+    cpuStart(p == nullptr ? 0 : cpuNow()) {
+}
+
+Profiler::Scope::~Scope() {
+  if (this->profiler == nullptr) {
+    return;
+  }
+  uint64_t const cpu = cpuNow();
+  uint64_t const wall = wallNow();
+  this->profiler->spans.push_back(Span{
+      this->instance,
+      this->kind,
+      this->start,
+      wall - this->start,
+      cpu - this->cpuStart});
+}
+
+Profiler::Profiler(::std::string const & p) : participant(p) {
+}
+
+::std::string const & Profiler::getParticipant() const {
+  return this->participant;
+}
+
+size_t
+Profiler::addInstance(::std::string const & name, size_t const parent) {
+  Instance instance;
+  instance.name = name;
+  instance.parent = parent;
+  this->instances.push_back(::std::move(instance));
+  return this->instances.size() - 1;
+}
+
+void Profiler::recordSend(size_t const instance, size_t const bytes) {
+  if (instance >= this->instances.size()) {
+    return;
+  }
+  this->instances[instance].messages++;
+  this->instances[instance].bytes += bytes;
+}
+
+::std::vector<Profiler::Instance> const &
+Profiler::getInstances() const {
+  return this->instances;
+}
+
+::std::vector<Profiler::Span> const & Profiler::getSpans() const {
+  return this->spans;
+}
+
+::std::map<::std::string, Profiler::Totals> Profiler::byName() const {
+  ::std::map<::std::string, Totals> totals;
+  for (Instance const & instance : this->instances) {
+    Totals & t = totals[instance.name];
+    t.instances++;
+    t.messages += instance.messages;
+    t.bytes += instance.bytes;
+  }
+  for (Span const & span : this->spans) {
+    Totals & t = totals[this->instances[span.instance].name];
+    t.spans++;
+    t.wallTime += span.wallTime;
+    t.cpuTime += span.cpuTime;
+  }
+  return totals;
+}
+
+Profiler::Totals Profiler::subtree(size_t const root) const {
+  // Instances are added after their parents, so a single pass in order
+  // finds every descendant.
+  ::std::vector<bool> inside(this->instances.size(), false);
+  Totals totals;
+  for (size_t i = root; i < this->instances.size(); i++) {
+    Instance const & instance = this->instances[i];
+    inside[i] = i == root ||
+        (instance.parent != NONE && instance.parent >= root &&
+         inside[instance.parent]);
+    if (inside[i]) {
+      totals.instances++;
+      totals.messages += instance.messages;
+      totals.bytes += instance.bytes;
+    }
+  }
+  for (Span const & span : this->spans) {
+    if (span.instance < inside.size() && inside[span.instance]) {
+      totals.spans++;
+      totals.wallTime += span.wallTime;
+      totals.cpuTime += span.cpuTime;
+    }
+  }
+  return totals;
+}
+
+void Profiler::writeSummary(FILE * out) const {
+  ::std::map<::std::string, Totals> const totals = this->byName();
+  ::std::vector<::std::pair<::std::string, Totals>> rows(
+      totals.begin(), totals.end());
+  ::std::sort(
+      rows.begin(),
+      rows.end(),
+      [](::std::pair<::std::string, Totals> const & a,
+         ::std::pair<::std::string, Totals> const & b) {
+        return a.second.wallTime > b.second.wallTime;
+      });
+
+  fprintf(
+      out,
+      "Profile of %s\n%-32s %9s %9s %12s %12s %9s %12s\n",
+      this->participant.c_str(),
+      "fronctocol",
+      "instances",
+      "spans",
+      "wall ms",
+      "cpu ms",
+      "messages",
+      "bytes");
+  for (::std::pair<::std::string, Totals> const & row : rows) {
+    fprintf(
+        out,
+        "%-32s %9zu %9zu %12.3f %12.3f %9zu %12zu\n",
+        row.first.c_str(),
+        row.second.instances,
+        row.second.spans,
+        (double)row.second.wallTime / 1e6,
+        (double)row.second.cpuTime / 1e6,
+        row.second.messages,
+        row.second.bytes);
+  }
+}
+
+bool Profiler::writeChromeTrace(
+    FILE * out, ::std::vector<Profiler const *> const & profilers) {
+  bool first = true;
+  auto separator = [&]() -> char const * {
+    char const * sep = first ? "\n" : ",\n";
+    first = false;
+    return sep;
+  };
+
+  if (fprintf(out, "{\"traceEvents\": [") < 0) {
+    return false;
+  }
+  for (size_t pid = 0; pid < profilers.size(); pid++) {
+    Profiler const & profiler = *profilers[pid];
+    fprintf(
+        out,
+        "%s{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %zu, "
+        "\"tid\": 0, \"args\": {\"name\": \"%s\"}}",
+        separator(),
+        pid,
+        jsonEscape(profiler.participant).c_str());
+
+    for (Span const & span : profiler.spans) {
+      Instance const & instance = profiler.instances[span.instance];
+      int64_t const parent =
+          instance.parent == NONE ? -1 : (int64_t)instance.parent;
+      fprintf(
+          out,
+          "%s{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", "
+          "\"pid\": %zu, \"tid\": 0, \"ts\": %.3f, \"dur\": %.3f, "
+          "\"args\": {\"instance\": %zu, \"parent\": %" PRId64 ", "
+          "\"cpu_us\": %.3f}}",
+          separator(),
+          jsonEscape(instance.name).c_str(),
+          kindName(span.kind),
+          pid,
+          (double)span.start / 1e3,
+          (double)span.wallTime / 1e3,
+          span.instance,
+          parent,
+          (double)span.cpuTime / 1e3);
+    }
+  }
+  return fprintf(out, "\n]}\n") >= 0 && 0 == fflush(out);
+}
+
+} // namespace ff
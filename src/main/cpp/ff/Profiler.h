@@ -0,0 +1,142 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+#ifndef FF_PROFILER_H_
+#define FF_PROFILER_H_
+
+/* C and POSIX Headers */
+#include <cstdio>
+
+/* C++ Headers */
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+
+namespace ff {
+
+/**
+ * Records where one participant's FronctocolsManager spends its time.
+ *
+ * Each fronctocol the manager runs becomes an instance, identified by
+ * its order of invocation (unlike fronctocol IDs, instance numbers are
+ * never reused). Each call into one of its init, handleReceive,
+ * handleComplete or handlePromise methods, or into the continuation of
+ * a compute, is recorded as a span with its wall clock and thread CPU
+ * time. Compute tasks which are offloaded to other threads are not
+ * recorded. Messages are attributed to the instance which sent them,
+ * including the framework's sync and complete messages.
+ *
+ * A Profiler is attached to a FronctocolsManager with setProfiler, and
+ * is not thread safe.
+ */
+class Profiler {
+public:
+  enum class SpanKind : uint8_t {
+    init,
+    receive,
+    complete,
+    promise,
+    compute
+  };
+
+  static size_t constexpr NONE = SIZE_MAX;
+
+  struct Instance {
+    ::std::string name;
+    size_t parent;
+    size_t messages = 0;
+    size_t bytes = 0;
+  };
+
+  struct Span {
+    size_t instance;
+    SpanKind kind;
+
+    /* Nanoseconds of the steady clock. */
+    uint64_t start;
+    uint64_t wallTime;
+    uint64_t cpuTime;
+  };
+
+  struct Totals {
+    size_t instances = 0;
+    size_t spans = 0;
+    size_t messages = 0;
+    size_t bytes = 0;
+    uint64_t wallTime = 0;
+    uint64_t cpuTime = 0;
+  };
+
+  /**
+   * Records a span for its lifetime. A null profiler records nothing.
+   */
+  class Scope {
+  private:
+    Profiler * const profiler;
+    size_t const instance;
+    SpanKind const kind;
+    uint64_t const start;
+    uint64_t const cpuStart;
+
+  public:
+    Scope(Profiler * p, size_t const instance, SpanKind const kind);
+    Scope(Scope const &) = delete;
+    Scope & operator=(Scope const &) = delete;
+    ~Scope();
+  };
+
+  explicit Profiler(::std::string const & participant);
+
+  ::std::string const & getParticipant() const;
+
+  /**
+   * Adds an instance of a fronctocol and returns its number. The main
+   * fronctocol has parent NONE.
+   */
+  size_t addInstance(::std::string const & name, size_t const parent);
+
+  void recordSend(size_t const instance, size_t const bytes);
+
+  ::std::vector<Instance> const & getInstances() const;
+  ::std::vector<Span> const & getSpans() const;
+
+  /**
+   * Totals of the spans and messages of all instances with each name.
+   */
+  ::std::map<::std::string, Totals> byName() const;
+
+  /**
+   * Totals of the spans and messages of an instance and all of its
+   * descendants.
+   */
+  Totals subtree(size_t const instance) const;
+
+  /**
+   * Prints a table of byName, in decreasing order of wall time.
+   */
+  void writeSummary(FILE * out) const;
+
+  /**
+   * Writes the spans of all profilers as Chrome trace_event JSON, for
+   * chrome://tracing or Perfetto. Each participant is shown as its own
+   * process. Returns false if writing fails.
+   */
+  static bool writeChromeTrace(
+      FILE * out, ::std::vector<Profiler const *> const & profilers);
+
+private:
+  ::std::string participant;
+  ::std::vector<Instance> instances;
+  ::std::vector<Span> spans;
+};
+
+} // namespace ff
+
+#endif // FF_PROFILER_H_
@@ -8,8 +8,11 @@
 /* C and POSIX Headers */
 
 /* C++ Headers */
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <utility>
+#include <vector>
 
 /* 3rd Party Headers */
 
@@ -147,6 +150,143 @@ template<
   }
 }
 
+/**
+ * A PromiseJoin awaits several promises together, for a fronctocol
+ * which needs all of their results before it can continue. Every
+ * promise is issued and awaited as soon as it is added, so the promised
+ * fronctocols run concurrently rather than one after another.
+ *
+ * The awaiting fronctocol passes each ``handlePromise`` to ``collect``,
+ * which moves the matching result to the destination given to ``add``.
+ */
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+class PromiseJoin {
+public:
+  /**
+   * Promises ``pf`` from ``awaiter`` and awaits it. Its result is
+   * written to ``destination`` when it arrives.
+   */
+  template<typename Result_T>
+  void add(
+      Fronctocol<
+          Identity_T,
+          PeerSet_T,
+          IncomingMessage_T,
+          OutgoingMessage_T> & awaiter,
+      ::std::unique_ptr<PromiseFronctocol<
+          Identity_T,
+          PeerSet_T,
+          IncomingMessage_T,
+          OutgoingMessage_T,
+          Result_T>> pf,
+      PeerSet_T const & peers,
+      ::std::unique_ptr<Result_T> * destination);
+
+  /**
+   * Takes the result of ``f`` if it is one of the joined promises.
+   * Returns false if ``f`` does not belong to this join.
+   */
+  bool collect(Fronctocol<
+               Identity_T,
+               PeerSet_T,
+               IncomingMessage_T,
+               OutgoingMessage_T> & f);
+
+  /**
+   * The number of promises which have not completed yet.
+   */
+  size_t remaining() const {
+    return this->pending.size();
+  }
+
+  /**
+   * True once every joined promise has completed.
+   */
+  bool done() const {
+    return this->pending.empty();
+  }
+
+private:
+  using Awaiter_T = Fronctocol<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T>;
+
+  ::std::vector<::std::function<bool(Awaiter_T &)>> pending;
+};
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+template<typename Result_T>
+void PromiseJoin<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::
+    add(Fronctocol<
+            Identity_T,
+            PeerSet_T,
+            IncomingMessage_T,
+            OutgoingMessage_T> & awaiter,
+        ::std::unique_ptr<PromiseFronctocol<
+            Identity_T,
+            PeerSet_T,
+            IncomingMessage_T,
+            OutgoingMessage_T,
+            Result_T>> pf,
+        PeerSet_T const & peers,
+        ::std::unique_ptr<Result_T> * destination) {
+  ::std::shared_ptr<Promise<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T,
+      Result_T>>
+      promise(awaiter.promise(::std::move(pf), peers));
+  awaiter.await(*promise);
+
+  this->pending.emplace_back([promise, destination](Awaiter_T & f) {
+    ::std::unique_ptr<Result_T> result = promise->getResult(f);
+    if (result == nullptr) {
+      return false;
+    }
+    *destination = ::std::move(result);
+    return true;
+  });
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+bool PromiseJoin<
+    Identity_T,
+    PeerSet_T,
+    IncomingMessage_T,
+    OutgoingMessage_T>::
+    collect(Fronctocol<
+            Identity_T,
+            PeerSet_T,
+            IncomingMessage_T,
+            OutgoingMessage_T> & f) {
+  for (size_t i = 0; i < this->pending.size(); i++) {
+    if (this->pending[i](f)) {
+      this->pending.erase(this->pending.begin() + (ssize_t)i);
+      return true;
+    }
+  }
+  return false;
+}
+
 } // namespace ff
 
 #endif // FF_PROMISE_H_
@@ -8,6 +8,7 @@
 /* C and POSIX Headers */
 
 /* C++ Headers */
+#include <algorithm>
 #include <cstdint>
 #include <functional>
 #include <vector>
@@ -33,16 +34,23 @@ private:
     bool completion;
 
     Peer(Identity_T const & p, fronctocolId_t i, bool c);
-    Peer(Peer const & other);
+    Peer(Peer const &) = default;
     Peer & operator=(Peer const &) = default;
 
     bool operator==(Peer const & other) const;
     bool operator<(Peer const & other) const;
   };
 
+  /* Kept sorted by identity, so lookups are a binary search. */
   ::std::vector<Peer> peers;
 
+  /* Number of peers with a valid fronctocol ID, and with completion
+   * status set, so that hasAllPeerIds and checkAllComplete are O(1). */
+  size_t numIds = 0;
+  size_t numCompleted = 0;
+
   Peer * find(Identity_T const & peerId);
+  void recount();
 
 public:
   VectorPeerSet() = default;
@@ -53,7 +61,8 @@ public:
    */
   VectorPeerSet(VectorPeerSet const & other);
 
-  VectorPeerSet & operator=(VectorPeerSet const &) = default;
+  /** Assignment also ignores fronctocolIds and completion status. */
+  VectorPeerSet & operator=(VectorPeerSet const & other);
 
   /* Framework required for each */
   void forEach(
@@ -64,6 +73,12 @@ public:
   void
   forEach(::std::function<void(Identity_T const &)> f) const override;
 
+  /* Non-virtual template versions of the above, hiding PeerSet's. */
+  template<typename F>
+  void visit(F && f);
+  template<typename F>
+  void visitIdentities(F && f) const;
+
   /** Equality depends on sort, and checks only for Identity's equality */
   bool operator==(VectorPeerSet<Identity_T> const & other) const;
 
@@ -74,6 +89,8 @@ public:
   checkAndSetId(Identity_T const & p, fronctocolId_t const i) override;
   void setId(Identity_T const & peer, fronctocolId_t const id) override;
   void setCompleted(Identity_T const & peer) override;
+  bool hasAllPeerIds() override;
+  bool checkAllComplete() override;
   fronctocolId_t findPeerId(Identity_T const & peer) override;
   bool findCompletionStatus(Identity_T const & peer) override;
   bool hasPeer(Identity_T const & peer) override;
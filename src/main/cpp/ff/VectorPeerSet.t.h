@@ -8,11 +8,6 @@ VectorPeerSet<Identity_T>::Peer ::Peer(
     peer(p), id(i), completion(c) {
 }
 
-template<typename Identity_T>
-VectorPeerSet<Identity_T>::Peer ::Peer(Peer const & other) :
-    peer(other.peer), id(FRONCTOCOLID_INVALID), completion(false) {
-}
-
 template<typename Identity_T>
 bool VectorPeerSet<Identity_T>::Peer ::operator==(
     Peer const & other) const {
@@ -27,31 +22,73 @@ bool VectorPeerSet<Identity_T>::Peer ::operator<(
 
 template<typename Identity_T>
 VectorPeerSet<Identity_T>::VectorPeerSet(VectorPeerSet const & other) :
-    PeerSet<Identity_T>(other), peers(other.peers) {
-  std::sort(this->peers.begin(), this->peers.end());
+    PeerSet<Identity_T>(other) {
+  *this = other;
+}
+
+template<typename Identity_T>
+VectorPeerSet<Identity_T> &
+VectorPeerSet<Identity_T>::operator=(VectorPeerSet const & other) {
+  if (this != &other) {
+    this->peers.clear();
+    this->peers.reserve(other.peers.size());
+    for (size_t i = 0; i < other.peers.size(); i++) {
+      this->peers.emplace_back(
+          other.peers[i].peer, FRONCTOCOLID_INVALID, false);
+    }
+    std::sort(this->peers.begin(), this->peers.end());
+    this->numIds = 0;
+    this->numCompleted = 0;
+  }
+  return *this;
 }
 
 template<typename Identity_T>
 void VectorPeerSet<Identity_T>::forEach(
     ::std::function<void(Identity_T const &, fronctocolId_t &, bool &)>
         f) {
+  this->visit(f);
+}
+
+template<typename Identity_T>
+void VectorPeerSet<Identity_T>::forEach(
+    ::std::function<void(Identity_T const &)> f) const {
+  this->visitIdentities(f);
+}
+
+template<typename Identity_T>
+template<typename F>
+void VectorPeerSet<Identity_T>::visit(F && f) {
   for (size_t i = 0; i < this->peers.size(); i++) {
-    fronctocolId_t prev = this->peers[i].id;
-    f(this->peers[i].peer,
-      this->peers[i].id,
-      this->peers[i].completion);
+    Peer & p = this->peers[i];
+    fronctocolId_t const prev = p.id;
+    bool const prev_completion = p.completion;
+    f(static_cast<Identity_T const &>(p.peer), p.id, p.completion);
 
     if_debug if (
-        prev != FRONCTOCOLID_INVALID &&
-        this->peers[i].id == FRONCTOCOLID_INVALID) {
+        prev != FRONCTOCOLID_INVALID && p.id == FRONCTOCOLID_INVALID) {
       log_fatal("id was valid and is not anymore");
     }
+
+    if (prev == FRONCTOCOLID_INVALID && p.id != FRONCTOCOLID_INVALID) {
+      this->numIds++;
+    } else if (
+        prev != FRONCTOCOLID_INVALID && p.id == FRONCTOCOLID_INVALID) {
+      this->numIds--;
+    }
+    if (prev_completion != p.completion) {
+      if (p.completion) {
+        this->numCompleted++;
+      } else {
+        this->numCompleted--;
+      }
+    }
   }
 }
 
 template<typename Identity_T>
-void VectorPeerSet<Identity_T>::forEach(
-    ::std::function<void(Identity_T const &)> f) const {
+template<typename F>
+void VectorPeerSet<Identity_T>::visitIdentities(F && f) const {
   for (size_t i = 0; i < this->peers.size(); i++) {
     f(this->peers[i].peer);
   }
@@ -75,35 +112,33 @@ bool VectorPeerSet<Identity_T>::operator==(
 
 template<typename Identity_T>
 void VectorPeerSet<Identity_T>::add(Identity_T const & peer) {
-  this->peers.emplace_back(peer, FRONCTOCOLID_INVALID, false);
+  // Insert in sorted position, so that find may always binary search.
+  Peer const p(peer, FRONCTOCOLID_INVALID, false);
+  this->peers.insert(
+      std::upper_bound(this->peers.begin(), this->peers.end(), p), p);
 }
 
 template<typename Identity_T>
 void VectorPeerSet<Identity_T>::remove(Identity_T const & peer) {
-  // linear search, because this may not yet have been ordered as peers
-  // are being added/removed.
-  size_t idx = SIZE_MAX;
-  size_t cnt = 0;
-  this->forEach([&](Identity_T const & i_peer) {
-    if (i_peer == peer) {
-      idx = cnt;
-    }
-    cnt++;
-  });
-  this->peers.erase(this->peers.begin() + (ssize_t)idx);
+  Peer * p = this->find(peer);
+  if (p != nullptr) {
+    this->peers.erase(this->peers.begin() + (p - this->peers.data()));
+    this->recount();
+  }
 }
 
 template<typename Identity_T>
 bool VectorPeerSet<Identity_T>::checkAndSetId(
     Identity_T const & peer, fronctocolId_t const id) {
   Peer * p = this->find(peer);
-  if (p == nullptr) {
+  if (p == nullptr || p->id != FRONCTOCOLID_INVALID) {
     return false;
-  } else if (p->peer == peer && p->id == FRONCTOCOLID_INVALID) {
+  } else {
     p->id = id;
+    if (id != FRONCTOCOLID_INVALID) {
+      this->numIds++;
+    }
     return true;
-  } else {
-    return false;
   }
 }
 
@@ -112,6 +147,12 @@ void VectorPeerSet<Identity_T>::setId(
     Identity_T const & peer, fronctocolId_t const id) {
   Peer * p = this->find(peer);
   if (p != nullptr) {
+    if (p->id == FRONCTOCOLID_INVALID && id != FRONCTOCOLID_INVALID) {
+      this->numIds++;
+    } else if (
+        p->id != FRONCTOCOLID_INVALID && id == FRONCTOCOLID_INVALID) {
+      this->numIds--;
+    }
     p->id = id;
   }
 }
@@ -119,11 +160,22 @@ void VectorPeerSet<Identity_T>::setId(
 template<typename Identity_T>
 void VectorPeerSet<Identity_T>::setCompleted(Identity_T const & peer) {
   Peer * p = this->find(peer);
-  if (p != nullptr) {
+  if (p != nullptr && !p->completion) {
     p->completion = true;
+    this->numCompleted++;
   }
 }
 
+template<typename Identity_T>
+bool VectorPeerSet<Identity_T>::hasAllPeerIds() {
+  return this->numIds == this->peers.size();
+}
+
+template<typename Identity_T>
+bool VectorPeerSet<Identity_T>::checkAllComplete() {
+  return this->numCompleted == this->peers.size();
+}
+
 template<typename Identity_T>
 fronctocolId_t
 VectorPeerSet<Identity_T>::findPeerId(Identity_T const & peer) {
@@ -171,6 +223,20 @@ VectorPeerSet<Identity_T>::find(Identity_T const & peerId) {
   return nullptr;
 }
 
+template<typename Identity_T>
+void VectorPeerSet<Identity_T>::recount() {
+  this->numIds = 0;
+  this->numCompleted = 0;
+  for (size_t i = 0; i < this->peers.size(); i++) {
+    if (this->peers[i].id != FRONCTOCOLID_INVALID) {
+      this->numIds++;
+    }
+    if (this->peers[i].completion) {
+      this->numCompleted++;
+    }
+  }
+}
+
 template<typename Identity_T>
 size_t VectorPeerSet<Identity_T>::size() const {
   return this->peers.size();
@@ -203,7 +269,5 @@ bool msg_read(
     ps.add(peer);
   }
 
-  std::sort(ps.peers.begin(), ps.peers.end());
-
   return ret;
 }
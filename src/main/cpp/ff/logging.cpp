@@ -4,6 +4,9 @@
 
 /* C and POSIX headers */
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <strings.h>
 #define _POSIX_THREAD_SAFE_FUNCTIONS
 #include <ctime>
 
@@ -12,7 +15,13 @@
 #endif //__GLIBC__
 
 /* C++ Headers */
+#include <atomic>
 #include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 /* Local headers */
 #include <ff/logging.h>
@@ -31,6 +40,493 @@ void log_time_update_PRIVATE() {
       LOG_TIME_STR_private, LOG_TIME_FMT_LEN, LOG_TIME_FMT, &time_obj);
 }
 
+/* Runtime log level */
+
+::std::atomic<int> LOG_LEVEL_private(LOG_LEVEL_FILE);
+
+void log_set_level(LogLevel const level) {
+  LOG_LEVEL_private.store(level, ::std::memory_order_relaxed);
+}
+
+LogLevel log_get_level() {
+  return static_cast<LogLevel>(
+      LOG_LEVEL_private.load(::std::memory_order_relaxed));
+}
+
+bool log_set_level_name(char const * name) {
+  char const * const names[] = {
+      "trace", "debug", "info", "warn", "error", "fatal"};
+  for (int i = LOG_LEVEL_TRACE; i <= LOG_LEVEL_FATAL; i++) {
+    if (0 == strcasecmp(name, names[i])) {
+      log_set_level(static_cast<LogLevel>(i));
+      return true;
+    }
+  }
+  return false;
+}
+
+/* Applies FF_LOG_LEVEL at startup. */
+static struct LogLevelFromEnv_PRIVATE {
+  LogLevelFromEnv_PRIVATE() {
+    char const * const env = getenv("FF_LOG_LEVEL");
+    if (env != nullptr) {
+      log_set_level_name(env);
+    }
+  }
+} log_level_from_env;
+
+/* Asynchronous logging */
+
+::std::atomic<bool> LOG_ASYNC_private(false);
+
+/**
+ * A single producer, single consumer byte queue. head and tail count
+ * all bytes ever written and read, and are masked to index data.
+ */
+struct LogRing_PRIVATE {
+  ::std::vector<uint8_t> data;
+  size_t const mask;
+  ::std::atomic<size_t> head;
+  ::std::atomic<size_t> tail;
+
+  /* Set when the producing thread exits. */
+  ::std::atomic<bool> closed;
+
+  explicit LogRing_PRIVATE(size_t const capacity) :
+      data(capacity),
+      mask(capacity - 1),
+      head(0),
+      tail(0),
+      closed(false) {
+  }
+
+  size_t capacity() const {
+    return this->data.size();
+  }
+
+  void write(size_t const pos, void const * src, size_t const len) {
+    size_t const start = pos & this->mask;
+    size_t const first = ::std::min(len, this->capacity() - start);
+    memcpy(this->data.data() + start, src, first);
+    memcpy(
+        this->data.data(),
+        static_cast<uint8_t const *>(src) + first,
+        len - first);
+  }
+
+  void read(size_t const pos, void * dst, size_t const len) const {
+    size_t const start = pos & this->mask;
+    size_t const first = ::std::min(len, this->capacity() - start);
+    memcpy(dst, this->data.data() + start, first);
+    memcpy(
+        static_cast<uint8_t *>(dst) + first,
+        this->data.data(),
+        len - first);
+  }
+};
+
+/* All rings, and the background thread's state. */
+static ::std::mutex log_rings_mutex;
+static ::std::vector<::std::shared_ptr<LogRing_PRIVATE>> log_rings;
+static size_t log_ring_bytes = 1 << 20;
+
+/* Held while decoding, so that only one thread consumes at a time. */
+static ::std::mutex log_consumer_mutex;
+static ::std::thread log_consumer;
+static ::std::atomic<bool> log_consumer_running(false);
+
+/**
+ * Closes this thread's ring when the thread exits. The consumer frees
+ * it once it is empty.
+ */
+struct LogRingHolder_PRIVATE {
+  ::std::shared_ptr<LogRing_PRIVATE> ring;
+
+  ~LogRingHolder_PRIVATE() {
+    if (this->ring != nullptr) {
+      this->ring->closed.store(true, ::std::memory_order_release);
+    }
+  }
+};
+
+static thread_local LogRingHolder_PRIVATE log_ring_holder;
+static thread_local ::std::vector<uint8_t> log_record;
+
+void log_async_put_PRIVATE(
+    ::std::vector<uint8_t> & record,
+    void const * data,
+    size_t const len) {
+  uint8_t const * const bytes = static_cast<uint8_t const *>(data);
+  record.insert(record.end(), bytes, bytes + len);
+}
+
+::std::vector<uint8_t> & log_async_begin_PRIVATE(char const * fmt) {
+  ::std::vector<uint8_t> & record = log_record;
+  record.clear();
+
+  /* Space for the length, filled in by commit. */
+  uint32_t const len = 0;
+  log_async_put_PRIVATE(record, &len, sizeof(len));
+  log_async_put_PRIVATE(record, &fmt, sizeof(fmt));
+
+  int64_t const now = static_cast<int64_t>(
+      ::std::chrono::duration_cast<::std::chrono::nanoseconds>(
+          ::std::chrono::system_clock::now().time_since_epoch())
+          .count());
+  log_async_put_PRIVATE(record, &now, sizeof(now));
+  log_async_arg_PRIVATE(record, LOG_ORGANIZATION.c_str());
+  return record;
+}
+
+/**
+ * Reads a record's arguments, and prints them according to its format.
+ */
+class LogDecoder_PRIVATE {
+private:
+  uint8_t const * cur;
+  uint8_t const * const end;
+  ::std::string & out;
+
+  template<typename T>
+  bool take(T & val) {
+    if ((size_t)(this->end - this->cur) < sizeof(T)) {
+      return false;
+    }
+    memcpy(&val, this->cur, sizeof(T));
+    this->cur += sizeof(T);
+    return true;
+  }
+
+  /* Reads the next argument's tag and value. */
+  bool next(
+      uint8_t & tag,
+      int64_t & i,
+      double & d,
+      char const *& str,
+      uint32_t & len,
+      void const *& ptr) {
+    if (!this->take(tag)) {
+      return false;
+    }
+    switch (tag) {
+      case LOG_ARG_SIGNED:
+      case LOG_ARG_UNSIGNED:
+        return this->take(i);
+      case LOG_ARG_DOUBLE:
+        return this->take(d);
+      case LOG_ARG_POINTER:
+        return this->take(ptr);
+      case LOG_ARG_UNKNOWN:
+        return true;
+      case LOG_ARG_STRING:
+        if (!this->take(len) || (size_t)(this->end - this->cur) < len) {
+          return false;
+        }
+        str = reinterpret_cast<char const *>(this->cur);
+        this->cur += len;
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  template<typename... Args_T>
+  void print(::std::string const & spec, Args_T... args) {
+    char buf[128];
+    int const n = snprintf(buf, sizeof(buf), spec.c_str(), args...);
+    if (n < 0) {
+      return;
+    }
+    if ((size_t)n < sizeof(buf)) {
+      this->out.append(buf, (size_t)n);
+    } else {
+      ::std::vector<char> big((size_t)n + 1);
+      snprintf(big.data(), big.size(), spec.c_str(), args...);
+      this->out.append(big.data(), (size_t)n);
+    }
+  }
+
+public:
+  LogDecoder_PRIVATE(
+      uint8_t const * begin, uint8_t const * e, ::std::string & o) :
+      cur(begin), end(e), out(o) {
+  }
+
+  /**
+   * Prints the format, taking arguments for each conversion. The
+   * time string is given separately, as the first %s.
+   */
+  void format(char const * fmt, char const * time_str) {
+    bool first = true;
+    char const * f = fmt;
+    while (*f != '\0') {
+      if (*f != '%') {
+        this->out.push_back(*f++);
+        continue;
+      }
+      if (f[1] == '%') {
+        this->out.push_back('%');
+        f += 2;
+        continue;
+      }
+
+      ::std::string spec("%");
+      f++;
+      while (*f != '\0' && strchr("-+ #0", *f) != nullptr) {
+        spec.push_back(*f++);
+      }
+      bool bad = false;
+      for (int part = 0; part < 2; part++) {
+        if (part == 1) {
+          if (*f != '.') {
+            break;
+          }
+          spec.push_back(*f++);
+        }
+        if (*f == '*') {
+          uint8_t tag;
+          int64_t i = 0;
+          double d;
+          char const * s;
+          uint32_t l;
+          void const * p;
+          bad = bad || !this->next(tag, i, d, s, l, p);
+          spec += ::std::to_string((int)i);
+          f++;
+        }
+        while (*f >= '0' && *f <= '9') {
+          spec.push_back(*f++);
+        }
+      }
+
+      /* Length modifiers are replaced, since integers are widened. */
+      int shorten = 0;
+      while (*f != '\0' && strchr("hlLqjzt", *f) != nullptr) {
+        if (*f == 'h') {
+          shorten++;
+        }
+        f++;
+      }
+      char const conv = *f;
+      if (conv == '\0') {
+        break;
+      }
+      f++;
+
+      if (first && conv == 's') {
+        first = false;
+        this->print(spec + "s", time_str);
+        continue;
+      }
+      first = false;
+
+      uint8_t tag = 0;
+      int64_t i = 0;
+      double d = 0.0;
+      char const * s = nullptr;
+      uint32_t len = 0;
+      void const * p = nullptr;
+      if (bad || !this->next(tag, i, d, s, len, p)) {
+        this->out += "<?>";
+        continue;
+      }
+
+      if (strchr("di", conv) != nullptr && tag != LOG_ARG_DOUBLE) {
+        long long v = (long long)i;
+        v = shorten == 2 ? (signed char)v : shorten == 1 ? (short)v : v;
+        this->print(spec + "ll" + conv, v);
+      } else if (
+          strchr("uoxXc", conv) != nullptr && tag != LOG_ARG_DOUBLE) {
+        unsigned long long v = (unsigned long long)i;
+        v = shorten == 2 ? (unsigned char)v :
+            shorten == 1 ? (unsigned short)v :
+                           v;
+        if (conv == 'c') {
+          this->print(spec + conv, (int)v);
+        } else {
+          this->print(spec + "ll" + conv, v);
+        }
+      } else if (
+          strchr("fFeEgGaA", conv) != nullptr &&
+          tag == LOG_ARG_DOUBLE) {
+        this->print(spec + conv, d);
+      } else if (conv == 's' && tag == LOG_ARG_STRING) {
+        this->print(spec + ".*s", (int)len, s);
+      } else if (conv == 'p' && tag == LOG_ARG_POINTER) {
+        this->print(spec + conv, p);
+      } else {
+        this->out += "<?>";
+      }
+    }
+  }
+};
+
+/**
+ * Formats one record, starting after its length.
+ */
+static void log_decode(
+    uint8_t const * begin, uint8_t const * end, ::std::string & out) {
+  char const * fmt;
+  int64_t now;
+  if ((size_t)(end - begin) < sizeof(fmt) + sizeof(now)) {
+    return;
+  }
+  memcpy(&fmt, begin, sizeof(fmt));
+  memcpy(&now, begin + sizeof(fmt), sizeof(now));
+
+  time_t const secs = (time_t)(now / 1000000000);
+  tm time_obj;
+  localtime_r(&secs, &time_obj);
+  char time_str[LOG_TIME_FMT_LEN];
+  strftime(time_str, LOG_TIME_FMT_LEN, LOG_TIME_FMT, &time_obj);
+
+  LogDecoder_PRIVATE decoder(
+      begin + sizeof(fmt) + sizeof(now), end, out);
+  decoder.format(fmt, time_str);
+}
+
+/**
+ * Writes everything in every ring. The consumer mutex must be held.
+ */
+static bool log_drain() {
+  ::std::vector<::std::shared_ptr<LogRing_PRIVATE>> rings;
+  {
+    ::std::lock_guard<::std::mutex> lock(log_rings_mutex);
+    rings = log_rings;
+  }
+
+  ::std::string out;
+  ::std::vector<uint8_t> record;
+  bool any = false;
+  for (::std::shared_ptr<LogRing_PRIVATE> const & ring : rings) {
+    size_t tail = ring->tail.load(::std::memory_order_relaxed);
+    size_t const head = ring->head.load(::std::memory_order_acquire);
+    while (tail != head) {
+      uint32_t len;
+      ring->read(tail, &len, sizeof(len));
+      record.resize(len);
+      ring->read(tail + sizeof(len), record.data(), len);
+      log_decode(record.data(), record.data() + len, out);
+      tail += sizeof(len) + len;
+    }
+    if (!out.empty()) {
+      fwrite(out.data(), 1, out.size(), LOG_FILE);
+      out.clear();
+      any = true;
+    }
+    ring->tail.store(tail, ::std::memory_order_release);
+  }
+  if (any) {
+    fflush(LOG_FILE);
+  }
+
+  ::std::lock_guard<::std::mutex> lock(log_rings_mutex);
+  for (size_t i = 0; i < log_rings.size();) {
+    LogRing_PRIVATE & ring = *log_rings[i];
+    if (ring.closed.load(::std::memory_order_acquire) &&
+        ring.head.load(::std::memory_order_acquire) ==
+            ring.tail.load(::std::memory_order_relaxed)) {
+      log_rings[i] = log_rings.back();
+      log_rings.pop_back();
+    } else {
+      i++;
+    }
+  }
+  return any;
+}
+
+void log_async_commit_PRIVATE(::std::vector<uint8_t> & record) {
+  uint32_t const len =
+      static_cast<uint32_t>(record.size() - sizeof(uint32_t));
+  memcpy(record.data(), &len, sizeof(len));
+
+  if (log_ring_holder.ring == nullptr) {
+    ::std::lock_guard<::std::mutex> lock(log_rings_mutex);
+    log_ring_holder.ring =
+        ::std::make_shared<LogRing_PRIVATE>(log_ring_bytes);
+    log_rings.push_back(log_ring_holder.ring);
+  }
+  LogRing_PRIVATE & ring = *log_ring_holder.ring;
+
+  if (record.size() > ring.capacity() / 2) {
+    /* Too large to queue, so write it now, after what is queued. */
+    ::std::lock_guard<::std::mutex> lock(log_consumer_mutex);
+    log_drain();
+    ::std::string out;
+    log_decode(
+        record.data() + sizeof(len),
+        record.data() + record.size(),
+        out);
+    fwrite(out.data(), 1, out.size(), LOG_FILE);
+    fflush(LOG_FILE);
+    return;
+  }
+
+  size_t const head = ring.head.load(::std::memory_order_relaxed);
+  while (head + record.size() -
+             ring.tail.load(::std::memory_order_acquire) >
+         ring.capacity()) {
+    if (!log_consumer_running.load(::std::memory_order_relaxed)) {
+      ::std::lock_guard<::std::mutex> lock(log_consumer_mutex);
+      log_drain();
+    } else {
+      ::std::this_thread::yield();
+    }
+  }
+  ring.write(head, record.data(), record.size());
+  ring.head.store(head + record.size(), ::std::memory_order_release);
+}
+
+static void log_consume() {
+  while (log_consumer_running.load(::std::memory_order_acquire)) {
+    bool any;
+    {
+      ::std::lock_guard<::std::mutex> lock(log_consumer_mutex);
+      any = log_drain();
+    }
+    if (!any) {
+      ::std::this_thread::sleep_for(::std::chrono::milliseconds(1));
+    }
+  }
+}
+
+void log_async_start(size_t const ring_bytes) {
+  if (log_consumer_running.load()) {
+    return;
+  }
+  size_t capacity = 1024;
+  while (capacity < ring_bytes) {
+    capacity <<= 1;
+  }
+  {
+    ::std::lock_guard<::std::mutex> lock(log_rings_mutex);
+    log_ring_bytes = capacity;
+  }
+  log_consumer_running.store(true);
+  log_consumer = ::std::thread(log_consume);
+  LOG_ASYNC_private.store(true);
+}
+
+void log_async_flush() {
+  ::std::lock_guard<::std::mutex> lock(log_consumer_mutex);
+  log_drain();
+}
+
+void log_async_stop() {
+  LOG_ASYNC_private.store(false);
+  if (log_consumer_running.exchange(false)) {
+    log_consumer.join();
+  }
+  log_async_flush();
+}
+
+/* Stops the background thread at exit, if it was left running. */
+static struct LogAsyncStopper_PRIVATE {
+  ~LogAsyncStopper_PRIVATE() {
+    log_async_stop();
+  }
+} log_async_stopper;
+
 void log_stack_trace() {
 #ifdef __GLIBC__
   void * backtraces[100];
@@ -18,9 +18,25 @@
  *  - log_fatal (enabled always, cannot be disabled)
  *  - log_assert(conditionally invoke fatal, cannot be disabled)
  *
+ * Those switches choose what is compiled in, and by default everything
+ * compiled in is printed, so a file which enables debug prints its
+ * debug logs. A single level for all files may be chosen at runtime
+ * with log_set_level, or with the FF_LOG_LEVEL environment variable
+ * ("trace", "debug", "info", "warn", "error" or "fatal"), to print
+ * only the compiled in levels at or above it.
+ *
  * Use the LOG_FILE (FILE*) pointer to set where to log to, and use
  * LOG_ORGANIZATION to print the name of the organization on each log line.
  *
+ * By default each log line is formatted and flushed by the thread which
+ * logs it. After log_async_start, log lines are instead recorded in
+ * binary (the format string, a timestamp and the raw arguments) to a
+ * lock-free ring buffer per thread, and formatted and written by a
+ * background thread. Lines from one thread stay in order, but lines
+ * from different threads may interleave differently than they were
+ * logged.
+ * log_fatal flushes the buffers and is always written synchronously.
+ *
  * To change the time format set LOG_TIME_FMT as a compiler argument using
  * strftime(3), and LOG_TIME_FMT_LEN to be the maximum string length
  * (including null terminator). Do not change these on a per-file basis,
@@ -42,7 +58,11 @@
 #include <cstdlib>
 #include <cstring>
 
+#include <atomic>
+#include <cstdint>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 /* Here begins the abuse of macros */
 #ifndef LOG_UNCLUDE
@@ -75,6 +95,170 @@ void log_time_update_PRIVATE();
 
 void log_stack_trace();
 
+/**
+ * Runtime log levels. Messages below the current level are discarded
+ * before their arguments are evaluated. LOG_LEVEL_FILE, the default,
+ * leaves each file at the levels it compiled in.
+ */
+enum LogLevel : int {
+  LOG_LEVEL_FILE = -1,
+  LOG_LEVEL_TRACE = 0,
+  LOG_LEVEL_DEBUG = 1,
+  LOG_LEVEL_INFO = 2,
+  LOG_LEVEL_WARN = 3,
+  LOG_LEVEL_ERROR = 4,
+  LOG_LEVEL_FATAL = 5,
+};
+
+void log_set_level(LogLevel const level);
+LogLevel log_get_level();
+
+/**
+ * Sets the level from its name (case insensitive). Returns false, and
+ * leaves the level unchanged, if the name is not recognized.
+ */
+bool log_set_level_name(char const * name);
+
+/**
+ * Starts the background logging thread. Each thread which logs gets a
+ * ring buffer of ring_bytes (rounded up to a power of two). Threads
+ * wait for space when their buffer is full.
+ */
+void log_async_start(size_t ring_bytes = 1 << 20);
+
+/**
+ * Writes everything recorded so far to LOG_FILE.
+ */
+void log_async_flush();
+
+/**
+ * Stops the background thread, after writing everything recorded so
+ * far. Logging resumes synchronously.
+ */
+void log_async_stop();
+
+extern ::std::atomic<int> LOG_LEVEL_private;
+extern ::std::atomic<bool> LOG_ASYNC_private;
+
+/* Levels which a file did not compile in are never logged, so at
+ * LOG_LEVEL_FILE everything reaching this check is printed. */
+inline bool log_enabled_PRIVATE(int const level) {
+  int const current =
+      LOG_LEVEL_private.load(::std::memory_order_relaxed);
+  return current == LOG_LEVEL_FILE || level >= current;
+}
+
+inline bool log_async_enabled_PRIVATE(int const level) {
+  return level < LOG_LEVEL_FATAL &&
+      LOG_ASYNC_private.load(::std::memory_order_relaxed);
+}
+
+/**
+ * Binary encoding of asynchronous log records. Each argument is a tag
+ * byte followed by its value. Strings are copied, since they may not
+ * outlive the call.
+ */
+enum LogArgTag_PRIVATE : uint8_t {
+  LOG_ARG_SIGNED = 'i',
+  LOG_ARG_UNSIGNED = 'u',
+  LOG_ARG_DOUBLE = 'd',
+  LOG_ARG_STRING = 's',
+  LOG_ARG_POINTER = 'p',
+  LOG_ARG_UNKNOWN = '?',
+};
+
+void log_async_put_PRIVATE(
+    ::std::vector<uint8_t> & record,
+    void const * data,
+    size_t const len);
+
+/**
+ * Clears this thread's record buffer and writes the record header.
+ */
+::std::vector<uint8_t> & log_async_begin_PRIVATE(char const * fmt);
+
+/**
+ * Copies the record into this thread's ring buffer.
+ */
+void log_async_commit_PRIVATE(::std::vector<uint8_t> & record);
+
+template<typename T>
+typename ::std::enable_if<
+    (::std::is_integral<T>::value && ::std::is_signed<T>::value) ||
+    ::std::is_enum<T>::value>::type
+log_async_arg_PRIVATE(::std::vector<uint8_t> & record, T const v) {
+  int64_t const val = static_cast<int64_t>(v);
+  record.push_back(LOG_ARG_SIGNED);
+  log_async_put_PRIVATE(record, &val, sizeof(val));
+}
+
+template<typename T>
+typename ::std::enable_if<
+    ::std::is_integral<T>::value && !::std::is_signed<T>::value>::type
+log_async_arg_PRIVATE(::std::vector<uint8_t> & record, T const v) {
+  uint64_t const val = static_cast<uint64_t>(v);
+  record.push_back(LOG_ARG_UNSIGNED);
+  log_async_put_PRIVATE(record, &val, sizeof(val));
+}
+
+template<typename T>
+typename ::std::enable_if<::std::is_floating_point<T>::value>::type
+log_async_arg_PRIVATE(::std::vector<uint8_t> & record, T const v) {
+  double const val = static_cast<double>(v);
+  record.push_back(LOG_ARG_DOUBLE);
+  log_async_put_PRIVATE(record, &val, sizeof(val));
+}
+
+inline void
+log_async_arg_PRIVATE(::std::vector<uint8_t> & record, char const * v) {
+  if (v == nullptr) {
+    v = "(null)";
+  }
+  uint32_t const len = static_cast<uint32_t>(strlen(v));
+  record.push_back(LOG_ARG_STRING);
+  log_async_put_PRIVATE(record, &len, sizeof(len));
+  log_async_put_PRIVATE(record, v, len);
+}
+
+inline void
+log_async_arg_PRIVATE(::std::vector<uint8_t> & record, char * v) {
+  log_async_arg_PRIVATE(record, static_cast<char const *>(v));
+}
+
+template<typename T>
+void log_async_arg_PRIVATE(::std::vector<uint8_t> & record, T * v) {
+  void const * const val = static_cast<void const *>(v);
+  record.push_back(LOG_ARG_POINTER);
+  log_async_put_PRIVATE(record, &val, sizeof(val));
+}
+
+/* Arguments which printf cannot print are shown as "<?>". */
+template<typename T>
+typename ::std::enable_if<!::std::is_scalar<T>::value>::type
+log_async_arg_PRIVATE(::std::vector<uint8_t> & record, T const &) {
+  record.push_back(LOG_ARG_UNKNOWN);
+}
+
+inline void log_async_args_PRIVATE(::std::vector<uint8_t> &) {
+}
+
+template<typename T, typename... Rest_T>
+void log_async_args_PRIVATE(
+    ::std::vector<uint8_t> & record,
+    T const & v,
+    Rest_T const &... rest) {
+  log_async_arg_PRIVATE(record, v);
+  log_async_args_PRIVATE(record, rest...);
+}
+
+template<typename... Args_T>
+void log_async_record_PRIVATE(
+    char const * fmt, Args_T const &... args) {
+  ::std::vector<uint8_t> & record = log_async_begin_PRIVATE(fmt);
+  log_async_args_PRIVATE(record, args...);
+  log_async_commit_PRIVATE(record);
+}
+
 /**
  * A helper class to work with printing time objects.
  */
@@ -100,66 +284,45 @@ public:
 #define stringify(...) stringify_(__VA_ARGS__)
 
 #ifndef NDEBUG // ifdef DEBUG
-#ifdef LOG_NO_COLOR
-#define log_PRIVATE(level, color, fmt, ...) \
-  do { \
-    log_time_update_PRIVATE(); \
-    fprintf( \
-        LOG_FILE, \
-        "%s " level " (" __FILE__ \
-        ":" stringify(__LINE__) ") (%s): " fmt "%s", \
-        LOG_TIME_STR_private, \
-        LOG_ORGANIZATION.c_str(), \
-        __VA_ARGS__); \
-    fflush(LOG_FILE); \
-  } while (0)
-#else
-#define log_PRIVATE(level, color, fmt, ...) \
-  do { \
-    log_time_update_PRIVATE(); \
-    fprintf( \
-        LOG_FILE, \
-        color "%s " level " (" __FILE__ \
-              ":" stringify(__LINE__) ") (%s): " LOG_COLOR_DEFAULT fmt \
-                                      "%s", \
-        LOG_TIME_STR_private, \
-        LOG_ORGANIZATION.c_str(), \
-        __VA_ARGS__); \
-    fflush(LOG_FILE); \
-  } while (0)
-#endif // LOG_NO_COLOR
+#define LOG_LOCATION_PRIVATE " (" __FILE__ ":" stringify(__LINE__) ")"
 #else
+#define LOG_LOCATION_PRIVATE ""
+#endif // NDEBUG
+
 #ifdef LOG_NO_COLOR
-#define log_PRIVATE(level, color, fmt, ...) \
-  do { \
-    log_time_update_PRIVATE(); \
-    fprintf( \
-        LOG_FILE, \
-        "%s " level " (%s): " fmt "%s", \
-        LOG_TIME_STR_private, \
-        LOG_ORGANIZATION.c_str(), \
-        __VA_ARGS__); \
-    fflush(LOG_FILE); \
-  } while (0)
+#define LOG_PREFIX_PRIVATE(level, color) \
+  "%s " level LOG_LOCATION_PRIVATE " (%s): "
 #else
-#define log_PRIVATE(level, color, fmt, ...) \
+#define LOG_PREFIX_PRIVATE(level, color) \
+  color "%s " level LOG_LOCATION_PRIVATE " (%s): " LOG_COLOR_DEFAULT
+#endif // LOG_NO_COLOR
+
+/* The first two arguments of the format are always the time and the
+ * organization, in both the synchronous and asynchronous cases. */
+#define log_PRIVATE(lvl, level, color, fmt, ...) \
   do { \
-    log_time_update_PRIVATE(); \
-    fprintf( \
-        LOG_FILE, \
-        color "%s " level " (%s): " LOG_COLOR_DEFAULT fmt "%s", \
-        LOG_TIME_STR_private, \
-        LOG_ORGANIZATION.c_str(), \
-        __VA_ARGS__); \
-    fflush(LOG_FILE); \
+    if (log_enabled_PRIVATE(lvl)) { \
+      if (log_async_enabled_PRIVATE(lvl)) { \
+        log_async_record_PRIVATE( \
+            LOG_PREFIX_PRIVATE(level, color) fmt "%s", __VA_ARGS__); \
+      } else { \
+        log_time_update_PRIVATE(); \
+        fprintf( \
+            LOG_FILE, \
+            LOG_PREFIX_PRIVATE(level, color) fmt "%s", \
+            LOG_TIME_STR_private, \
+            LOG_ORGANIZATION.c_str(), \
+            __VA_ARGS__); \
+        fflush(LOG_FILE); \
+      } \
+    } \
   } while (0)
-#endif // LOG_NO_COLOR
-#endif // NDEBUG
 
 #ifdef LOG_ENABLE_TRACE
 #undef log_trace
 #define log_trace(...) \
-  log_PRIVATE("TRACE", LOG_COLOR_BLUE, __VA_ARGS__, "\n")
+  log_PRIVATE( \
+      LOG_LEVEL_TRACE, "TRACE", LOG_COLOR_BLUE, __VA_ARGS__, "\n")
 #else
 #undef log_trace
 #define log_trace(...)
@@ -168,7 +331,8 @@ public:
 #ifdef LOG_ENABLE_DEBUG
 #undef log_debug
 #define log_debug(...) \
-  log_PRIVATE("DEBUG", LOG_COLOR_MAGENTA, __VA_ARGS__, "\n")
+  log_PRIVATE( \
+      LOG_LEVEL_DEBUG, "DEBUG", LOG_COLOR_MAGENTA, __VA_ARGS__, "\n")
 #else
 #undef log_debug
 #define log_debug(...)
@@ -177,7 +341,8 @@ public:
 #ifndef LOG_DISABLE_INFO
 #undef log_info
 #define log_info(...) \
-  log_PRIVATE(" INFO", LOG_COLOR_CYAN, __VA_ARGS__, "\n")
+  log_PRIVATE( \
+      LOG_LEVEL_INFO, " INFO", LOG_COLOR_CYAN, __VA_ARGS__, "\n")
 #else
 #undef log_info
 #define log_info(...)
@@ -186,7 +351,8 @@ public:
 #ifndef LOG_DISABLE_WARN
 #undef log_warn
 #define log_warn(...) \
-  log_PRIVATE(" WARN", LOG_COLOR_YELLOW, __VA_ARGS__, "\n")
+  log_PRIVATE( \
+      LOG_LEVEL_WARN, " WARN", LOG_COLOR_YELLOW, __VA_ARGS__, "\n")
 #else
 #undef log_warn
 #define log_warn(...)
@@ -195,7 +361,8 @@ public:
 #ifndef LOG_DISABLE_ERROR
 #undef log_error
 #define log_error(...) \
-  log_PRIVATE("ERROR", LOG_COLOR_RED, __VA_ARGS__, "\n")
+  log_PRIVATE( \
+      LOG_LEVEL_ERROR, "ERROR", LOG_COLOR_RED, __VA_ARGS__, "\n")
 #else
 #undef log_error
 #define log_error(...)
@@ -224,7 +391,13 @@ public:
 #undef log_fatal
 #define log_fatal(...) \
   do { \
-    log_PRIVATE("FATAL", LOG_COLOR_RED_INVERT, __VA_ARGS__, "\n"); \
+    log_async_flush(); \
+    log_PRIVATE( \
+        LOG_LEVEL_FATAL, \
+        "FATAL", \
+        LOG_COLOR_RED_INVERT, \
+        __VA_ARGS__, \
+        "\n"); \
     log_stack_trace(); \
     abort(); \
   } while (0)
@@ -286,11 +459,17 @@ public:
 #define log_time_start(name) \
   LogTimer((name)); \
   log_PRIVATE( \
-      " TIME", LOG_COLOR_GREEN, "Starting Timer \"%s\"", (name), "\n")
+      LOG_LEVEL_INFO, \
+      " TIME", \
+      LOG_COLOR_GREEN, \
+      "Starting Timer \"%s\"", \
+      (name), \
+      "\n")
 
 #define log_time_start_ctx(name, ctx) \
   LogTimer((name)); \
   log_PRIVATE( \
+      LOG_LEVEL_INFO, \
       " TIME", \
       LOG_COLOR_GREEN, \
       "Starting Timer \"%s\", %s", \
@@ -300,6 +479,7 @@ public:
 
 #define log_time_update(timer, msg) \
   log_PRIVATE( \
+      LOG_LEVEL_INFO, \
       " TIME", \
       LOG_COLOR_GREEN, \
       "Timer \"%s\": %luus, %s", \
@@ -332,6 +512,8 @@ public:
 #undef _stringify
 #undef stringify
 
+#undef LOG_LOCATION_PRIVATE
+#undef LOG_PREFIX_PRIVATE
 #undef log_PRIVATE
 
 #undef LOG_ENABLE_TRACE
@@ -13,19 +13,29 @@
 #include <fcntl.h>
 
 /* C++ Headers */
+#include <algorithm>
 #include <cerrno>
+#include <cinttypes>
+#include <chrono>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <deque>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <string>
 #include <utility>
 #include <vector>
 
 /* 3rd Party Headers */
 
 /* Fortissimo Headers */
+#include <ff/Executor.h>
 #include <ff/Fronctocol.h>
 #include <ff/FronctocolsManager.h>
 #include <ff/Message.h>
@@ -141,6 +151,8 @@ public:
 
   void clear() override;
 
+  void reserve(size_t const nchars) override;
+
   OutgoingMessage(Identity_T const & id);
   ~OutgoingMessage();
 
@@ -159,6 +171,61 @@ template<typename Identity_T>
 outgoingToIncomingMessage(
     Identity_T const &, OutgoingMessage<Identity_T> &);
 
+/**
+ * Counters describing one call to runFortissimoPosixNet.
+ */
+template<typename Identity_T>
+struct Metrics {
+  struct Peer {
+    /**
+     * Bytes are counted as they cross the socket, including length
+     * prefixes. Sent messages include the identity handshake.
+     */
+    uint64_t bytesSent = 0;
+    uint64_t messagesSent = 0;
+    uint64_t bytesReceived = 0;
+    uint64_t messagesReceived = 0;
+
+    /* Messages and bytes waiting in the outgoing queue. */
+    size_t queueDepth = 0;
+    size_t queuedBytes = 0;
+    size_t maxQueueDepth = 0;
+  };
+
+  ::std::map<Identity_T, Peer> peers;
+
+  uint64_t pollIterations = 0;
+
+  /* Seconds spent blocked in poll, and in the FronctocolsManager. */
+  double pollTime = 0.0;
+  double computeTime = 0.0;
+
+  /* Fronctocols invoked so far, and those not yet closed. */
+  size_t fronctocols = 0;
+  size_t liveFronctocols = 0;
+
+  /**
+   * Formats the metrics in the Prometheus text exposition format,
+   * labeled with this party's identity.
+   */
+  ::std::string toPrometheus(Identity_T const & self) const;
+};
+
+/**
+ * Where and how often runFortissimoPosixNet dumps its Metrics. Either
+ * destination may be empty. The file is replaced atomically, so that
+ * it can be read by a node_exporter textfile collector. The Unix socket
+ * receives each dump on a new connection, and is skipped if nothing is
+ * listening.
+ */
+struct MetricsDump {
+  ::std::string path;
+  ::std::string unixSocket;
+
+  /* Seconds between dumps. A final dump is made when the run ends. */
+  double interval = 10.0;
+};
+
 /**
  * Blocking function to run Fortissimo. After it returns the given main
  * fronctocol will have been ran with the given peers, or an error will
@@ -176,6 +243,9 @@ outgoingToIncomingMessage(
  *
  * The self parameter is the identity of itself.
  *
+ * If metrics is given, it is filled in with the counters of this run.
+ * If dump is given, the metrics are also written there periodically.
+ *
  * The function returns true on success, false on failure.
  */
 template<typename Identity_T, typename PeerSet_T>
@@ -186,7 +256,198 @@ bool runFortissimoPosixNet(
         IncomingMessage<Identity_T>,
         OutgoingMessage<Identity_T>>> mainFronctocol,
     std::vector<PeerInfo<Identity_T>> const & peers_info,
-    Identity_T const & self);
+    Identity_T const & self,
+    Metrics<Identity_T> * metrics = nullptr,
+    MetricsDump const * dump = nullptr);
+
+using sessionId_t = uint64_t;
+
+template<typename Identity_T>
+class PeerMesh;
+
+/**
+ * Runs many independent main fronctocols, called sessions, over one
+ * set of connections to the peers, saving the cost of connecting for
+ * each protocol.
+ *
+ * Each session runs on its own FronctocolsManager, and sessions run
+ * concurrently. Messages are prefixed by their session's ID. Every
+ * party must start a session with the same ID, but not necessarily at
+ * the same time: messages which arrive before their session is started
+ * are held until it is. Only a bounded number of messages are held,
+ * per session and in total, and any more are dropped.
+ *
+ * IDs may not be reused. Only the most recently finished IDs are
+ * remembered, to reject their reuse and to drop late messages for them.
+ *
+ * As with runFortissimoPosixNet, main fronctocols return their results
+ * through pointers to the caller's memory.
+ *
+ * Given an Executor, each session's work is done on its threads rather
+ * than the caller's, so that sessions run in parallel. A session's work
+ * is still done one message at a time, in order, and its outgoing
+ * messages are sent by the caller's thread. Sessions must not share
+ * state which is not thread safe.
+ *
+ * Within a session, the tasks of Fronctocol::compute are also run on
+ * the Executor, in parallel with each other and with the session's
+ * work. Each continuation is then run as the session's work.
+ */
+template<typename Identity_T, typename PeerSet_T>
+class SessionRunner {
+public:
+  using Fronctocol_T = ff::Fronctocol<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage<Identity_T>,
+      OutgoingMessage<Identity_T>>;
+
+  /**
+   * The peers info must contain an entry for self. The executor is not
+   * owned, and must outlive this.
+   */
+  SessionRunner(
+      std::vector<PeerInfo<Identity_T>> const & peers_info,
+      Identity_T const & self,
+      Executor * executor = nullptr);
+  SessionRunner(SessionRunner const &) = delete;
+  SessionRunner & operator=(SessionRunner const &) = delete;
+  ~SessionRunner();
+
+  /**
+   * Blocks until all connections are established. This is done
+   * implicitly by the other methods. Returns false on failure, or after
+   * close.
+   */
+  bool connect();
+
+  /**
+   * Starts a session with the given main fronctocol. Returns false if
+   * the ID was already used or connecting fails.
+   */
+  bool start(
+      sessionId_t const id, ::std::unique_ptr<Fronctocol_T> main);
+
+  /**
+   * Polls the connections once, waiting at most timeout milliseconds,
+   * to advance the running sessions.
+   */
+  void poll(int const timeout);
+
+  /**
+   * Blocks until all started sessions have finished. Returns false if
+   * any of them failed.
+   */
+  bool run();
+
+  size_t numActive() const;
+
+  /**
+   * Returns whether each session finished since the last call was
+   * successful, by session ID.
+   */
+  ::std::map<sessionId_t, bool> takeResults();
+
+  /**
+   * Counters of the connections, and of the fronctocols of all
+   * sessions.
+   */
+  Metrics<Identity_T> const & getMetrics();
+
+  /**
+   * Finishes sending queued messages, then closes the connections.
+   */
+  void close();
+
+private:
+  using Manager_T = FronctocolsManager<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage<Identity_T>,
+      OutgoingMessage<Identity_T>>;
+
+  using OutgoingMessages_T =
+      ::std::vector<::std::unique_ptr<OutgoingMessage<Identity_T>>>;
+  using Work =
+      ::std::function<void(Manager_T &, OutgoingMessages_T * out_msgs)>;
+
+  struct Session {
+    ::std::unique_ptr<Manager_T> manager;
+
+    /* Orders the session's work on the executor, if there is one. */
+    ::std::unique_ptr<Executor::Strand> strand;
+    size_t inFlight = 0;
+
+    /* Compute tasks offloaded, as last reported by a Completion. */
+    size_t offloaded = 0;
+
+    bool finished = false;
+    size_t fronctocols = 0;
+    size_t liveFronctocols = 0;
+  };
+
+  /**
+   * The result of some work for a session, which is passed back from
+   * the executor.
+   */
+  struct Completion {
+    sessionId_t id = 0;
+    OutgoingMessages_T outMsgs;
+    double computeTime = 0.0;
+    bool closed = false;
+    bool aborted = false;
+    size_t fronctocols = 0;
+    size_t liveFronctocols = 0;
+    size_t offloaded = 0;
+  };
+
+  Identity_T const self;
+  PeerSet_T const peers;
+  Metrics<Identity_T> metrics;
+  PeerMesh<Identity_T> mesh;
+
+  Executor * const executor;
+  bool canWake = false;
+  ::std::mutex completionsMutex;
+  ::std::vector<Completion> completions;
+
+  bool opened = false;
+  bool failed = false;
+  bool closed = false;
+
+  ::std::map<sessionId_t, Session> sessions;
+  ::std::map<
+      sessionId_t,
+      ::std::vector<::std::unique_ptr<IncomingMessage<Identity_T>>>>
+      pending;
+  size_t numPending = 0;
+  ::std::set<sessionId_t> finishedIds;
+  /* finishedIds, oldest first, to forget the oldest. */
+  ::std::deque<sessionId_t> finishedOrder;
+  ::std::map<sessionId_t, bool> results;
+  size_t numFailed = 0;
+  size_t finishedFronctocols = 0;
+
+  void step(int const timeout);
+  void deliver(
+      sessionId_t const id,
+      ::std::unique_ptr<IncomingMessage<Identity_T>> in_msg);
+  void dispatch(
+      sessionId_t const id, Session & session, Work const & work);
+  void post(
+      sessionId_t const id,
+      Manager_T & manager,
+      Executor::Strand & strand,
+      Work const & work);
+  static Completion
+  runWork(sessionId_t const id, Manager_T & manager, Work const & work);
+  void complete(Completion & completion);
+  size_t numInFlight() const;
+  void send(
+      sessionId_t const id,
+      ::std::vector<::std::unique_ptr<OutgoingMessage<Identity_T>>> &
+          out_msgs);
+};
 
 } // namespace posixnet
 } // namespace ff
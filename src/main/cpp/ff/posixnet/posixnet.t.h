@@ -8,6 +8,11 @@ namespace posixnet {
 constexpr static time_t CLOSE_TIMEOUT = 60; // seconds;
 constexpr static size_t OUTGOING_MESSAGE_SIZE_FLOOR = 16; // bytes
 
+/* Limits on what a SessionRunner holds for sessions not running. */
+constexpr static size_t MAX_PENDING_PER_SESSION = 1024; // messages
+constexpr static size_t MAX_PENDING_MESSAGES = 16384;
+constexpr static size_t MAX_FINISHED_SESSION_IDS = 4096;
+
 template<typename Identity_T, typename PeerSet_T>
 PeerSet_T PeerInfos2PeerSet(
     std::vector<PeerInfo<Identity_T>> const & peer_infos) {
@@ -173,6 +178,11 @@ void OutgoingMessage<Identity_T>::clear() {
   free(this->takeBuffer());
 }
 
+template<typename Identity_T>
+void OutgoingMessage<Identity_T>::reserve(size_t const nchars) {
+  this->makeSpace(nchars);
+}
+
 template<typename Identity_T>
 OutgoingMessage<Identity_T>::OutgoingMessage(Identity_T const & id) :
     ff::OutgoingMessage<Identity_T>(id) {
@@ -267,6 +277,11 @@ public:
    */
   Identity_T const & peer;
 
+  /**
+   * Traffic counters of this connection.
+   */
+  typename Metrics<Identity_T>::Peer counters;
+
   ConnectionHandler(ConnectionHandler &) = delete;
   ConnectionHandler & operator=(ConnectionHandler &) = delete;
   ConnectionHandler && operator=(ConnectionHandler &&) = delete;
@@ -280,7 +295,8 @@ public:
       outgoingBuffers(::std::move(other.outgoingBuffers)),
       pfd(other.pfd),
       needReconnect(other.needReconnect),
-      peer(other.peer) {
+      peer(other.peer),
+      counters(other.counters) {
     log_debug("ConnectionHandler move constructor");
   }
 
@@ -300,6 +316,21 @@ public:
     return this->outgoingBuffers.size() == 0;
   }
 
+  /**
+   * Returns the counters along with the current outgoing queue.
+   */
+  typename Metrics<Identity_T>::Peer collectCounters() const {
+    typename Metrics<Identity_T>::Peer ret = this->counters;
+    ret.queueDepth = this->outgoingBuffers.size();
+    ret.queuedBytes = 0;
+    for (::std::pair<size_t, uint8_t *> const & buffer :
+         this->outgoingBuffers) {
+      ret.queuedBytes += buffer.first;
+    }
+    ret.queuedBytes -= this->outgoingBufferPlace;
+    return ret;
+  }
+
   /**
    * When a new connection is made, accept the connection and setup
    * an IncomingConnectionInitializer to read the identity.
@@ -368,6 +399,7 @@ public:
           0);
       log_trace("called recv for message length, got %zi", inlen);
       if (inlen > 0) {
+        this->counters.bytesReceived += (uint64_t)inlen;
         this->incomingLenBufferLen += (size_t)inlen;
         log_assert(this->incomingLenBufferLen <= sizeof(uint64_t));
         if (this->incomingLenBufferLen == sizeof(uint64_t)) {
@@ -404,6 +436,7 @@ public:
           0);
       log_trace("called recv for incoming message, got: %zd", inlen);
       if (inlen > 0) {
+        this->counters.bytesReceived += (uint64_t)inlen;
         this->incomingBufferLen += (size_t)inlen;
         log_debug(
             "read %zu of message length %zu",
@@ -413,6 +446,7 @@ public:
         if (this->incomingBufferLen == this->incomingLen) {
           // Construct the message, and reset for the next message.
           log_trace("returning a newly read message");
+          this->counters.messagesReceived++;
           ret = ::std::unique_ptr<IncomingMessage<Identity_T>>(
               new IncomingMessage<Identity_T>(
                   this->peer, this->incomingBuffer, this->incomingLen));
@@ -496,6 +530,7 @@ public:
     if (outlen >= 0) {
       /* Check how much of the buffer got sent */
       this->outgoingBufferPlace += (size_t)outlen;
+      this->counters.bytesSent += (uint64_t)outlen;
       log_debug("more to send");
       log_assert(
           this->outgoingBufferPlace <=
@@ -507,6 +542,7 @@ public:
         this->outgoingBufferPlace = 0;
         free(this->outgoingBuffers.front().second);
         this->outgoingBuffers.pop_front();
+        this->counters.messagesSent++;
         log_debug("finished writing message to peer");
       }
     } else {
@@ -537,6 +573,8 @@ public:
     size_t const length = out_msg->length();
     this->outgoingBuffers.push_back(
         ::std::pair<size_t, uint8_t *>(length, out_msg->takeBuffer()));
+    this->counters.maxQueueDepth = ::std::max(
+        this->counters.maxQueueDepth, this->outgoingBuffers.size());
   }
 
   /**
@@ -741,6 +779,213 @@ public:
   }
 };
 
+/* Escapes a Prometheus label value. */
+inline ::std::string prometheusEscape(::std::string const & str) {
+  ::std::string out;
+  out.reserve(str.size());
+  for (char const c : str) {
+    if (c == '"' || c == '\\') {
+      out.push_back('\\');
+      out.push_back(c);
+    } else if (c == '\n') {
+      out += "\\n";
+    } else {
+      out.push_back(c);
+    }
+  }
+  return out;
+}
+
+inline void prometheusFamily(
+    ::std::string & out,
+    char const * name,
+    char const * type,
+    char const * help) {
+  out += "# HELP ";
+  out += name;
+  out += " ";
+  out += help;
+  out += "\n# TYPE ";
+  out += name;
+  out += " ";
+  out += type;
+  out += "\n";
+}
+
+inline void prometheusSample(
+    ::std::string & out,
+    char const * name,
+    ::std::string const & labels,
+    double const value) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.17g", value);
+  out += name;
+  out += "{";
+  out += labels;
+  out += "} ";
+  out += buf;
+  out += "\n";
+}
+
+template<typename Identity_T>
+::std::string
+Metrics<Identity_T>::toPrometheus(Identity_T const & self) const {
+  ::std::string const self_label =
+      "self=\"" + prometheusEscape(identity_to_string(self)) + "\"";
+  ::std::string out;
+
+  using PeerMetric = ::std::function<double(Peer const &)>;
+  auto per_peer = [&](char const * name,
+                      char const * type,
+                      char const * help,
+                      PeerMetric const & metric) -> void {
+    prometheusFamily(out, name, type, help);
+    for (::std::pair<Identity_T const, Peer> const & peer :
+         this->peers) {
+      ::std::string const labels = self_label + ",peer=\"" +
+          prometheusEscape(identity_to_string(peer.first)) + "\"";
+      prometheusSample(out, name, labels, metric(peer.second));
+    }
+  };
+  auto single = [&](char const * name,
+                    char const * type,
+                    char const * help,
+                    double const value) -> void {
+    prometheusFamily(out, name, type, help);
+    prometheusSample(out, name, self_label, value);
+  };
+
+  per_peer(
+      "ff_posixnet_sent_bytes_total",
+      "counter",
+      "Bytes written to the peer's socket.",
+      [](Peer const & p) { return (double)p.bytesSent; });
+  per_peer(
+      "ff_posixnet_sent_messages_total",
+      "counter",
+      "Messages completely written to the peer's socket.",
+      [](Peer const & p) { return (double)p.messagesSent; });
+  per_peer(
+      "ff_posixnet_received_bytes_total",
+      "counter",
+      "Bytes read from the peer's socket.",
+      [](Peer const & p) { return (double)p.bytesReceived; });
+  per_peer(
+      "ff_posixnet_received_messages_total",
+      "counter",
+      "Messages completely read from the peer's socket.",
+      [](Peer const & p) { return (double)p.messagesReceived; });
+  per_peer(
+      "ff_posixnet_queue_messages",
+      "gauge",
+      "Messages waiting to be sent to the peer.",
+      [](Peer const & p) { return (double)p.queueDepth; });
+  per_peer(
+      "ff_posixnet_queue_bytes",
+      "gauge",
+      "Bytes waiting to be sent to the peer.",
+      [](Peer const & p) { return (double)p.queuedBytes; });
+  per_peer(
+      "ff_posixnet_queue_max_messages",
+      "gauge",
+      "Most messages which have waited to be sent to the peer.",
+      [](Peer const & p) { return (double)p.maxQueueDepth; });
+
+  single(
+      "ff_posixnet_poll_iterations_total",
+      "counter",
+      "Iterations of the poll loop.",
+      (double)this->pollIterations);
+  single(
+      "ff_posixnet_poll_seconds_total",
+      "counter",
+      "Seconds blocked waiting in poll.",
+      this->pollTime);
+  single(
+      "ff_posixnet_compute_seconds_total",
+      "counter",
+      "Seconds spent in the fronctocols manager.",
+      this->computeTime);
+  single(
+      "ff_fronctocols_invoked_total",
+      "counter",
+      "Fronctocols invoked, including main.",
+      (double)this->fronctocols);
+  single(
+      "ff_fronctocols_live",
+      "gauge",
+      "Fronctocols which have not yet closed.",
+      (double)this->liveFronctocols);
+  return out;
+}
+
+/**
+ * Writes one dump of metrics to the dump's destinations. Failures are
+ * logged and otherwise ignored, as they should not stop the protocol.
+ */
+inline void
+writeMetricsDump(MetricsDump const & dump, ::std::string const & text) {
+  if (!dump.path.empty()) {
+    ::std::string const tmp = dump.path + ".tmp";
+    FILE * file = fopen(tmp.c_str(), "w");
+    bool ok = file != nullptr;
+    if (ok) {
+      ok = fwrite(text.data(), 1, text.size(), file) == text.size();
+      ok = 0 == fclose(file) && ok;
+    }
+    if (!ok || 0 != rename(tmp.c_str(), dump.path.c_str())) {
+      log_warn("failed to write metrics to %s", dump.path.c_str());
+    }
+  }
+
+  if (!dump.unixSocket.empty()) {
+#ifdef FF_HAS_UNIX_SOCKETS
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (dump.unixSocket.size() >= sizeof(address.sun_path)) {
+      log_warn("metrics socket path is too long");
+      return;
+    }
+    memcpy(
+        address.sun_path,
+        dump.unixSocket.c_str(),
+        dump.unixSocket.size());
+
+    int const fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+      log_perror();
+      return;
+    }
+    if (0 != connect(fd, (sockaddr *)&address, sizeof(address))) {
+      log_debug(
+          "no listener on metrics socket %s", dump.unixSocket.c_str());
+      close(fd);
+      return;
+    }
+#ifdef MSG_NOSIGNAL
+    int const flags = MSG_NOSIGNAL;
+#else
+    int const flags = 0;
+#endif
+    size_t place = 0;
+    while (place < text.size()) {
+      ssize_t const sent =
+          send(fd, text.data() + place, text.size() - place, flags);
+      if (sent <= 0) {
+        log_warn(
+            "failed to write metrics to %s", dump.unixSocket.c_str());
+        break;
+      }
+      place += (size_t)sent;
+    }
+    close(fd);
+#else
+    log_warn("metrics sockets are not supported on this platform");
+#endif
+  }
+}
+
 struct PollfdWrap {
   ff_pollfd * pollfds = nullptr;
   size_t num_pollfds = 0;
@@ -765,244 +1010,330 @@ struct PollfdWrap {
   }
 };
 
-template<typename Identity_T, typename PeerSet_T>
-bool runFortissimoPosixNet(
-    std::unique_ptr<ff::Fronctocol<
-        Identity_T,
-        PeerSet_T,
-        IncomingMessage<Identity_T>,
-        OutgoingMessage<Identity_T>>> mainFronctocol,
-    std::vector<PeerInfo<Identity_T>> const & peers_info,
-    Identity_T const & self) {
-  /* Step 1. make an array of pollfds. There should be one element for each
-   * peer_info, and an additional pollfd for each peer_info with identity
-   * greater than self.
+/**
+ * The connections from self to each of its peers. Connections are
+ * established and re-established as needed by polling, and may be kept
+ * open for any number of protocols.
+ */
+template<typename Identity_T>
+class PeerMesh {
+  /**
+   * Copy of the peers info, which the connection handlers refer to.
+   */
+  ::std::vector<PeerInfo<Identity_T>> const peersInfo;
+  Identity_T const self;
+
+  /**
+   * The pollfd array has one element for each peer_info, and an
+   * additional pollfd for each peer_info with identity greater than
+   * self.
    *
-   * The pollfd array should be coindexed by the peer_info index, upto the
+   * The pollfd array is coindexed by the peer_info index, upto the
    * last peer_info. subsequent peer_infos are for accepted connections
    * before the identity of the connection is confirmed.
-   *
-   * Also make a vector of ConnectionHandlers, one per peer_info.
-   *
-   * Also make a vector of IncomingConnectionInitializers, one for each pollfd
-   * extra than ConnectionHandlers.
-   *
-   * Also make a map of Identity_T to peers_info or conns index.
    */
-  size_t num_accepts = 0;
-  for (PeerInfo<Identity_T> const & peer : peers_info) {
-    if (peer.identity > self) {
-      num_accepts++;
+  PollfdWrap pfdw;
+  size_t numSockets = 0;
+
+  /**
+   * A pipe by which other threads may interrupt poll. Its read end
+   * follows the sockets in the pollfd array.
+   */
+  int wakeFds[2] = {-1, -1};
+
+  /**
+   * One ConnectionHandler per peer_info, and one
+   * IncomingConnectionInitializer for each pollfd extra than
+   * ConnectionHandlers.
+   */
+  ::std::vector<ConnectionHandler<Identity_T>> conns;
+  ::std::vector<IncomingConnectionInitializer<Identity_T>> initers;
+
+  bool connected = false; // all connections established.
+
+  Metrics<Identity_T> * const metrics;
+
+public:
+  PeerMesh(
+      ::std::vector<PeerInfo<Identity_T>> const & peers_info,
+      Identity_T const & self,
+      Metrics<Identity_T> * metrics) :
+      peersInfo(peers_info), self(self), metrics(metrics) {
+  }
+
+  PeerMesh(PeerMesh const &) = delete;
+  PeerMesh & operator=(PeerMesh const &) = delete;
+
+  ~PeerMesh() {
+    if (this->wakeFds[0] >= 0) {
+      if (this->pfdw.pollfds != nullptr) {
+        this->pfdw.pollfds[this->numSockets].fd = -1;
+      }
+      close(this->wakeFds[0]);
+      close(this->wakeFds[1]);
     }
   }
 
-  PollfdWrap pfdw;
-  pfdw.num_pollfds = peers_info.size() + num_accepts;
-  pfdw.pollfds =
-      (ff_pollfd *)malloc(sizeof(ff_pollfd) * pfdw.num_pollfds);
-  if (pfdw.pollfds == nullptr) {
-    log_perror();
+  /**
+   * Creates the pipe used by wake, and must be called before open.
+   * Returns false if this platform does not support it.
+   */
+  bool enableWakeup() {
+#ifdef FF_HAS_PIPES
+    if (this->wakeFds[0] >= 0) {
+      return true;
+    }
+    if (0 != pipe(this->wakeFds)) {
+      log_perror();
+      this->wakeFds[0] = -1;
+      this->wakeFds[1] = -1;
+      return false;
+    }
+    SET_NON_BLOCKING_SOCKET(this->wakeFds[0]);
+    SET_NON_BLOCKING_SOCKET(this->wakeFds[1]);
+    return true;
+#else
     return false;
-  }
-  memset(pfdw.pollfds, 0, pfdw.num_pollfds * sizeof(ff_pollfd));
-  for (size_t i = 0; i < pfdw.num_pollfds; i++) {
-    pfdw.pollfds[i].fd = -1;
-    pfdw.pollfds[i].events = FF_POLLIN | FF_POLLOUT;
+#endif
   }
 
-  ::std::vector<ConnectionHandler<Identity_T>> conns;
-  conns.reserve(peers_info.size());
-  for (size_t i = 0; i < peers_info.size(); i++) {
-    conns.emplace_back(peers_info[i].identity, &pfdw.pollfds[i]);
+  /**
+   * Interrupts pollOnce. Unlike the other methods, this is thread safe.
+   */
+  void wake() {
+#ifdef FF_HAS_PIPES
+    if (this->wakeFds[1] >= 0) {
+      uint8_t const byte = 0;
+      if (write(this->wakeFds[1], &byte, 1) < 0 && errno != EAGAIN) {
+        log_perror();
+      }
+    }
+#endif
   }
 
-  ::std::vector<IncomingConnectionInitializer<Identity_T>> initers;
-  initers.reserve(pfdw.num_pollfds - conns.size());
-  for (size_t i = conns.size(); i < pfdw.num_pollfds; i++) {
-    initers.emplace_back();
-  }
+  /**
+   * Opens the listen socket and the connect sockets. Returns false on
+   * failure.
+   */
+  bool open() {
+    /* Step 1. make an array of pollfds, connection handlers, and
+     * incoming connection initializers.
+     */
+    size_t num_accepts = 0;
+    for (PeerInfo<Identity_T> const & peer : this->peersInfo) {
+      if (peer.identity > this->self) {
+        num_accepts++;
+      }
+    }
 
-  /* A lambda for distributing outgoing messages to connections */
-  auto distribute =
-      [&conns](::std::vector<::std::unique_ptr<
-                   OutgoingMessage<Identity_T>>> & out_msgs) -> void {
-    for (size_t i = 0; i < out_msgs.size(); i++) {
-      for (size_t j = 0; j < conns.size(); j++) {
-        log_assert(out_msgs[i] != nullptr);
-        if (out_msgs[i]->recipient == conns[j].peer) {
-          conns[j].enqueOutgoingMessage(::std::move(out_msgs[i]));
-          break;
+    this->numSockets = this->peersInfo.size() + num_accepts;
+    this->pfdw.num_pollfds =
+        this->numSockets + (this->wakeFds[0] >= 0 ? 1 : 0);
+    this->pfdw.pollfds =
+        (ff_pollfd *)malloc(sizeof(ff_pollfd) * this->pfdw.num_pollfds);
+    if (this->pfdw.pollfds == nullptr) {
+      log_perror();
+      return false;
+    }
+    memset(
+        this->pfdw.pollfds,
+        0,
+        this->pfdw.num_pollfds * sizeof(ff_pollfd));
+    for (size_t i = 0; i < this->pfdw.num_pollfds; i++) {
+      this->pfdw.pollfds[i].fd = -1;
+      this->pfdw.pollfds[i].events = FF_POLLIN | FF_POLLOUT;
+    }
+    if (this->wakeFds[0] >= 0) {
+      this->pfdw.pollfds[this->numSockets].fd = this->wakeFds[0];
+      this->pfdw.pollfds[this->numSockets].events = FF_POLLIN;
+    }
+
+    this->conns.reserve(this->peersInfo.size());
+    for (size_t i = 0; i < this->peersInfo.size(); i++) {
+      this->conns.emplace_back(
+          this->peersInfo[i].identity, &this->pfdw.pollfds[i]);
+    }
+
+    this->initers.reserve(this->numSockets - this->conns.size());
+    for (size_t i = this->conns.size(); i < this->numSockets; i++) {
+      this->initers.emplace_back();
+    }
+
+    ff_pollfd * const pollfds = this->pfdw.pollfds;
+    ::std::vector<PeerInfo<Identity_T>> const & peers_info =
+        this->peersInfo;
+
+    /* Step 2. open a listen socket for self */
+    {
+      bool self_made = false;
+      for (size_t i = 0; i < peers_info.size(); i++) {
+        if (peers_info[i].identity == this->self) {
+          log_trace("calling socket for listen socket");
+          pollfds[i].fd =
+              socket(peers_info[i].address.ss_family, SOCK_STREAM, 0);
+          if (pollfds[i].fd < 0) {
+            log_perror();
+            return false;
+          }
+          log_trace("called socket for listen socket");
+
+          int enable = 1;
+          log_trace("calling setsocketopt for listen socket");
+          if (FF_SETSOCKOPT(
+                  pollfds[i].fd,
+                  SOL_SOCKET,
+                  SO_REUSEADDR,
+                  (void *)&enable,
+                  sizeof(enable)) < 0) {
+            log_perror();
+            return false;
+          }
+          log_trace("called setsocketopt for listen socket");
+
+          log_trace(
+              "calling set_non_blocking_socket for listen socket");
+          SET_NON_BLOCKING_SOCKET(pollfds[i].fd);
+          log_trace("called set_non_blocking_socket for listen socket");
+
+          if (AF_INET == peers_info[i].address.ss_family) {
+            log_debug(
+                "binding to port %hu",
+                ntohs(
+                    ((sockaddr_in *)&peers_info[i].address)->sin_port));
+          }
+          log_trace("calling bind for listen socket");
+          if (bind(
+                  pollfds[i].fd,
+                  (sockaddr *)&peers_info[i].address,
+                  sizeof(sockaddr_storage)) != 0) {
+            log_perror();
+            return false;
+          }
+          log_trace("called bind for listen socket");
+
+          log_trace("calling listen for listen socket");
+          if (listen(pollfds[i].fd, SOMAXCONN) != 0) {
+            log_perror();
+            return false;
+          }
+          log_trace("called listen for listen socket");
+          pollfds[i].events = FF_POLLIN;
+
+          self_made = true;
+          this->conns[i].connected = true;
         }
       }
+
+      if (self_made == false) {
+        log_error("No accept socket for incoming connections");
+        return false;
+      }
     }
-  };
 
-  /* Step 2. open a listen socket for self */
-  {
-    bool self_made = false;
+    /* Step 3. open a connect socket for each peer_info with an identity
+     * less than self.
+     */
+    log_info("has %zu peers", peers_info.size());
     for (size_t i = 0; i < peers_info.size(); i++) {
-      if (peers_info[i].identity == self) {
-        log_trace("calling socket for listen socket");
-        pfdw.pollfds[i].fd =
-            socket(peers_info[i].address.ss_family, SOCK_STREAM, 0);
-        if (pfdw.pollfds[i].fd < 0) {
-          log_perror();
-          return false;
-        }
-        log_trace("called socket for listen socket");
-
-        int enable = 1;
-        log_trace("calling setsocketopt for listen socket");
-        if (FF_SETSOCKOPT(
-                pfdw.pollfds[i].fd,
-                SOL_SOCKET,
-                SO_REUSEADDR,
-                (void *)&enable,
-                sizeof(enable)) < 0) {
+      if (peers_info[i].identity < this->self) {
+        log_trace("calling socket for peer connection");
+        pollfds[i].fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (pollfds[i].fd < 0) {
           log_perror();
-          return false;
+          this->conns[i].needReconnect = true;
         }
-        log_trace("called setsocketopt for listen socket");
+        log_trace("called socket for peer connection");
 
-        log_trace("calling set_non_blocking_socket for listen socket");
-        SET_NON_BLOCKING_SOCKET(pfdw.pollfds[i].fd);
-        log_trace("called set_non_blocking_socket for listen socket");
-
-        if (AF_INET == peers_info[i].address.ss_family) {
-          log_debug(
-              "binding to port %hu",
-              ntohs(((sockaddr_in *)&peers_info[i].address)->sin_port));
-        }
-        log_trace("calling bind for listen socket");
-        if (bind(
-                pfdw.pollfds[i].fd,
+        log_trace("calling connect for peer connection");
+        log_info(
+            "connecting to %s",
+            identity_to_string(peers_info[i].identity).c_str());
+        if (connect(
+                pollfds[i].fd,
                 (sockaddr *)&peers_info[i].address,
-                sizeof(sockaddr_storage)) != 0) {
+                sizeof(sockaddr_storage)) != 0 &&
+            errno != EINPROGRESS) {
           log_perror();
-          return false;
+          this->conns[i].needReconnect = true;
+          close(pollfds[i].fd);
+          pollfds[i].fd = -1;
         }
-        log_trace("called bind for listen socket");
+        log_trace("called connect for peer connection");
+
+        log_trace(
+            "calling set_non_blocking_socket for peer connection");
+        SET_NON_BLOCKING_SOCKET(pollfds[i].fd);
+        log_trace(
+            "called set_non_blocking_socket for peer connection");
 
-        log_trace("calling listen for listen socket");
-        if (listen(pfdw.pollfds[i].fd, SOMAXCONN) != 0) {
+        int const nodelay = 1;
+        log_trace("calling set_no_delay for peer connection");
+        if (pollfds[i].fd > 0 &&
+            FF_SET_NO_DELAY(pollfds[i].fd, &nodelay) != 0) {
           log_perror();
-          return false;
+          this->conns[i].needReconnect = true;
+          close(pollfds[i].fd);
+          pollfds[i].fd = 1;
         }
-        log_trace("called listen for listen socket");
-        pfdw.pollfds[i].events = FF_POLLIN;
+        log_trace("called set_no_delay for peer connection");
 
-        self_made = true;
-        conns[i].connected = true;
+        pollfds[i].events = FF_POLLIN | FF_POLLOUT;
+      } else {
+        log_info(
+            "peer %s will connect to me",
+            identity_to_string(peers_info[i].identity).c_str());
       }
     }
 
-    if (self_made == false) {
-      log_error("No accept socket for incoming connections");
-      return false;
-    }
+    return true;
   }
 
-  /* Step 3. open a connect socket for each peer_info with an identity less
-   * than self.
+  /**
+   * Polls the sockets once, for at most timeout milliseconds, passing
+   * each message read to receive. Returns the result of poll.
    */
-  log_info("has %zu peers", peers_info.size());
-  for (size_t i = 0; i < peers_info.size(); i++) {
-    if (peers_info[i].identity < self) {
-      log_trace("calling socket for peer connection");
-      pfdw.pollfds[i].fd = socket(AF_INET, SOCK_STREAM, 0);
-      if (pfdw.pollfds[i].fd < 0) {
-        log_perror();
-        conns[i].needReconnect = true;
-      }
-      log_trace("called socket for peer connection");
-
-      log_trace("calling connect for peer connection");
-      log_info(
-          "connecting to %s",
-          identity_to_string(peers_info[i].identity).c_str());
-      if (connect(
-              pfdw.pollfds[i].fd,
-              (sockaddr *)&peers_info[i].address,
-              sizeof(sockaddr_storage)) != 0 &&
-          errno != EINPROGRESS) {
-        log_perror();
-        conns[i].needReconnect = true;
-        close(pfdw.pollfds[i].fd);
-        pfdw.pollfds[i].fd = -1;
-      }
-      log_trace("called connect for peer connection");
-
-      log_trace("calling set_non_blocking_socket for peer connection");
-      SET_NON_BLOCKING_SOCKET(pfdw.pollfds[i].fd);
-      log_trace("called set_non_blocking_socket for peer connection");
-
-      int const nodelay = 1;
-      log_trace("calling set_no_delay for peer connection");
-      if (pfdw.pollfds[i].fd > 0 &&
-          FF_SET_NO_DELAY(pfdw.pollfds[i].fd, &nodelay) != 0) {
-        log_perror();
-        conns[i].needReconnect = true;
-        close(pfdw.pollfds[i].fd);
-        pfdw.pollfds[i].fd = 1;
-      }
-      log_trace("called set_no_delay for peer connection");
-
-      pfdw.pollfds[i].events = FF_POLLIN | FF_POLLOUT;
-    } else {
-      log_info(
-          "peer %s will connect to me",
-          identity_to_string(peers_info[i].identity).c_str());
-    }
-  }
-
-  /* Step 4. create the fronctocols manager, but do not init it. */
-  FronctocolsManager<
-      Identity_T,
-      PeerSet_T,
-      IncomingMessage<Identity_T>,
-      OutgoingMessage<Identity_T>>
-      fmanager(self);
+  int pollOnce(
+      int const timeout,
+      ::std::function<void(
+          ::std::unique_ptr<IncomingMessage<Identity_T>>)> const &
+          receive) {
+    ff_pollfd * const pollfds = this->pfdw.pollfds;
+    size_t const num_pollfds = this->numSockets;
+    ::std::vector<ConnectionHandler<Identity_T>> & conns = this->conns;
 
-  /* Step 5. begin the poll loop. */
-  bool connected = false; // all connections established.
-
-  log_debug("num_pollfds=%zu", pfdw.num_pollfds);
-
-  while (!fmanager.isClosed()) {
     log_trace("calling poll");
-    int num_ready = FF_POLL(pfdw.pollfds, pfdw.num_pollfds, 2000);
+    ::std::chrono::steady_clock::time_point const poll_start =
+        ::std::chrono::steady_clock::now();
+    int num_ready = FF_POLL(pollfds, this->pfdw.num_pollfds, timeout);
+    ::std::chrono::duration<double> const poll_time =
+        ::std::chrono::steady_clock::now() - poll_start;
+    this->metrics->pollTime += poll_time.count();
+    this->metrics->pollIterations++;
     log_trace("called poll");
 
     if (num_ready < 0) {
       log_perror();
-    } else if (num_ready == 0) {
-      if (fmanager.isFinished()) {
-        log_info("time out while waiting for peers to finish");
-      } else if (connected) {
-        log_info("time out while waiting for new messages");
-      } else {
-        log_info("time out while waiting for peers to connect");
-      }
     }
 
-    for (size_t i = 0; i < pfdw.num_pollfds; i++) {
+    for (size_t i = 0; i < num_pollfds; i++) {
       log_debug(
           "i=%zu, fd=%i, POLLIN=%i POLLOUT=%i",
           i,
-          pfdw.pollfds[i].fd,
-          pfdw.pollfds[i].events & FF_POLLIN,
-          pfdw.pollfds[i].events & FF_POLLOUT);
-      log_debug("Revents: %i", pfdw.pollfds[i].revents);
+          pollfds[i].fd,
+          pollfds[i].events & FF_POLLIN,
+          pollfds[i].events & FF_POLLOUT);
+      log_debug("Revents: %i", pollfds[i].revents);
 
       if (i >= conns.size()) {
         /* This is an incoming connection, ready to read the identity */
+        IncomingConnectionInitializer<Identity_T> & initer =
+            this->initers[i - conns.size()];
         bool fail = false;
-        if (pfdw.pollfds[i].revents & FF_POLLIN) {
+        if (pollfds[i].revents & FF_POLLIN) {
           log_debug("reading identity from new connection");
-          initers[i - conns.size()].readInput(&pfdw.pollfds[i], self);
-          if (initers[i - conns.size()].identityReady) {
-            Identity_T const & identity =
-                initers[i - conns.size()].peer;
+          initer.readInput(&pollfds[i], this->self);
+          if (initer.identityReady) {
+            Identity_T const & identity = initer.peer;
 
             size_t idx = 0;
             for (size_t j = 0; j < conns.size(); j++) {
@@ -1017,12 +1348,12 @@ bool runFortissimoPosixNet(
               }
             }
 
-            pfdw.pollfds[idx].fd = pfdw.pollfds[i].fd;
+            pollfds[idx].fd = pollfds[i].fd;
             conns[idx].connected = true;
             conns[idx].needReconnect = false;
-            pfdw.pollfds[i].fd = -1;
-            pfdw.pollfds[i].events = FF_POLLIN | FF_POLLOUT;
-            initers[i - conns.size()].reset();
+            pollfds[i].fd = -1;
+            pollfds[i].events = FF_POLLIN | FF_POLLOUT;
+            initer.reset();
 
             log_info(
                 "Incoming connection from %s established",
@@ -1030,127 +1361,317 @@ bool runFortissimoPosixNet(
           }
         }
         // POLLOUT should be disabled
-        if (pfdw.pollfds[i].revents & FF_POLLERR) {
+        if (pollfds[i].revents & FF_POLLERR) {
           log_error(
               "error while reading identity from new connection.");
           fail = true;
         }
-        if (pfdw.pollfds[i].revents & FF_POLLHUP) {
+        if (pollfds[i].revents & FF_POLLHUP) {
           log_error(
               "hang up while reading identity from new connection.");
           fail = true;
         }
 
         if (fail) {
-          close(pfdw.pollfds[i].fd);
-          pfdw.pollfds[i].fd = -1;
+          close(pollfds[i].fd);
+          pollfds[i].fd = -1;
         }
-      } else if (conns[i].peer == self) {
+      } else if (conns[i].peer == this->self) {
         /* This is a new incoming connection, ready to be accepted */
-        if (pfdw.pollfds[i].revents & FF_POLLIN) {
-          conns[i].acceptNewConn(pfdw.pollfds, pfdw.num_pollfds, conns);
+        if (pollfds[i].revents & FF_POLLIN) {
+          conns[i].acceptNewConn(pollfds, num_pollfds, conns);
         }
         // POLLOUT should be disabled
-        if (pfdw.pollfds[i].revents & FF_POLLERR) {
+        if (pollfds[i].revents & FF_POLLERR) {
           log_error(
               "error while reading identity from new connection.");
         }
-        if (pfdw.pollfds[i].revents & FF_POLLHUP) {
+        if (pollfds[i].revents & FF_POLLHUP) {
           log_error(
               "hang up while reading identity from new connection.");
         }
       } else // this is an outgoing connection awaiting to be established,
       // or an already established connection.
       {
-        if (pfdw.pollfds[i].revents & FF_POLLIN) {
+        if (pollfds[i].revents & FF_POLLIN) {
           log_debug("handling input");
           std::unique_ptr<IncomingMessage<Identity_T>> in_msg =
               conns[i].handleInput();
 
           if (in_msg != nullptr) {
             log_debug("got a message");
-            std::vector<std::unique_ptr<OutgoingMessage<Identity_T>>>
-                out_msgs;
-            fmanager.handleReceive(*in_msg, &out_msgs);
-            distribute(out_msgs);
+            receive(::std::move(in_msg));
           }
         }
-        if (pfdw.pollfds[i].revents & FF_POLLOUT) {
+        if (pollfds[i].revents & FF_POLLOUT) {
           log_debug(
               "handling output connected=%i, i=%zu",
               conns[i].connected,
               i);
-          conns[i].handleOutput(self);
+          conns[i].handleOutput(this->self);
         }
 
         bool failure = false;
-        if (pfdw.pollfds[i].revents & FF_POLLERR) {
+        if (pollfds[i].revents & FF_POLLERR) {
           log_error(
               "error while reading identity from new connection.");
           failure = true;
         }
-        if (pfdw.pollfds[i].revents & FF_POLLHUP) {
+        if (pollfds[i].revents & FF_POLLHUP) {
           log_error(
               "hang up while reading identity from new connection.");
           failure = true;
         }
 
         if (failure) {
-          close(pfdw.pollfds[i].fd);
-          pfdw.pollfds[i].fd = -1;
+          close(pollfds[i].fd);
+          pollfds[i].fd = -1;
           conns[i].needReconnect = true;
         }
       }
     }
 
-    /* check if all connections have been established for the first time. */
-    if (!connected) {
-      bool all_connected = true;
-      for (size_t i = 0; i < conns.size(); i++) {
-        log_debug("i=%zu, connected=%i", i, conns[i].connected);
-        if (!conns[i].connected) {
-          all_connected = false;
+#ifdef FF_HAS_PIPES
+    if (this->wakeFds[0] >= 0 &&
+        (pollfds[this->numSockets].revents & FF_POLLIN)) {
+      uint8_t buf[64];
+      while (read(this->wakeFds[0], buf, sizeof(buf)) > 0) {
+      }
+    }
+#endif
+
+    return num_ready;
+  }
+
+  /**
+   * Checks if all connections have been established for the first
+   * time. Returns true once, when they first are.
+   */
+  bool establish() {
+    if (this->connected) {
+      return false;
+    }
+
+    for (size_t i = 0; i < this->conns.size(); i++) {
+      log_debug("i=%zu, connected=%i", i, this->conns[i].connected);
+      if (!this->conns[i].connected) {
+        return false;
+      }
+    }
+
+    for (size_t i = 0; i < this->conns.size(); i++) {
+      this->pfdw.pollfds[i].events = FF_POLLIN;
+    }
+    this->connected = true;
+    return true;
+  }
+
+  bool isConnected() const {
+    return this->connected;
+  }
+
+  /**
+   * Checks for connections which need reconnections.
+   */
+  void reconnect() {
+    for (size_t i = 0; i < this->conns.size(); i++) {
+      if (this->conns[i].needReconnect) {
+        this->conns[i].attemptReconnect(this->self, this->peersInfo[i]);
+      }
+    }
+  }
+
+  /**
+   * Distributes outgoing messages to connections.
+   */
+  void send(
+      ::std::vector<::std::unique_ptr<OutgoingMessage<Identity_T>>> &
+          out_msgs) {
+    for (size_t i = 0; i < out_msgs.size(); i++) {
+      for (size_t j = 0; j < this->conns.size(); j++) {
+        log_assert(out_msgs[i] != nullptr);
+        if (out_msgs[i]->recipient == this->conns[j].peer) {
+          this->conns[j].enqueOutgoingMessage(::std::move(out_msgs[i]));
           break;
         }
       }
+    }
+  }
 
-      if (all_connected) {
-        log_info(
-            "All connections established, starting secure computation");
+  bool isOutgoingQueueEmpty() {
+    bool all_finished = true;
+    for (size_t i = 0; i < this->conns.size(); i++) {
+      all_finished =
+          all_finished && this->conns[i].isOutgoingQueueEmpty();
+    }
+    return all_finished;
+  }
 
-        for (size_t i = 0; i < conns.size(); i++) {
-          pfdw.pollfds[i].events = FF_POLLIN;
-        }
+  /**
+   * Copies the counters of each connection to metrics.
+   */
+  void collect() {
+    for (size_t i = 0; i < this->conns.size(); i++) {
+      if (!(this->conns[i].peer == this->self)) {
+        this->metrics->peers[this->conns[i].peer] =
+            this->conns[i].collectCounters();
+      }
+    }
+  }
 
-        PeerSet_T ps =
-            PeerInfos2PeerSet<Identity_T, PeerSet_T>(peers_info);
+  /**
+   * Lets each peer know that self is done, then waits for each peer to
+   * finish.
+   */
+  void closeConnections() {
+    ff_pollfd * const pollfds = this->pfdw.pollfds;
+    if (pollfds == nullptr) {
+      return;
+    }
 
-        ::std::vector<::std::unique_ptr<OutgoingMessage<Identity_T>>>
-            out_msgs;
-        fmanager.init(::std::move(mainFronctocol), ps, &out_msgs);
-        distribute(out_msgs);
-        connected = true;
+    for (size_t i = 0; i < this->numSockets; i++) {
+      shutdown(pollfds[i].fd, SHUT_WR);
+    }
+
+    for (size_t i = 0; i < this->numSockets; i++) {
+      if (pollfds[i].fd >= 0) {
+        ssize_t ret;
+        uint64_t data;
+        time_t start_time = time(nullptr);
+        do {
+          log_trace("calling recv for close");
+          ret = FF_RECV(
+              pollfds[i].fd, (void *)&data, sizeof(uint64_t), 0);
+          log_trace("called recv for close");
+
+          if (start_time + CLOSE_TIMEOUT < time(nullptr)) {
+            log_debug("timed out closing");
+            break;
+          }
+        } while (ret > 0 ||
+                 (ret < 0 && errno != EBADF && errno != ECONNRESET &&
+                  errno != ENOTCONN && errno != ENOTSOCK));
       }
     }
+  }
+};
+
+template<typename Identity_T, typename PeerSet_T>
+bool runFortissimoPosixNet(
+    std::unique_ptr<ff::Fronctocol<
+        Identity_T,
+        PeerSet_T,
+        IncomingMessage<Identity_T>,
+        OutgoingMessage<Identity_T>>> mainFronctocol,
+    std::vector<PeerInfo<Identity_T>> const & peers_info,
+    Identity_T const & self,
+    Metrics<Identity_T> * metrics,
+    MetricsDump const * dump) {
+  Metrics<Identity_T> local_metrics;
+  if (metrics == nullptr) {
+    metrics = &local_metrics;
+  }
+  *metrics = Metrics<Identity_T>();
 
-    /* Check for connections which need reconnections */
-    for (size_t i = 0; i < conns.size(); i++) {
-      if (conns[i].needReconnect) {
-        conns[i].attemptReconnect(self, peers_info[i]);
+  /* Open sockets to each peer. */
+  PeerMesh<Identity_T> mesh(peers_info, self, metrics);
+  if (!mesh.open()) {
+    return false;
+  }
+
+  /* Create the fronctocols manager, but do not init it. */
+  FronctocolsManager<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage<Identity_T>,
+      OutgoingMessage<Identity_T>>
+      fmanager(self);
+
+  using Clock = ::std::chrono::steady_clock;
+  auto seconds_since = [](Clock::time_point const start) -> double {
+    ::std::chrono::duration<double> const elapsed =
+        Clock::now() - start;
+    return elapsed.count();
+  };
+
+  /* Copies the counters of connections and the manager to metrics. */
+  auto collect = [&]() -> void {
+    mesh.collect();
+    metrics->fronctocols = fmanager.getNumFronctocols();
+    metrics->liveFronctocols = fmanager.getNumLiveFronctocols();
+  };
+
+  Clock::time_point next_dump = Clock::now();
+  auto dump_metrics = [&]() -> void {
+    collect();
+    writeMetricsDump(*dump, metrics->toPrometheus(self));
+    ::std::chrono::duration<double> const interval(dump->interval);
+    next_dump = Clock::now() +
+        ::std::chrono::duration_cast<Clock::duration>(interval);
+  };
+
+  /* Passes each incoming message to the manager. */
+  auto receive =
+      [&](::std::unique_ptr<IncomingMessage<Identity_T>> in_msg) {
+        std::vector<std::unique_ptr<OutgoingMessage<Identity_T>>>
+            out_msgs;
+        Clock::time_point const compute_start = Clock::now();
+        fmanager.handleReceive(*in_msg, &out_msgs);
+        metrics->computeTime += seconds_since(compute_start);
+        mesh.send(out_msgs);
+      };
+
+  /* Begin the poll loop. */
+  log_debug("beginning poll loop");
+
+  while (!fmanager.isClosed()) {
+    int timeout = 2000;
+    if (dump != nullptr && dump->interval > 0.0) {
+      int64_t const until_dump =
+          ::std::chrono::duration_cast<::std::chrono::milliseconds>(
+              next_dump - Clock::now())
+              .count();
+      timeout = (int)::std::max<int64_t>(
+          0, ::std::min<int64_t>(timeout, until_dump));
+    }
+
+    int num_ready = mesh.pollOnce(timeout, receive);
+    if (num_ready == 0) {
+      if (fmanager.isFinished()) {
+        log_info("time out while waiting for peers to finish");
+      } else if (mesh.isConnected()) {
+        log_info("time out while waiting for new messages");
+      } else {
+        log_info("time out while waiting for peers to connect");
       }
     }
 
+    if (mesh.establish()) {
+      log_info(
+          "All connections established, starting secure computation");
+
+      PeerSet_T ps =
+          PeerInfos2PeerSet<Identity_T, PeerSet_T>(peers_info);
+
+      ::std::vector<::std::unique_ptr<OutgoingMessage<Identity_T>>>
+          out_msgs;
+      Clock::time_point const compute_start = Clock::now();
+      fmanager.init(::std::move(mainFronctocol), ps, &out_msgs);
+      metrics->computeTime += seconds_since(compute_start);
+      mesh.send(out_msgs);
+    }
+
+    mesh.reconnect();
+
+    if (dump != nullptr && dump->interval > 0.0 &&
+        Clock::now() >= next_dump) {
+      dump_metrics();
+    }
+
     /* If the protocol was aborted, finish sending all messages, then
      * close. */
-    if (fmanager.isAborted()) {
-      bool all_finished = true;
-      for (size_t i = 0; i < conns.size(); i++) {
-        all_finished = all_finished && conns[i].isOutgoingQueueEmpty();
-      }
-
-      if (all_finished) {
-        break;
-      }
+    if (fmanager.isAborted() && mesh.isOutgoingQueueEmpty()) {
+      break;
     }
   }
 
@@ -1160,34 +1681,404 @@ bool runFortissimoPosixNet(
     log_info("Secure computation completed successfully");
   }
 
-  /* Let each peer know that I'm done. */
-  for (size_t i = 0; i < pfdw.num_pollfds; i++) {
-    shutdown(pfdw.pollfds[i].fd, SHUT_WR);
+  mesh.closeConnections();
+
+  collect();
+  if (dump != nullptr) {
+    dump_metrics();
   }
 
-  /* Wait for each peer to finish */
-  for (size_t i = 0; i < pfdw.num_pollfds; i++) {
-    if (pfdw.pollfds[i].fd >= 0) {
-      ssize_t ret;
-      uint64_t data;
-      time_t start_time = time(nullptr);
-      do {
-        log_trace("calling recv for close");
-        ret = FF_RECV(
-            pfdw.pollfds[i].fd, (void *)&data, sizeof(uint64_t), 0);
-        log_trace("called recv for close");
+  return fmanager.isClosed() && !fmanager.isAborted();
+}
 
-        if (start_time + CLOSE_TIMEOUT < time(nullptr)) {
-          log_debug("timed out closing");
-          break;
+template<typename Identity_T, typename PeerSet_T>
+SessionRunner<Identity_T, PeerSet_T>::SessionRunner(
+    ::std::vector<PeerInfo<Identity_T>> const & peers_info,
+    Identity_T const & self,
+    Executor * executor) :
+    self(self),
+    peers(PeerInfos2PeerSet<Identity_T, PeerSet_T>(peers_info)),
+    mesh(peers_info, self, &this->metrics),
+    executor(executor) {
+  if (this->executor != nullptr) {
+    this->canWake = this->mesh.enableWakeup();
+  }
+}
+
+template<typename Identity_T, typename PeerSet_T>
+SessionRunner<Identity_T, PeerSet_T>::~SessionRunner() {
+  this->close();
+}
+
+template<typename Identity_T, typename PeerSet_T>
+bool SessionRunner<Identity_T, PeerSet_T>::connect() {
+  if (!this->opened) {
+    this->opened = true;
+    this->failed = !this->mesh.open();
+  }
+  if (this->failed || this->closed) {
+    return false;
+  }
+
+  while (!this->mesh.isConnected()) {
+    this->step(2000);
+  }
+  return true;
+}
+
+template<typename Identity_T, typename PeerSet_T>
+bool SessionRunner<Identity_T, PeerSet_T>::start(
+    sessionId_t const id, ::std::unique_ptr<Fronctocol_T> main) {
+  if (this->sessions.count(id) != 0 ||
+      this->finishedIds.count(id) != 0) {
+    log_error("session %" PRIu64 " was already started", id);
+    return false;
+  }
+  if (!this->connect()) {
+    return false;
+  }
+
+  Session & session = this->sessions[id];
+  session.manager.reset(new Manager_T(this->self));
+  if (this->executor != nullptr) {
+    session.strand.reset(new Executor::Strand(*this->executor));
+
+    // Tasks count as in flight until they resume, so the session
+    // outlives them.
+    Manager_T * const manager = session.manager.get();
+    Executor::Strand * const strand = session.strand.get();
+    session.manager->setOffloader(
+        [this, id, manager, strand](
+            ::std::function<void()> task, size_t const compute_id) {
+          this->executor->post(
+              [this, id, manager, strand, task, compute_id]() {
+                task();
+                this->post(
+                    id,
+                    *manager,
+                    *strand,
+                    [compute_id](
+                        Manager_T & m, OutgoingMessages_T * out_msgs) {
+                      m.handleComputed(compute_id, out_msgs);
+                    });
+              });
+        });
+  }
+
+  // std::function must be copyable, so main is shared until init.
+  ::std::shared_ptr<::std::unique_ptr<Fronctocol_T>> const shared_main(
+      new ::std::unique_ptr<Fronctocol_T>(::std::move(main)));
+  PeerSet_T const & peers = this->peers;
+  this->dispatch(
+      id,
+      session,
+      [shared_main, &peers](
+          Manager_T & manager, OutgoingMessages_T * out_msgs) {
+        manager.init(::std::move(*shared_main), peers, out_msgs);
+      });
+
+  /* Deliver messages which arrived before this session started. */
+  typename ::std::map<
+      sessionId_t,
+      ::std::vector<::std::unique_ptr<IncomingMessage<Identity_T>>>>::
+      iterator pending = this->pending.find(id);
+  if (pending != this->pending.end()) {
+    ::std::vector<::std::unique_ptr<IncomingMessage<Identity_T>>> msgs =
+        ::std::move(pending->second);
+    this->pending.erase(pending);
+    this->numPending -= msgs.size();
+    for (::std::unique_ptr<IncomingMessage<Identity_T>> & msg : msgs) {
+      this->deliver(id, ::std::move(msg));
+    }
+  }
+
+  return true;
+}
+
+template<typename Identity_T, typename PeerSet_T>
+void SessionRunner<Identity_T, PeerSet_T>::poll(int const timeout) {
+  if (this->connect()) {
+    this->step(timeout);
+  }
+}
+
+template<typename Identity_T, typename PeerSet_T>
+bool SessionRunner<Identity_T, PeerSet_T>::run() {
+  size_t const failures = this->numFailed;
+  if (!this->connect()) {
+    return false;
+  }
+  while (!this->sessions.empty()) {
+    this->step(2000);
+  }
+  return failures == this->numFailed;
+}
+
+template<typename Identity_T, typename PeerSet_T>
+size_t SessionRunner<Identity_T, PeerSet_T>::numActive() const {
+  return this->sessions.size();
+}
+
+template<typename Identity_T, typename PeerSet_T>
+::std::map<sessionId_t, bool>
+SessionRunner<Identity_T, PeerSet_T>::takeResults() {
+  ::std::map<sessionId_t, bool> ret;
+  ret.swap(this->results);
+  return ret;
+}
+
+template<typename Identity_T, typename PeerSet_T>
+Metrics<Identity_T> const &
+SessionRunner<Identity_T, PeerSet_T>::getMetrics() {
+  this->mesh.collect();
+  this->metrics.fronctocols = this->finishedFronctocols;
+  this->metrics.liveFronctocols = 0;
+  for (::std::pair<sessionId_t const, Session> const & session :
+       this->sessions) {
+    this->metrics.fronctocols += session.second.fronctocols;
+    this->metrics.liveFronctocols += session.second.liveFronctocols;
+  }
+  return this->metrics;
+}
+
+template<typename Identity_T, typename PeerSet_T>
+void SessionRunner<Identity_T, PeerSet_T>::close() {
+  if (!this->opened || this->failed || this->closed) {
+    return;
+  }
+
+  if (!this->sessions.empty()) {
+    log_warn(
+        "closing connections with %zu sessions running",
+        this->sessions.size());
+  }
+
+  /* Wait for work on the executor, as it refers to this. */
+  while (this->numInFlight() > 0) {
+    this->step(100);
+  }
+
+  /* Finish sending all messages, then close. */
+  time_t const start_time = time(nullptr);
+  while (!this->mesh.isOutgoingQueueEmpty() &&
+         start_time + CLOSE_TIMEOUT >= time(nullptr)) {
+    this->step(100);
+  }
+  this->mesh.closeConnections();
+  this->closed = true;
+}
+
+template<typename Identity_T, typename PeerSet_T>
+void SessionRunner<Identity_T, PeerSet_T>::step(int const timeout) {
+  int poll_timeout = timeout;
+  if (!this->canWake && this->numInFlight() > 0) {
+    // Nothing will interrupt poll when work finishes.
+    poll_timeout = ::std::min(poll_timeout, 1);
+  }
+
+  int const num_ready = this->mesh.pollOnce(
+      poll_timeout,
+      [this](::std::unique_ptr<IncomingMessage<Identity_T>> in_msg) {
+        uint8_t id_buf[sizeof(uint64_t)];
+        if (in_msg->remove(id_buf, sizeof(uint64_t)) !=
+            sizeof(uint64_t)) {
+          log_error("received a message without a session ID");
+          return;
         }
-      } while (ret > 0 ||
-               (ret < 0 && errno != EBADF && errno != ECONNRESET &&
-                errno != ENOTCONN && errno != ENOTSOCK));
+        this->deliver(buffer_to_uint64(id_buf), ::std::move(in_msg));
+      });
+
+  if (num_ready == 0 && this->numInFlight() == 0) {
+    if (this->mesh.isConnected()) {
+      log_info("time out while waiting for new messages");
+    } else {
+      log_info("time out while waiting for peers to connect");
     }
   }
 
-  return fmanager.isClosed() && !fmanager.isAborted();
+  if (this->mesh.establish()) {
+    log_info("All connections established, ready for sessions");
+  }
+
+  this->mesh.reconnect();
+
+  if (this->executor != nullptr) {
+    ::std::vector<Completion> completions;
+    {
+      ::std::lock_guard<::std::mutex> lock(this->completionsMutex);
+      completions.swap(this->completions);
+    }
+    for (Completion & completion : completions) {
+      this->complete(completion);
+    }
+  }
+}
+
+template<typename Identity_T, typename PeerSet_T>
+void SessionRunner<Identity_T, PeerSet_T>::deliver(
+    sessionId_t const id,
+    ::std::unique_ptr<IncomingMessage<Identity_T>> in_msg) {
+  typename ::std::map<sessionId_t, Session>::iterator finder =
+      this->sessions.find(id);
+  if (finder == this->sessions.end()) {
+    if (this->finishedIds.count(id) != 0) {
+      log_warn("dropping a message for finished session %" PRIu64, id);
+      return;
+    }
+
+    ::std::vector<::std::unique_ptr<IncomingMessage<Identity_T>>> &
+        held = this->pending[id];
+    if (held.size() >= MAX_PENDING_PER_SESSION ||
+        this->numPending >= MAX_PENDING_MESSAGES) {
+      log_warn(
+          "dropping a message for session %" PRIu64
+          ", %zu messages are held for it and %zu in total",
+          id,
+          held.size(),
+          this->numPending);
+      if (held.empty()) {
+        this->pending.erase(id);
+      }
+      return;
+    }
+    log_debug("holding a message for session %" PRIu64, id);
+    held.push_back(::std::move(in_msg));
+    this->numPending++;
+    return;
+  }
+
+  ::std::shared_ptr<IncomingMessage<Identity_T>> const shared_msg(
+      in_msg.release());
+  this->dispatch(
+      id,
+      finder->second,
+      [shared_msg](Manager_T & manager, OutgoingMessages_T * out_msgs) {
+        manager.handleReceive(*shared_msg, out_msgs);
+      });
+}
+
+template<typename Identity_T, typename PeerSet_T>
+void SessionRunner<Identity_T, PeerSet_T>::dispatch(
+    sessionId_t const id, Session & session, Work const & work) {
+  if (this->executor == nullptr) {
+    Completion completion = runWork(id, *session.manager, work);
+    this->complete(completion);
+    return;
+  }
+
+  session.inFlight++;
+  this->post(id, *session.manager, *session.strand, work);
+}
+
+template<typename Identity_T, typename PeerSet_T>
+void SessionRunner<Identity_T, PeerSet_T>::post(
+    sessionId_t const id,
+    Manager_T & manager,
+    Executor::Strand & strand,
+    Work const & work) {
+  Manager_T * const m = &manager;
+  strand.post([this, id, m, work]() {
+    Completion completion = runWork(id, *m, work);
+    {
+      ::std::lock_guard<::std::mutex> lock(this->completionsMutex);
+      this->completions.push_back(::std::move(completion));
+    }
+    this->mesh.wake();
+  });
+}
+
+template<typename Identity_T, typename PeerSet_T>
+typename SessionRunner<Identity_T, PeerSet_T>::Completion
+SessionRunner<Identity_T, PeerSet_T>::runWork(
+    sessionId_t const id, Manager_T & manager, Work const & work) {
+  Completion completion;
+  completion.id = id;
+  if (manager.isClosed() || manager.isAborted()) {
+    log_warn("dropping a message for finished session %" PRIu64, id);
+  } else {
+    ::std::chrono::steady_clock::time_point const compute_start =
+        ::std::chrono::steady_clock::now();
+    work(manager, &completion.outMsgs);
+    ::std::chrono::duration<double> const compute_time =
+        ::std::chrono::steady_clock::now() - compute_start;
+    completion.computeTime = compute_time.count();
+  }
+  completion.closed = manager.isClosed();
+  completion.aborted = manager.isAborted();
+  completion.fronctocols = manager.getNumFronctocols();
+  completion.liveFronctocols = manager.getNumLiveFronctocols();
+  completion.offloaded = manager.getNumOffloaded();
+  return completion;
+}
+
+template<typename Identity_T, typename PeerSet_T>
+void SessionRunner<Identity_T, PeerSet_T>::complete(
+    Completion & completion) {
+  sessionId_t const id = completion.id;
+  this->metrics.computeTime += completion.computeTime;
+  this->send(id, completion.outMsgs);
+
+  typename ::std::map<sessionId_t, Session>::iterator finder =
+      this->sessions.find(id);
+  log_assert(finder != this->sessions.end());
+  Session & session = finder->second;
+  if (this->executor != nullptr) {
+    // Each compute task is in flight from the work which offloaded it
+    // until the work which resumes it. The former always completes
+    // first, since both are on the session's strand.
+    session.inFlight--;
+    session.inFlight += completion.offloaded - session.offloaded;
+    session.offloaded = completion.offloaded;
+  }
+  session.fronctocols = completion.fronctocols;
+  session.liveFronctocols = completion.liveFronctocols;
+
+  if (!session.finished && (completion.closed || completion.aborted)) {
+    bool const success = completion.closed && !completion.aborted;
+    if (success) {
+      log_info("session %" PRIu64 " completed successfully", id);
+    } else {
+      log_error("session %" PRIu64 " finished unsuccessfully", id);
+      this->numFailed++;
+    }
+    this->results[id] = success;
+    this->finishedIds.insert(id);
+    this->finishedOrder.push_back(id);
+    if (this->finishedOrder.size() > MAX_FINISHED_SESSION_IDS) {
+      this->finishedIds.erase(this->finishedOrder.front());
+      this->finishedOrder.pop_front();
+    }
+    session.finished = true;
+  }
+
+  if (session.finished && session.inFlight == 0) {
+    this->finishedFronctocols += session.fronctocols;
+    this->sessions.erase(finder);
+  }
+}
+
+template<typename Identity_T, typename PeerSet_T>
+size_t SessionRunner<Identity_T, PeerSet_T>::numInFlight() const {
+  size_t in_flight = 0;
+  for (::std::pair<sessionId_t const, Session> const & session :
+       this->sessions) {
+    in_flight += session.second.inFlight;
+  }
+  return in_flight;
+}
+
+template<typename Identity_T, typename PeerSet_T>
+void SessionRunner<Identity_T, PeerSet_T>::send(
+    sessionId_t const id,
+    ::std::vector<::std::unique_ptr<OutgoingMessage<Identity_T>>> &
+        out_msgs) {
+  uint8_t id_buf[sizeof(uint64_t)];
+  uint64_to_buffer(id, id_buf);
+  for (::std::unique_ptr<OutgoingMessage<Identity_T>> & out_msg :
+       out_msgs) {
+    out_msg->prepend(id_buf, sizeof(uint64_t));
+  }
+  this->mesh.send(out_msgs);
 }
 
 } // namespace posixnet
@@ -10,6 +10,7 @@
 #include <netinet/tcp.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/un.h>
 #include <unistd.h>
 
 #ifndef FF_POSIX_NET_POSIX_H_
@@ -41,4 +42,7 @@
 #define FF_POLLERR POLLERR
 #define FF_POLLHUP POLLHUP
 
+#define FF_HAS_UNIX_SOCKETS 1
+#define FF_HAS_PIPES 1
+
 #endif // FF_POSIX_NET_POSIX_H_
@@ -20,6 +20,7 @@
 /* Fortissimo Headers */
 #include <ff/Fronctocol.h>
 #include <ff/FronctocolsManager.h>
+#include <ff/Profiler.h>
 
 /* logging configuration */
 #include <ff/logging.h>
@@ -30,9 +31,31 @@
 namespace ff {
 namespace tester {
 
+/**
+ * Counters collected over one runTests invocation.
+ *
+ * A message's round is one more than the round of the message whose
+ * receipt caused it to be sent, with messages sent from init() in
+ * round 1. rounds is the longest such chain observed.
+ *
+ * If profile is set before the run, each participant's manager is
+ * profiled into profilers.
+ */
+template<typename Identity_T>
+struct RunStats {
+  size_t messages = 0;
+  size_t bytes = 0;
+  size_t rounds = 0;
+  ::std::map<Identity_T, size_t> bytesBySender;
+
+  bool profile = false;
+  ::std::map<Identity_T, Profiler> profilers;
+};
+
 /**
  * Returns true if all FronctocolsManagers report no errors (isAborted is
- * false).
+ * false). If stats is not null, it is filled with the counters for this
+ * run.
  */
 template<
     typename Identity_T,
@@ -50,7 +73,8 @@ bool runTests(
     ::std::function<::std::unique_ptr<IncomingMessage_T>(
         Identity_T const & sender, OutgoingMessage_T & omsg)> &
         converter,
-    uint64_t seed);
+    uint64_t seed,
+    RunStats<Identity_T> * stats = nullptr);
 
 /**
  * Returns true if all FronctocolsManagers report no errors (isAborted is
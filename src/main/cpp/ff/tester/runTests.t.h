@@ -18,7 +18,8 @@ bool runTests(
     ::std::function<::std::unique_ptr<IncomingMessage_T>(
         Identity_T const & sender, OutgoingMessage_T & omsg)> &
         converter,
-    uint64_t seed) {
+    uint64_t seed,
+    RunStats<Identity_T> * stats) {
   log_info("Running Tests with seed %lu", seed);
 
   // One FronctocolsManager per participant
@@ -31,9 +32,11 @@ bool runTests(
           OutgoingMessage_T>>
       managers;
   // One queue of messages between each pair of peers (sender, recipient)
+  // each tagged with the round in which it was sent.
   ::std::map<
       ::std::pair<Identity_T, Identity_T>,
-      ::std::deque<::std::unique_ptr<OutgoingMessage_T>>>
+      ::std::deque<
+          ::std::pair<size_t, ::std::unique_ptr<OutgoingMessage_T>>>>
       msgs;
   // List of all pairs of peers (sender, recipient),
   // (easy to choose one at random).
@@ -58,7 +61,8 @@ bool runTests(
   };
   auto distributor =
       [&](::std::vector<::std::unique_ptr<OutgoingMessage_T>> & omsgs,
-          Identity_T const & sender) -> void {
+          Identity_T const & sender,
+          size_t const round) -> void {
     for (::std::unique_ptr<OutgoingMessage_T> & msg : omsgs) {
       Identity_T const & recipient = msg->recipient;
       ::std::pair<Identity_T, Identity_T> const & pair =
@@ -67,7 +71,16 @@ bool runTests(
           "Distributing message from %s to %s",
           identity_to_string(sender).c_str(),
           identity_to_string(recipient).c_str());
-      msgs.find(pair)->second.push_back(::std::move(msg));
+      if (stats != nullptr) {
+        size_t const len = msg->length();
+        stats->messages++;
+        stats->bytes += len;
+        stats->bytesBySender[sender] += len;
+        if (round > stats->rounds) {
+          stats->rounds = round;
+        }
+      }
+      msgs.find(pair)->second.emplace_back(round, ::std::move(msg));
       n_msgs++;
 
       log_assert(msgs.size() == identity_pairs.size());
@@ -93,8 +106,8 @@ bool runTests(
                  OutgoingMessage_T>>> & receiver_pair : tests) {
       Identity_T const & receiver_identity = receiver_pair.first;
       identity_pairs.emplace_back(sender_identity, receiver_identity);
-      msgs[identity_pairs.back()] =
-          ::std::deque<::std::unique_ptr<OutgoingMessage_T>>();
+      msgs[identity_pairs.back()] = ::std::deque<
+          ::std::pair<size_t, ::std::unique_ptr<OutgoingMessage_T>>>();
       log_debug(
           "identity pair from %s to %s",
           identity_to_string(identity_pairs.back().first).c_str(),
@@ -128,6 +141,14 @@ bool runTests(
             IncomingMessage_T,
             OutgoingMessage_T>(test_identity)));
 
+    if (stats != nullptr && stats->profile) {
+      stats->profilers.erase(test_identity);
+      stats->profilers.emplace(
+          test_identity, Profiler(identity_to_string(test_identity)));
+      Profiler & profiler = stats->profilers.find(test_identity)->second;
+      managers.find(test_identity)->second.setProfiler(&profiler);
+    }
+
     // Retrieve the manager from the map, and invoke init()
     ::std::vector<::std::unique_ptr<OutgoingMessage_T>> omsgs;
     typename ::std::map<
@@ -145,7 +166,7 @@ bool runTests(
         &omsgs);
 
     size_t prevnmsgs = n_msgs;
-    distributor(omsgs, test_identity);
+    distributor(omsgs, test_identity, 1);
     log_assert(n_msgs == prevnmsgs + omsgs.size());
     (void)prevnmsgs;
   }
@@ -169,7 +190,9 @@ bool runTests(
         identity_pairs[pair_id];
     typename ::std::map<
         ::std::pair<Identity_T, Identity_T>,
-        ::std::deque<::std::unique_ptr<OutgoingMessage_T>>>::iterator
+        ::std::deque<::std::pair<
+            size_t,
+            ::std::unique_ptr<OutgoingMessage_T>>>>::iterator
         pair_finder = msgs.find(pair);
     log_assert(
         pair_finder != msgs.end(),
@@ -183,8 +206,9 @@ bool runTests(
           identity_to_string(pair.first).c_str(),
           identity_to_string(pair.second).c_str());
       // find the message, manager, and other setups.
+      size_t const round = pair_finder->second.front().first;
       ::std::unique_ptr<OutgoingMessage_T> sent_msg =
-          ::std::move(pair_finder->second.front());
+          ::std::move(pair_finder->second.front().second);
       pair_finder->second.pop_front();
       n_msgs--;
       typename ::std::map<
@@ -203,7 +227,7 @@ bool runTests(
       LOG_ORGANIZATION = identity_to_string(finder->first);
       ::std::vector<std::unique_ptr<OutgoingMessage_T>> omsgs;
       finder->second.handleReceive(*read_msg, &omsgs);
-      distributor(omsgs, pair.second);
+      distributor(omsgs, pair.second, round + 1);
     }
   }
 
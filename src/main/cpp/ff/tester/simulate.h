@@ -0,0 +1,143 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <ff/Fronctocol.h>
+#include <ff/FronctocolsManager.h>
+#include <ff/tester/runTests.h>
+
+/* logging configuration */
+#include <ff/logging.h>
+
+#ifndef FF_TEST_SIMULATE_H_
+#define FF_TEST_SIMULATE_H_
+
+namespace ff {
+namespace tester {
+
+/**
+ * Timing of a one-directional link between two participants. Times are
+ * in seconds of simulated time.
+ */
+struct LinkModel {
+  /* Delay from the end of transmission to delivery. */
+  double latency = 0.0;
+
+  /* Bytes per second, or 0 for unlimited bandwidth. */
+  double bandwidth = 0.0;
+
+  /* Upper bound of an additional, uniformly random, delay. */
+  double jitter = 0.0;
+};
+
+/**
+ * Describes the simulated network. Links not listed in links use
+ * defaultLink, and messages to oneself are delivered instantly.
+ */
+template<typename Identity_T>
+struct NetworkModel {
+  LinkModel defaultLink;
+  ::std::map<::std::pair<Identity_T, Identity_T>, LinkModel> links;
+
+  /**
+   * When true, the real time each participant spends handling a message
+   * is added to its simulated clock. Otherwise computation is free.
+   */
+  bool chargeCompute = false;
+
+  /* Seed for jitter. */
+  uint64_t seed = 0;
+
+  LinkModel const &
+  link(Identity_T const & sender, Identity_T const & recipient) const;
+};
+
+/**
+ * Results of a simulated run.
+ */
+template<typename Identity_T>
+struct SimStats {
+  struct Link {
+    size_t messages = 0;
+    size_t bytes = 0;
+
+    /* Simulated time spent transmitting. */
+    double busyTime = 0.0;
+  };
+
+  /* Simulated time at which the last participant went idle. */
+  double wallTime = 0.0;
+
+  /* Longest chain of messages, as in RunStats. */
+  size_t rounds = 0;
+
+  size_t messages = 0;
+  size_t bytes = 0;
+  ::std::map<::std::pair<Identity_T, Identity_T>, Link> links;
+
+  /**
+   * Fraction of the wall time which the link spent transmitting.
+   */
+  double utilization(
+      Identity_T const & sender, Identity_T const & recipient) const;
+
+  /**
+   * Highest utilization of any link.
+   */
+  double maxUtilization() const;
+};
+
+/**
+ * Runs the tests as runTests does, but delivers messages in order of a
+ * simulated clock rather than at random. Each message is transmitted
+ * after the link's earlier messages, at the link's bandwidth, and is
+ * delivered after its latency and jitter. Messages on a link are
+ * delivered in the order they were sent.
+ *
+ * Returns true if all FronctocolsManagers report no errors (isAborted
+ * is false). If stats is not null, it is filled with the results.
+ */
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+bool simulateTests(
+    ::std::map<
+        Identity_T,
+        ::std::unique_ptr<Fronctocol<
+            Identity_T,
+            PeerSet_T,
+            IncomingMessage_T,
+            OutgoingMessage_T>>> & tests,
+    ::std::function<::std::unique_ptr<IncomingMessage_T>(
+        Identity_T const & sender, OutgoingMessage_T & omsg)> &
+        converter,
+    NetworkModel<Identity_T> const & model,
+    SimStats<Identity_T> * stats = nullptr);
+
+#include <ff/tester/simulate.t.h>
+
+} // namespace tester
+} // namespace ff
+
+#define LOG_UNCLUDE
+#include <ff/logging.h>
+
+#endif // FF_TEST_SIMULATE_H_
@@ -0,0 +1,235 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+template<typename Identity_T>
+LinkModel const & NetworkModel<Identity_T>::link(
+    Identity_T const & sender, Identity_T const & recipient) const {
+  static LinkModel const instant;
+  if (sender == recipient) {
+    return instant;
+  }
+
+  typename ::std::map<::std::pair<Identity_T, Identity_T>, LinkModel>::
+      const_iterator finder =
+          this->links.find(::std::make_pair(sender, recipient));
+  if (finder != this->links.end()) {
+    return finder->second;
+  }
+  return this->defaultLink;
+}
+
+template<typename Identity_T>
+double SimStats<Identity_T>::utilization(
+    Identity_T const & sender, Identity_T const & recipient) const {
+  typename ::std::map<::std::pair<Identity_T, Identity_T>, Link>::
+      const_iterator finder =
+          this->links.find(::std::make_pair(sender, recipient));
+  if (finder == this->links.end() || this->wallTime <= 0.0) {
+    return 0.0;
+  }
+  return finder->second.busyTime / this->wallTime;
+}
+
+template<typename Identity_T>
+double SimStats<Identity_T>::maxUtilization() const {
+  double max = 0.0;
+  for (::std::pair<
+           ::std::pair<Identity_T, Identity_T> const,
+           Link> const & link : this->links) {
+    if (this->wallTime > 0.0) {
+      max = ::std::max(max, link.second.busyTime / this->wallTime);
+    }
+  }
+  return max;
+}
+
+template<
+    typename Identity_T,
+    typename PeerSet_T,
+    typename IncomingMessage_T,
+    typename OutgoingMessage_T>
+bool simulateTests(
+    ::std::map<
+        Identity_T,
+        ::std::unique_ptr<Fronctocol<
+            Identity_T,
+            PeerSet_T,
+            IncomingMessage_T,
+            OutgoingMessage_T>>> & tests,
+    ::std::function<::std::unique_ptr<IncomingMessage_T>(
+        Identity_T const & sender, OutgoingMessage_T & omsg)> &
+        converter,
+    NetworkModel<Identity_T> const & model,
+    SimStats<Identity_T> * stats) {
+  log_info("Simulating Tests with seed %lu", model.seed);
+
+  using Manager_T = FronctocolsManager<
+      Identity_T,
+      PeerSet_T,
+      IncomingMessage_T,
+      OutgoingMessage_T>;
+
+  // A message in flight, to be delivered at time.
+  struct Event {
+    double time;
+    uint64_t sequence;
+    size_t round;
+    Identity_T sender;
+    ::std::unique_ptr<OutgoingMessage_T> msg;
+  };
+  // Orders the heap so that the earliest event is on top. Sequence
+  // breaks ties in the order messages were sent.
+  auto later = [](Event const & a, Event const & b) -> bool {
+    return a.time > b.time ||
+        (a.time == b.time && a.sequence > b.sequence);
+  };
+
+  // Transmission state of each link.
+  struct LinkState {
+    double busyUntil = 0.0;
+    double lastArrival = 0.0;
+  };
+
+  ::std::map<Identity_T, Manager_T> managers;
+  ::std::map<Identity_T, double> clocks;
+  ::std::map<::std::pair<Identity_T, Identity_T>, LinkState> linkStates;
+  ::std::vector<Event> events;
+  uint64_t sequence = 0;
+
+  ::std::mt19937_64 rng(model.seed);
+  ::std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+  SimStats<Identity_T> local_stats;
+  if (stats == nullptr) {
+    stats = &local_stats;
+  }
+  *stats = SimStats<Identity_T>();
+
+  auto send = [&](::std::vector<::std::unique_ptr<OutgoingMessage_T>> &
+                      omsgs,
+                  Identity_T const & sender,
+                  double const time,
+                  size_t const round) -> void {
+    for (::std::unique_ptr<OutgoingMessage_T> & msg : omsgs) {
+      ::std::pair<Identity_T, Identity_T> const pair(
+          sender, msg->recipient);
+      LinkModel const & link = model.link(sender, msg->recipient);
+      LinkState & state = linkStates[pair];
+      typename SimStats<Identity_T>::Link & link_stats =
+          stats->links[pair];
+      size_t const len = msg->length();
+
+      double const start = ::std::max(time, state.busyUntil);
+      double const transmit = (link.bandwidth > 0.0) ?
+          static_cast<double>(len) / link.bandwidth :
+          0.0;
+      state.busyUntil = start + transmit;
+      double const jitter =
+          (link.jitter > 0.0) ? link.jitter * unit(rng) : 0.0;
+      double const arrival = ::std::max(
+          state.busyUntil + link.latency + jitter, state.lastArrival);
+      state.lastArrival = arrival;
+
+      link_stats.messages++;
+      link_stats.bytes += len;
+      link_stats.busyTime += transmit;
+      stats->messages++;
+      stats->bytes += len;
+      stats->rounds = ::std::max(stats->rounds, round);
+
+      events.push_back(
+          Event{arrival, sequence++, round, sender, ::std::move(msg)});
+      ::std::push_heap(events.begin(), events.end(), later);
+    }
+  };
+
+  // Runs one step of a participant at the given simulated time, and
+  // returns the time at which it finished.
+  auto step = [&](Identity_T const & self,
+                  double const time,
+                  ::std::function<void()> const & work) -> double {
+    double & clock = clocks[self];
+    double const start = ::std::max(time, clock);
+    ::std::chrono::steady_clock::time_point const before =
+        ::std::chrono::steady_clock::now();
+    work();
+    ::std::chrono::duration<double> const elapsed =
+        ::std::chrono::steady_clock::now() - before;
+    clock = start + (model.chargeCompute ? elapsed.count() : 0.0);
+    stats->wallTime = ::std::max(stats->wallTime, clock);
+    return clock;
+  };
+
+  PeerSet_T const peers =
+      makeTestPeerSet<Identity_T, PeerSet_T>(tests);
+
+  for (::std::pair<
+           Identity_T const,
+           ::std::unique_ptr<Fronctocol<
+               Identity_T,
+               PeerSet_T,
+               IncomingMessage_T,
+               OutgoingMessage_T>>> & test_pair : tests) {
+    Identity_T const & test_identity = test_pair.first;
+    LOG_ORGANIZATION = identity_to_string(test_identity);
+
+    managers.insert(::std::pair<Identity_T, Manager_T>(
+        test_identity, Manager_T(test_identity)));
+    Manager_T & manager = managers.find(test_identity)->second;
+
+    ::std::vector<::std::unique_ptr<OutgoingMessage_T>> omsgs;
+    double const done = step(test_identity, 0.0, [&]() {
+      manager.init(::std::move(test_pair.second), peers, &omsgs);
+    });
+    send(omsgs, test_identity, done, 1);
+  }
+
+  while (!events.empty()) {
+    ::std::pop_heap(events.begin(), events.end(), later);
+    Event event = ::std::move(events.back());
+    events.pop_back();
+
+    Identity_T const & recipient = event.msg->recipient;
+    typename ::std::map<Identity_T, Manager_T>::iterator finder =
+        managers.find(recipient);
+    log_assert(finder != managers.end());
+
+    log_debug(
+        "Delivering message from %s to %s at %f",
+        identity_to_string(event.sender).c_str(),
+        identity_to_string(recipient).c_str(),
+        event.time);
+    ::std::unique_ptr<IncomingMessage_T> read_msg =
+        converter(event.sender, *event.msg);
+
+    LOG_ORGANIZATION = identity_to_string(finder->first);
+    ::std::vector<::std::unique_ptr<OutgoingMessage_T>> omsgs;
+    double const done = step(finder->first, event.time, [&]() {
+      finder->second.handleReceive(*read_msg, &omsgs);
+    });
+    send(omsgs, finder->first, done, event.round + 1);
+  }
+
+  bool ret = true;
+  for (::std::pair<Identity_T const, Manager_T> const & manager :
+       managers) {
+    if (manager.second.isAborted()) {
+      return false;
+    }
+
+    ret = ret && manager.second.isFinished();
+  }
+
+  if (!ret) {
+    log_error("Simulator has no more messages to deliver, but "
+              "FronctocolsManagers does not report as finished. This "
+              "probably indicates a deadlock condition");
+
+#ifdef ADD_FAILURE
+    ADD_FAILURE();
+#endif
+  }
+
+  return ret;
+}
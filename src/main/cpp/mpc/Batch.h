@@ -8,8 +8,8 @@
 /* C and POSIX Headers */
 
 /* C++ Headers */
-#include <deque>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -19,6 +19,7 @@
 #include <ff/Actions.h>
 #include <ff/Fronctocol.h>
 #include <ff/Message.h>
+#include <ff/Promise.h>
 
 #include <mpc/templates.h>
 
@@ -28,28 +29,49 @@
 namespace ff {
 namespace mpc {
 
+/**
+ * A Batch of promised sub-fronctocols is itself promised. The results
+ * stay with the sub-fronctocols, so the Batch's own result is empty.
+ */
+struct BatchResult {};
+
 /**
  * A fronctocol which batches many sub-fronctocols to minimize overhead.
  * A condition of this batching is that all sub-fronctocols have the same
- * "pattern" of sends, recieves, invokes, and completes.
+ * "pattern" of sends, recieves, invokes, promises, awaits, and
+ * completes. Children may only await promises made in the same Batch.
  *
  * A batched fronctocol should not expect, in handleReceive, that msg.length()
  * decreases all the way to zero. The same message is given to each child,
  * thus it decreases until on the last child it should reach zero.
  */
 template<FF_TYPENAMES>
-struct Batch : public Fronctocol<FF_TYPES> {
+struct Batch : public PromiseFronctocol<FF_TYPES, BatchResult> {
 private:
-  bool checkFirstLastActionTypes(
-      ::std::deque<::std::vector<::std::unique_ptr<Action<FF_TYPES>>>> &
-          actions);
+  bool checkFirstLastActionTypes(size_t const last);
 
-  void handleActions(
-      ::std::deque<::std::vector<::std::unique_ptr<Action<FF_TYPES>>>> &
-          actions);
+  template<typename F>
+  bool runChildren(F const & f);
+  void handleActions();
 
   ::std::unique_ptr<FronctocolHandler<FF_TYPES>> batchHandler = nullptr;
 
+  /**
+   * Actions of each child in the current round. The outer and inner
+   * vectors are kept between rounds to reuse their storage.
+   */
+  ::std::vector<::std::vector<::std::unique_ptr<Action<FF_TYPES>>>>
+      childActions;
+
+  /**
+   * Sub-batches of promised children which are not yet handled.
+   */
+  struct PromisedBatch {
+    Batch<FF_TYPES> * batch;
+    ::std::unique_ptr<Promise<FF_TYPES, BatchResult>> promise;
+  };
+  ::std::vector<PromisedBatch> promisedBatches;
+
 public:
   virtual ::std::string name() override;
 
@@ -16,17 +16,15 @@ template<FF_TYPENAMES>
 }
 
 template<FF_TYPENAMES>
-bool Batch<FF_TYPES>::checkFirstLastActionTypes(
-    ::std::deque<::std::vector<::std::unique_ptr<Action<FF_TYPES>>>> &
-        actions) {
-  if (actions.size() <= 1) {
+bool Batch<FF_TYPES>::checkFirstLastActionTypes(size_t const last_idx) {
+  if (last_idx == 0) {
     return true;
   }
 
   ::std::vector<::std::unique_ptr<Action<FF_TYPES>>> & first =
-      actions.front();
+      this->childActions[0];
   ::std::vector<::std::unique_ptr<Action<FF_TYPES>>> & last =
-      actions.back();
+      this->childActions[last_idx];
 
   if (first.size() != last.size()) {
     return false;
@@ -55,58 +53,125 @@ bool Batch<FF_TYPES>::checkFirstLastActionTypes(
 }
 
 template<FF_TYPENAMES>
-void Batch<FF_TYPES>::handleActions(
-    ::std::deque<::std::vector<::std::unique_ptr<Action<FF_TYPES>>>> &
-        actions) {
-  for (size_t i = 0; i < actions[0].size(); i++) {
-    auto sub_actions = actions.begin();
+template<typename F>
+bool Batch<FF_TYPES>::runChildren(F const & f) {
+  this->childActions.resize(this->children.size());
+
+  for (size_t i = 0; i < this->children.size(); i++) {
+    ::std::vector<::std::unique_ptr<Action<FF_TYPES>>> & actions =
+        this->childActions[i];
+    actions.clear();
+
+    this->children[i]->setActions(&actions);
+    f(*this->children[i], i);
+    this->children[i]->setActions(nullptr);
+
+    if_debug if (!this->checkFirstLastActionTypes(i)) {
+      log_error("Differing action types in Batch");
+      this->abort();
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template<FF_TYPENAMES>
+void Batch<FF_TYPES>::handleActions() {
+  if (this->childActions.empty()) {
+    return;
+  }
 
-    ActionType type = sub_actions->at(i)->type;
+  ::std::vector<::std::vector<::std::unique_ptr<Action<FF_TYPES>>>> &
+      actions = this->childActions;
+
+  for (size_t i = 0; i < actions[0].size(); i++) {
+    ActionType type = actions[0][i]->type;
 
     if (type == ActionType::send) {
       ::std::unique_ptr<OutgoingMessage_T> omsg(new OutgoingMessage_T(
-          static_cast<SendAction<FF_TYPES> &>(*sub_actions->at(i))
+          static_cast<SendAction<FF_TYPES> &>(*actions[0][i])
               .msg->recipient));
 
+      // Size the outer message once, then append each child's message.
+      size_t length = sizeof(uint64_t);
+      for (size_t j = 0; j < actions.size(); j++) {
+        length += static_cast<SendAction<FF_TYPES> &>(*actions[j][i])
+                      .msg->length();
+      }
+      omsg->reserve(length);
+
       // check batch size matches peer's batch size.
       {
         omsg->template write<uint64_t>((uint64_t)this->children.size());
       }
 
-      while (sub_actions != actions.end()) {
-        omsg->template write<OutgoingMessage_T>(
-            *static_cast<SendAction<FF_TYPES> &>(*sub_actions->at(i))
-                 .msg);
-        static_cast<SendAction<FF_TYPES> &>(*sub_actions->at(i))
-            .msg->clear();
-
-        sub_actions++;
+      for (size_t j = 0; j < actions.size(); j++) {
+        SendAction<FF_TYPES> & send =
+            static_cast<SendAction<FF_TYPES> &>(*actions[j][i]);
+        omsg->template write<OutgoingMessage_T>(*send.msg);
+        send.msg->clear();
       }
 
       this->send(std::move(omsg));
     } else if (type == ActionType::invoke) {
-      if (static_cast<InvokeAction<FF_TYPES> &>(*sub_actions->at(i))
-              .promised) {
-        log_error("Batch promises not supported.");
-        this->abort();
-        return;
-      }
+      InvokeAction<FF_TYPES> & first =
+          static_cast<InvokeAction<FF_TYPES> &>(*actions[0][i]);
 
       ::std::vector<::std::unique_ptr<Fronctocol<FF_TYPES>>>
           sub_children;
+      sub_children.reserve(actions.size());
 
-      while (sub_actions != actions.end()) {
+      for (size_t j = 0; j < actions.size(); j++) {
         sub_children.push_back(::std::move(
-            static_cast<InvokeAction<FF_TYPES> &>(*sub_actions->at(i))
+            static_cast<InvokeAction<FF_TYPES> &>(*actions[j][i])
                 .fronctocol));
+      }
+
+      ::std::unique_ptr<Batch<FF_TYPES>> sub_batch(
+          new Batch<FF_TYPES>(::std::move(sub_children)));
+
+      if (first.promised) {
+        Batch<FF_TYPES> * sub_batch_ptr = sub_batch.get();
+        ::std::unique_ptr<PromiseFronctocol<FF_TYPES, BatchResult>>
+            promised(::std::move(sub_batch));
+        this->promisedBatches.push_back(PromisedBatch{
+            sub_batch_ptr,
+            this->template promise<BatchResult>(
+                ::std::move(promised), first.peers)});
+      } else {
+        this->invoke(::std::move(sub_batch), first.peers);
+      }
+    } else if (type == ActionType::await) {
+      // Children may only await promises which they made in this Batch,
+      // and all children must await the same one.
+      AwaitAction<FF_TYPES> & first =
+          static_cast<AwaitAction<FF_TYPES> &>(*actions[0][i]);
+
+      size_t p = 0;
+      while (p < this->promisedBatches.size() &&
+             this->promisedBatches[p].batch->children[0].get() !=
+                 first.awaitedFronctocol) {
+        p++;
+      }
+
+      if (p == this->promisedBatches.size()) {
+        log_error("Batch children may only await their own promises");
+        this->abort();
+        return;
+      }
 
-        sub_actions++;
+      if_debug for (size_t j = 0; j < actions.size(); j++) {
+        if (this->promisedBatches[p].batch->children[j].get() !=
+            static_cast<AwaitAction<FF_TYPES> &>(*actions[j][i])
+                .awaitedFronctocol) {
+          log_error("Batch children awaited differing promises");
+          this->abort();
+          return;
+        }
       }
 
-      this->invoke(
-          ::std::unique_ptr<Fronctocol<FF_TYPES>>(
-              new Batch<FF_TYPES>(::std::move(sub_children))),
-          static_cast<InvokeAction<FF_TYPES> &>(*actions[0][i]).peers);
+      this->await(*this->promisedBatches[p].promise);
     } else if (type == ActionType::complete) {
       this->complete();
       /* allow a child class (inheritance) to do cleanup */
@@ -114,10 +179,6 @@ void Batch<FF_TYPES>::handleActions(
     } else if (type == ActionType::abortion) {
       this->abort();
       return;
-    } else if (type == ActionType::await) {
-      log_error("Batch promises are not supported");
-      this->abort();
-      return;
     } else {
       log_error("Invalid action type.");
       this->abort();
@@ -143,37 +204,22 @@ void Batch<FF_TYPES>::init() {
 
   this->batchHandler = ::std::unique_ptr<FronctocolHandler<FF_TYPES>>(
       new FronctocolHandler<FF_TYPES>(
-          this->getSelf(), this->getPeers()));
+          this->getSelf(), this->getPools(), this->getPeers()));
   this->batchHandler->id = this->getId();
 
-  ::std::deque<::std::vector<::std::unique_ptr<::ff::Action<FF_TYPES>>>>
-      actions;
+  bool ok = this->runChildren(
+      [this](Fronctocol<FF_TYPES> & child, size_t) {
+        child.setHandler(this->batchHandler.get());
+        child.init();
+      });
 
-  for (::std::unique_ptr<Fronctocol<FF_TYPES>> & child :
-       this->children) {
-    child->setHandler(this->batchHandler.get());
-
-    actions.emplace_back();
-
-    child->setActions(&actions.back());
-    child->init();
-    child->setActions(nullptr);
-
-    if_debug if (!this->checkFirstLastActionTypes(actions)) {
-      log_error("Differing action types in Batch");
-      this->abort();
-      return;
-    }
+  if (ok) {
+    this->handleActions();
   }
-
-  this->handleActions(actions);
 }
 
 template<FF_TYPENAMES>
 void Batch<FF_TYPES>::handleReceive(IncomingMessage_T & imsg) {
-  ::std::deque<::std::vector<::std::unique_ptr<::ff::Action<FF_TYPES>>>>
-      actions;
-
   // check batch size matches peer's batch size.
   {
     uint64_t num_peer_children = 0;
@@ -189,54 +235,57 @@ void Batch<FF_TYPES>::handleReceive(IncomingMessage_T & imsg) {
     }
   }
 
-  for (::std::unique_ptr<Fronctocol<FF_TYPES>> & child :
-       this->children) {
-    actions.emplace_back();
-
-    child->setActions(&actions.back());
-    child->handleReceive(imsg);
-    child->setActions(nullptr);
+  bool ok = this->runChildren(
+      [&imsg](Fronctocol<FF_TYPES> & child, size_t) {
+        child.handleReceive(imsg);
+      });
 
-    if_debug if (!this->checkFirstLastActionTypes(actions)) {
-      log_error("Differing action types in batched Batch");
-      this->abort();
-      return;
-    }
+  if (ok) {
+    this->handleActions();
   }
-
-  this->handleActions(actions);
 }
 
 template<FF_TYPENAMES>
 void Batch<FF_TYPES>::handleComplete(Fronctocol<FF_TYPES> & f) {
   Batch<FF_TYPES> & sub_batch = static_cast<Batch<FF_TYPES> &>(f);
 
-  ::std::deque<::std::vector<::std::unique_ptr<::ff::Action<FF_TYPES>>>>
-      actions;
+  bool ok = this->runChildren(
+      [&sub_batch](Fronctocol<FF_TYPES> & child, size_t i) {
+        child.handleComplete(*sub_batch.children[i]);
+      });
 
-  for (size_t i = 0; i < this->children.size(); i++) {
-    ::std::unique_ptr<Fronctocol<FF_TYPES>> & child = this->children[i];
+  if (ok) {
+    this->handleActions();
+  }
+}
 
-    actions.emplace_back();
+template<FF_TYPENAMES>
+void Batch<FF_TYPES>::handlePromise(Fronctocol<FF_TYPES> & f) {
+  Batch<FF_TYPES> & sub_batch = static_cast<Batch<FF_TYPES> &>(f);
 
-    child->setActions(&actions.back());
-    child->handleComplete(*sub_batch.children[i]);
-    child->setActions(nullptr);
+  size_t p = 0;
+  while (p < this->promisedBatches.size() &&
+         this->promisedBatches[p].batch != &sub_batch) {
+    p++;
+  }
 
-    if_debug if (!this->checkFirstLastActionTypes(actions)) {
-      log_error("Differing action types in Batch");
-      this->abort();
-      return;
-    }
+  if (p == this->promisedBatches.size()) {
+    log_error("Batch received an unknown promise");
+    this->abort();
+    return;
   }
 
-  this->handleActions(actions);
-}
+  bool ok = this->runChildren(
+      [&sub_batch](Fronctocol<FF_TYPES> & child, size_t i) {
+        child.handlePromise(*sub_batch.children[i]);
+      });
 
-template<FF_TYPENAMES>
-void Batch<FF_TYPES>::handlePromise(Fronctocol<FF_TYPES> &) {
-  log_error("Batch promises are not implemented");
-  this->abort();
+  this->promisedBatches.erase(
+      this->promisedBatches.begin() + (ssize_t)p);
+
+  if (ok) {
+    this->handleActions();
+  }
 }
 
 } // namespace mpc
@@ -0,0 +1,216 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/*
+ * Converts many XOR shared bits to arithmetic shares at once, under one
+ * or several moduli, with a single opening of the masked bits. Also
+ * converts many arithmetic shared bits back to XOR shares, with one
+ * multiply and one reveal.
+ */
+
+#ifndef FF_MPC_BATCHED_TYPE_CAST_H_
+#define FF_MPC_BATCHED_TYPE_CAST_H_
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <ff/Fronctocol.h>
+#include <ff/Message.h>
+#include <mpc/Multiply.h>
+#include <mpc/Opening.h>
+#include <mpc/Randomness.h>
+#include <mpc/Reveal.h>
+#include <mpc/TypeCastBit.h>
+#include <mpc/templates.h>
+
+/* logging configuration */
+#include <ff/logging.h>
+
+namespace ff {
+namespace mpc {
+
+/**
+ * Randomness to cast one bit from XOR shares under several moduli. r_2
+ * is XOR shared, and r_0[m] and r_1[m] are shared mod the m'th modulus.
+ * As with a TypeCastTriple from TypeCastFromBitInfo, they take the
+ * values (0, 1, 0) or (1, 0, 1) with 1/2 probability, but the one r_2
+ * is shared by every modulus.
+ */
+template<typename Number_T>
+struct MultiTypeCastTriple {
+  ::std::vector<Number_T> r_0;
+  ::std::vector<Number_T> r_1;
+  Boolean_t r_2 = 0x00;
+
+  MultiTypeCastTriple<Number_T>(
+      ::std::vector<Number_T> && r_0,
+      ::std::vector<Number_T> && r_1,
+      Boolean_t r_2);
+  MultiTypeCastTriple<Number_T>() = default;
+
+  template<typename Info_T>
+  MultiTypeCastTriple<Number_T>(Info_T const &) :
+      MultiTypeCastTriple<Number_T>() {
+  }
+
+  static std::string name() {
+    return std::string("Multi Type Cast Triple");
+  }
+};
+
+template<typename Number_T>
+struct MultiTypeCastFromBitInfo {
+  ::std::vector<Number_T> moduli;
+
+  size_t instanceSize() const {
+    size_t size = sizeof(Boolean_t);
+    for (Number_T const & modulus : this->moduli) {
+      size += 2 * numberLen(modulus);
+    }
+    return size;
+  }
+
+  void generate(
+      size_t n_parties,
+      size_t,
+      std::vector<MultiTypeCastTriple<Number_T>> & vals) const;
+
+  bool
+  operator==(MultiTypeCastFromBitInfo<Number_T> const & other) const {
+    return this->moduli == other.moduli;
+  }
+
+  bool
+  operator!=(MultiTypeCastFromBitInfo<Number_T> const & other) const {
+    return !(*this == other);
+  }
+
+  MultiTypeCastFromBitInfo<Number_T>(
+      ::std::vector<Number_T> const & m) :
+      moduli(m) {
+  }
+  MultiTypeCastFromBitInfo<Number_T>() = default;
+};
+
+/**
+ * Vectorized TypeCastFromBit. The masked bits are packed eight to a
+ * byte and opened in one message per peer, then each party selects its
+ * share of every bit under every modulus from contiguous randomness.
+ *
+ * outputBitShares[m][i] is this party's share of the i'th bit, mod the
+ * m'th modulus.
+ */
+template<FF_TYPENAMES, typename Number_T>
+class BatchedTypeCastFromBit : public OpeningFronctocol<FF_TYPES> {
+public:
+  std::string name() override;
+
+  ::std::vector<::std::vector<Number_T>> outputBitShares;
+
+  /**
+   * Casts under one modulus, using TypeCastTriples from a
+   * TypeCastFromBitInfo.
+   */
+  BatchedTypeCastFromBit(
+      ::std::vector<Boolean_t> const & XORSharesOfBits,
+      Number_T const & modulus,
+      Identity_T const * rev,
+      ::std::vector<TypeCastTriple<Number_T>> const & tcTriples,
+      Opening const & o = Opening());
+
+  /**
+   * Casts under each of the moduli, from a single opening.
+   */
+  BatchedTypeCastFromBit(
+      ::std::vector<Boolean_t> const & XORSharesOfBits,
+      ::std::vector<Number_T> const & moduli,
+      Identity_T const * rev,
+      ::std::vector<MultiTypeCastTriple<Number_T>> const & tcTriples,
+      Opening const & o = Opening());
+
+  void init() override;
+  void handleReceive(IncomingMessage_T & imsg) override;
+  void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
+  void handlePromise(ff::Fronctocol<FF_TYPES> & f) override;
+
+protected:
+  void writeShares(OutgoingMessage_T & omsg) override;
+  void combineShares(IncomingMessage_T & imsg) override;
+  void readOpened(IncomingMessage_T & imsg) override;
+  void opened() override;
+
+private:
+  ::std::vector<Number_T> const moduli;
+  size_t const numBits;
+
+  /* Bits of the input shares and of r_2, packed eight to a byte. The
+   * masked bits are opened in place. */
+  ::std::vector<Boolean_t> maskedBits;
+
+  /* r_0 and r_1 of every bit, for each modulus in turn. */
+  ::std::vector<Number_T> r_0s;
+  ::std::vector<Number_T> r_1s;
+};
+
+/**
+ * Vectorized TypeCast, from arithmetic shares of bits mod a small prime
+ * to XOR shares. All of the x * r_0 products are taken by one
+ * BatchedMultiply, and all of the masked bits opened by one
+ * BatchedReveal, so a batch takes the rounds of a single TypeCast.
+ *
+ * outputBitShares[i] is this party's XOR share of the i'th bit.
+ */
+template<FF_TYPENAMES, typename Number_T>
+class BatchedTypeCast : public Fronctocol<FF_TYPES> {
+public:
+  std::string name() override;
+
+  ::std::vector<Boolean_t> outputBitShares;
+
+  BatchedTypeCast(
+      ::std::vector<Number_T> && arithmeticSharesOfBits,
+      Number_T const & modulus,
+      Identity_T const * rev,
+      ::std::vector<BeaverTriple<Number_T>> && beaverTriples,
+      ::std::vector<TypeCastTriple<Number_T>> && tcTriples);
+
+  void init() override;
+  void handleReceive(IncomingMessage_T & imsg) override;
+  void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
+  void handlePromise(ff::Fronctocol<FF_TYPES> & f) override;
+
+private:
+  enum State { awaitingMultiply, awaitingReveal };
+  State state = awaitingMultiply;
+
+  ::std::vector<Number_T> arithmeticSharesOfBits;
+  Number_T const modulus;
+  Identity_T const * const revealer;
+
+  ::std::vector<BeaverTriple<Number_T>> beaverTriples;
+  ::std::vector<TypeCastTriple<Number_T>> const tcTriples;
+
+  MultiplyInfo<Identity_T, BeaverInfo<Number_T>> const multiplyInfo;
+
+  ::std::vector<Number_T> multiplyResults;
+};
+
+} // namespace mpc
+} // namespace ff
+
+#include <mpc/BatchedTypeCast.t.h>
+
+#define LOG_UNCLUDE
+#include <ff/logging.h>
+
+#endif //FF_MPC_BATCHED_TYPE_CAST_H_
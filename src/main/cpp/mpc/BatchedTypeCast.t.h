@@ -0,0 +1,360 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+namespace ff {
+
+template<typename Identity_T, typename Number_T>
+bool msg_read(
+    IncomingMessage<Identity_T> & msg,
+    mpc::MultiTypeCastFromBitInfo<Number_T> & info) {
+  uint64_t num_moduli = 0;
+  bool success = msg.template read<uint64_t>(num_moduli);
+  info.moduli.resize((size_t)num_moduli);
+  for (Number_T & modulus : info.moduli) {
+    success = success && msg.template read<Number_T>(modulus);
+  }
+  return success;
+}
+
+template<typename Identity_T, typename Number_T>
+bool msg_write(
+    OutgoingMessage<Identity_T> & msg,
+    mpc::MultiTypeCastFromBitInfo<Number_T> const & info) {
+  bool success =
+      msg.template write<uint64_t>((uint64_t)info.moduli.size());
+  for (Number_T const & modulus : info.moduli) {
+    success = success && msg.template write<Number_T>(modulus);
+  }
+  return success;
+}
+
+template<typename Identity_T, typename Number_T>
+bool msg_read(
+    IncomingMessage<Identity_T> & msg,
+    mpc::MultiTypeCastTriple<Number_T> & triple) {
+  uint64_t num_moduli = 0;
+  bool success = msg.template read<uint64_t>(num_moduli);
+  triple.r_0.resize((size_t)num_moduli);
+  triple.r_1.resize((size_t)num_moduli);
+  for (size_t m = 0; m < triple.r_0.size(); m++) {
+    success = success && msg.template read<Number_T>(triple.r_0[m]);
+    success = success && msg.template read<Number_T>(triple.r_1[m]);
+  }
+  success = success && msg.template read<Boolean_t>(triple.r_2);
+  return success;
+}
+
+template<typename Identity_T, typename Number_T>
+bool msg_write(
+    OutgoingMessage<Identity_T> & msg,
+    mpc::MultiTypeCastTriple<Number_T> const & triple) {
+  bool success =
+      msg.template write<uint64_t>((uint64_t)triple.r_0.size());
+  for (size_t m = 0; m < triple.r_0.size(); m++) {
+    success = success && msg.template write<Number_T>(triple.r_0[m]);
+    success = success && msg.template write<Number_T>(triple.r_1[m]);
+  }
+  success = success && msg.template write<Boolean_t>(triple.r_2);
+  return success;
+}
+
+namespace mpc {
+
+template<typename Number_T>
+MultiTypeCastTriple<Number_T>::MultiTypeCastTriple(
+    ::std::vector<Number_T> && r_0,
+    ::std::vector<Number_T> && r_1,
+    Boolean_t r_2) :
+    r_0(::std::move(r_0)), r_1(::std::move(r_1)), r_2(r_2) {
+}
+
+template<typename Number_T>
+void MultiTypeCastFromBitInfo<Number_T>::generate(
+    size_t n_parties,
+    size_t,
+    std::vector<MultiTypeCastTriple<Number_T>> & vals) const {
+  size_t const num_moduli = this->moduli.size();
+
+  std::vector<Boolean_t> r_2s;
+  xorSecretShare<Boolean_t>(n_parties, randomModP<Boolean_t>(2), r_2s);
+  Boolean_t r_2 = 0x00;
+  for (Boolean_t const & share : r_2s) {
+    r_2 = r_2 ^ share;
+  }
+
+  vals.clear();
+  vals.reserve(n_parties);
+  for (size_t i = 0; i < n_parties; i++) {
+    vals.emplace_back(
+        ::std::vector<Number_T>(num_moduli),
+        ::std::vector<Number_T>(num_moduli),
+        r_2s[i]);
+  }
+
+  std::vector<Number_T> shares;
+  for (size_t m = 0; m < num_moduli; m++) {
+    Number_T const & modulus = this->moduli[m];
+
+    arithmeticSecretShare<Number_T>(
+        n_parties, modulus, (Number_T)(r_2 == 0 ? 0 : 1), shares);
+    for (size_t i = 0; i < n_parties; i++) {
+      vals[i].r_0[m] = shares[i];
+    }
+
+    arithmeticSecretShare<Number_T>(
+        n_parties, modulus, (Number_T)(r_2 == 0 ? 1 : 0), shares);
+    for (size_t i = 0; i < n_parties; i++) {
+      vals[i].r_1[m] = shares[i];
+    }
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T>
+std::string BatchedTypeCastFromBit<FF_TYPES, Number_T>::name() {
+  std::string name = std::string("Batched Typecast From Bit size: ") +
+      std::to_string(this->numBits) + " moduli:";
+  for (Number_T const & modulus : this->moduli) {
+    name += " " + dec(modulus);
+  }
+  return name;
+}
+
+template<FF_TYPENAMES, typename Number_T>
+BatchedTypeCastFromBit<FF_TYPES, Number_T>::BatchedTypeCastFromBit(
+    ::std::vector<Boolean_t> const & XORSharesOfBits,
+    Number_T const & modulus,
+    Identity_T const * rev,
+    ::std::vector<TypeCastTriple<Number_T>> const & tcTriples,
+    Opening const & o) :
+    OpeningFronctocol<FF_TYPES>(o, rev),
+    moduli(1, modulus),
+    numBits(XORSharesOfBits.size()),
+    maskedBits((XORSharesOfBits.size() + 7) / 8, 0x00) {
+  log_assert(tcTriples.size() == this->numBits);
+
+  this->r_0s.reserve(this->numBits);
+  this->r_1s.reserve(this->numBits);
+  for (size_t i = 0; i < this->numBits; i++) {
+    Boolean_t const bit = (XORSharesOfBits[i] ^ tcTriples[i].r_2) & 1;
+    this->maskedBits[i / 8] |= (Boolean_t)(bit << (i % 8));
+    this->r_0s.push_back(tcTriples[i].r_0);
+    this->r_1s.push_back(tcTriples[i].r_1);
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T>
+BatchedTypeCastFromBit<FF_TYPES, Number_T>::BatchedTypeCastFromBit(
+    ::std::vector<Boolean_t> const & XORSharesOfBits,
+    ::std::vector<Number_T> const & moduli,
+    Identity_T const * rev,
+    ::std::vector<MultiTypeCastTriple<Number_T>> const & tcTriples,
+    Opening const & o) :
+    OpeningFronctocol<FF_TYPES>(o, rev),
+    moduli(moduli),
+    numBits(XORSharesOfBits.size()),
+    maskedBits((XORSharesOfBits.size() + 7) / 8, 0x00),
+    r_0s(moduli.size() * XORSharesOfBits.size()),
+    r_1s(moduli.size() * XORSharesOfBits.size()) {
+  log_assert(tcTriples.size() == this->numBits);
+
+  for (size_t i = 0; i < this->numBits; i++) {
+    MultiTypeCastTriple<Number_T> const & triple = tcTriples[i];
+    log_assert(triple.r_0.size() == this->moduli.size());
+
+    Boolean_t const bit = (XORSharesOfBits[i] ^ triple.r_2) & 1;
+    this->maskedBits[i / 8] |= (Boolean_t)(bit << (i % 8));
+    for (size_t m = 0; m < this->moduli.size(); m++) {
+      this->r_0s[m * this->numBits + i] = triple.r_0[m];
+      this->r_1s[m * this->numBits + i] = triple.r_1[m];
+    }
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedTypeCastFromBit<FF_TYPES, Number_T>::init() {
+  this->open();
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedTypeCastFromBit<FF_TYPES, Number_T>::handleReceive(
+    IncomingMessage_T & imsg) {
+  this->receiveOpening(imsg);
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedTypeCastFromBit<FF_TYPES, Number_T>::handleComplete(
+    ff::Fronctocol<FF_TYPES> &) {
+  log_error("Batched TypeCastFromBit received unexpected "
+            "handle complete");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedTypeCastFromBit<FF_TYPES, Number_T>::handlePromise(
+    ff::Fronctocol<FF_TYPES> &) {
+  log_error("Batched TypeCastFromBit received unexpected "
+            "handle promise");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedTypeCastFromBit<FF_TYPES, Number_T>::writeShares(
+    OutgoingMessage_T & omsg) {
+  if_debug {
+    omsg.template write<uint64_t>((uint64_t)this->numBits);
+  }
+
+  for (Boolean_t const & byte : this->maskedBits) {
+    omsg.template write<Boolean_t>(byte);
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedTypeCastFromBit<FF_TYPES, Number_T>::combineShares(
+    IncomingMessage_T & imsg) {
+  if_debug {
+    uint64_t other_size = 0;
+    imsg.template read<uint64_t>(other_size);
+    log_assert((size_t)other_size == this->numBits);
+  }
+
+  Boolean_t byte = 0x00;
+  for (Boolean_t & masked : this->maskedBits) {
+    imsg.template read<Boolean_t>(byte);
+    masked = masked ^ byte;
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedTypeCastFromBit<FF_TYPES, Number_T>::readOpened(
+    IncomingMessage_T & imsg) {
+  if_debug {
+    uint64_t other_size = 0;
+    imsg.template read<uint64_t>(other_size);
+    log_assert((size_t)other_size == this->numBits);
+  }
+
+  for (Boolean_t & masked : this->maskedBits) {
+    imsg.template read<Boolean_t>(masked);
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedTypeCastFromBit<FF_TYPES, Number_T>::opened() {
+  this->outputBitShares.resize(this->moduli.size());
+  for (size_t m = 0; m < this->moduli.size(); m++) {
+    ::std::vector<Number_T> & outputs = this->outputBitShares[m];
+    Number_T const * const r_0 = this->r_0s.data() + m * this->numBits;
+    Number_T const * const r_1 = this->r_1s.data() + m * this->numBits;
+
+    outputs.resize(this->numBits);
+    for (size_t i = 0; i < this->numBits; i++) {
+      bool const bit = 0 != ((this->maskedBits[i / 8] >> (i % 8)) & 1);
+      outputs[i] = bit ? r_1[i] : r_0[i];
+    }
+  }
+  this->complete();
+}
+
+template<FF_TYPENAMES, typename Number_T>
+std::string BatchedTypeCast<FF_TYPES, Number_T>::name() {
+  return std::string("Batched TypeCast size: ") +
+      std::to_string(this->tcTriples.size()) +
+      " modulus: " + dec(this->modulus);
+}
+
+template<FF_TYPENAMES, typename Number_T>
+BatchedTypeCast<FF_TYPES, Number_T>::BatchedTypeCast(
+    ::std::vector<Number_T> && arithmeticSharesOfBits,
+    Number_T const & modulus,
+    Identity_T const * rev,
+    ::std::vector<BeaverTriple<Number_T>> && beaverTriples,
+    ::std::vector<TypeCastTriple<Number_T>> && tcTriples) :
+    arithmeticSharesOfBits(::std::move(arithmeticSharesOfBits)),
+    modulus(modulus),
+    revealer(rev),
+    beaverTriples(::std::move(beaverTriples)),
+    tcTriples(::std::move(tcTriples)),
+    multiplyInfo(rev, modulus) {
+  log_assert(
+      this->arithmeticSharesOfBits.size() == this->tcTriples.size());
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedTypeCast<FF_TYPES, Number_T>::init() {
+  ::std::vector<Number_T> r_0s;
+  r_0s.reserve(this->tcTriples.size());
+  for (TypeCastTriple<Number_T> const & triple : this->tcTriples) {
+    r_0s.push_back(triple.r_0);
+  }
+
+  this->invoke(
+      ::std::unique_ptr<Fronctocol<FF_TYPES>>(
+          new BatchedMultiply<FF_TYPES, Number_T>(
+              ::std::move(this->arithmeticSharesOfBits),
+              ::std::move(r_0s),
+              &this->multiplyResults,
+              ::std::move(this->beaverTriples),
+              &this->multiplyInfo)),
+      this->getPeers());
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedTypeCast<FF_TYPES, Number_T>::handleReceive(
+    IncomingMessage_T &) {
+  log_error("Batched TypeCast received unexpected handle receive");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedTypeCast<FF_TYPES, Number_T>::handleComplete(
+    ff::Fronctocol<FF_TYPES> & f) {
+  switch (this->state) {
+    case awaitingMultiply: {
+      ::std::vector<Number_T> masked(this->multiplyResults.size());
+      for (size_t i = 0; i < masked.size(); i++) {
+        masked[i] = modAdd(
+            this->multiplyResults[i],
+            this->tcTriples[i].r_1,
+            this->modulus);
+      }
+
+      this->state = awaitingReveal;
+      this->invoke(
+          ::std::unique_ptr<Fronctocol<FF_TYPES>>(
+              new BatchedReveal<FF_TYPES, Number_T>(
+                  ::std::move(masked), this->modulus, this->revealer)),
+          this->getPeers());
+    } break;
+    case awaitingReveal: {
+      ::std::vector<Number_T> const & ovs =
+          static_cast<BatchedReveal<FF_TYPES, Number_T> &>(f)
+              .openedValues;
+      bool const is_revealer = this->getSelf() == *this->revealer;
+
+      this->outputBitShares.resize(ovs.size());
+      for (size_t i = 0; i < ovs.size(); i++) {
+        log_assert(ovs[i] == 0 || ovs[i] == 1);
+        this->outputBitShares[i] = is_revealer ?
+            (Boolean_t)(ovs[i] ^ this->tcTriples[i].r_2) :
+            this->tcTriples[i].r_2;
+      }
+      this->complete();
+    } break;
+    default: {
+      log_error("Batched TypeCast received unexpected handle complete");
+      this->abort();
+    }
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedTypeCast<FF_TYPES, Number_T>::handlePromise(
+    ff::Fronctocol<FF_TYPES> &) {
+  log_error("Batched TypeCast received unexpected handle promise");
+  this->abort();
+}
+
+} // namespace mpc
+} // namespace ff
@@ -18,6 +18,7 @@
 #include <ff/Fronctocol.h>
 #include <ff/Message.h>
 #include <mpc/Batch.h>
+#include <mpc/BatchedTypeCast.h>
 #include <mpc/Multiply.h>
 #include <mpc/PrefixOr.h>
 #include <mpc/Randomness.h>
@@ -94,6 +95,49 @@ private:
   Number_T equalityCheckValue;
 };
 
+/**
+ * Vectorized BitwiseCompare, running many comparisons in lock-step.
+ * The PrefixOrs run together in one Batch, and the 2-bit results of
+ * every comparison are cast to XOR shares by a single BatchedTypeCast,
+ * so each round exchanges one message per peer for all comparisons.
+ *
+ * outputShares[i] is this party's share of the i'th comparison, as
+ * the outputShare of a BitwiseCompare.
+ */
+template<FF_TYPENAMES, typename Number_T>
+class BatchedBitwiseCompare : public Fronctocol<FF_TYPES> {
+public:
+  std::string name() override;
+  std::vector<Boolean_t> outputShares;
+
+  BatchedBitwiseCompare(
+      std::vector<std::vector<Number_T>> && shares_of_a,
+      std::vector<std::vector<Number_T>> && b_in_the_clear,
+      PrefixOrInfo<Identity_T, Number_T> const * const prefInfo,
+      std::vector<BitwiseCompareRandomness<Number_T>> && randomness);
+
+  void init() override;
+
+  void handleReceive(IncomingMessage_T & imsg) override;
+
+  void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
+
+  void handlePromise(ff::Fronctocol<FF_TYPES> & fronctocol) override;
+
+private:
+  enum BatchedBitwiseCompareState {
+    awaitingBatchPrefixOr,
+    awaitingBatchedTypeCast,
+  };
+  BatchedBitwiseCompareState state = awaitingBatchPrefixOr;
+
+  std::vector<std::vector<Number_T>> shares_of_a;
+  std::vector<std::vector<Number_T>> const b_in_the_clear;
+
+  PrefixOrInfo<Identity_T, Number_T> const * const prefInfo;
+  std::vector<BitwiseCompareRandomness<Number_T>> randomness;
+};
+
 #include <mpc/BitwiseCompare.t.h>
 
 } // namespace mpc
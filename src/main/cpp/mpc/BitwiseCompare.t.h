@@ -2,6 +2,64 @@
  * Copyright Stealth Software Technologies, Inc.
  */
 
+/*
+ * Replaces a_i with a_i ^ b_i, for each bit b_i of the public b.
+ */
+template<typename Identity_T, typename Number_T>
+void bitwiseCompareXorB(
+    std::vector<Number_T> & shares_of_a,
+    std::vector<Number_T> const & b_in_the_clear,
+    PrefixOrInfo<Identity_T, Number_T> const & prefInfo,
+    bool const is_revealer) {
+  for (size_t i = 0; i < shares_of_a.size(); i++) {
+    if (b_in_the_clear[i] == 1 && is_revealer) {
+      shares_of_a[i] = (prefInfo.s + 1 - shares_of_a[i]) % prefInfo.s;
+    } else if (b_in_the_clear[i] == 1) {
+      shares_of_a[i] = (prefInfo.s - shares_of_a[i]) % prefInfo.s;
+    }
+    log_debug("Starting share of a[%lu] = %u", i, shares_of_a[i]);
+  }
+}
+
+/*
+ * From the prefix or of a ^ b, finds shares of the bit of b where a
+ * and b first differ (compare_val), and of whether they are equal.
+ */
+template<typename Identity_T, typename Number_T>
+void bitwiseCompareFromPrefixOr(
+    std::vector<Number_T> const & orResults,
+    std::vector<Number_T> const & b_in_the_clear,
+    PrefixOrInfo<Identity_T, Number_T> const & prefInfo,
+    bool const is_revealer,
+    Number_T & compare_val_mod_s,
+    Number_T & equality_val_mod_s) {
+  compare_val_mod_s = 0;
+  log_debug("Share of prefix or [%lu] = %u", 0UL, orResults[0]);
+  if (b_in_the_clear[0] == 1) {
+    compare_val_mod_s =
+        modAdd(compare_val_mod_s, orResults[0], prefInfo.s);
+  }
+  for (size_t i = 1; i < orResults.size(); i++) {
+    log_debug(
+        "Share of prefix or [%zu] = %u and b = %u",
+        i,
+        orResults[i],
+        b_in_the_clear[i]);
+    if (b_in_the_clear[i] == 1) {
+      compare_val_mod_s = modAdd(
+          modAdd(compare_val_mod_s, orResults[i], prefInfo.s),
+          prefInfo.s - orResults[i - 1],
+          prefInfo.s);
+    }
+  }
+
+  equality_val_mod_s = prefInfo.s - orResults[orResults.size() - 1];
+  if (is_revealer) {
+    equality_val_mod_s += 1;
+  }
+  equality_val_mod_s %= prefInfo.s;
+}
+
 template<FF_TYPENAMES, typename Number_T>
 std::string BitwiseCompare<FF_TYPES, Number_T>::name() {
   return std::string("Bitwise Compare small mod: ") +
@@ -35,19 +93,11 @@ void BitwiseCompare<FF_TYPES, Number_T>::init() {
         this->b_in_the_clear[i]);
   }
 
-  for (size_t i = 0; i < this->shares_of_a.size(); i++) {
-    if (this->b_in_the_clear[i] == 1 &&
-        *this->prefInfo->rev == this->getSelf()) {
-      this->shares_of_a[i] =
-          (this->prefInfo->s + 1 - this->shares_of_a[i]) %
-          (this->prefInfo->s);
-    } else if (this->b_in_the_clear[i] == 1) {
-      this->shares_of_a[i] =
-          (this->prefInfo->s - this->shares_of_a[i]) %
-          (this->prefInfo->s);
-    }
-    log_debug("Starting share of a[%lu] = %u", i, this->shares_of_a[i]);
-  }
+  bitwiseCompareXorB(
+      this->shares_of_a,
+      this->b_in_the_clear,
+      *this->prefInfo,
+      *this->prefInfo->rev == this->getSelf());
 
   log_debug("this->lambda: %zu", this->lambda);
 
@@ -83,35 +133,14 @@ void BitwiseCompare<FF_TYPES, Number_T>::handleComplete(
           static_cast<PrefixOr<FF_TYPES, Number_T> &>(f);
 
       Number_T compare_val_mod_s = 0;
-      log_debug(
-          "Share of prefix or [%lu] = %u", 0UL, pref.orResults[0]);
-      if (this->b_in_the_clear[0] == 1) {
-        compare_val_mod_s = modAdd(
-            compare_val_mod_s, pref.orResults[0], this->prefInfo->s);
-      }
-      for (size_t i = 1; i < this->shares_of_a.size(); i++) {
-        log_debug(
-            "Share of prefix or [%zu] = %u and b = %u",
-            i,
-            pref.orResults[i],
-            this->b_in_the_clear[i]);
-        if (this->b_in_the_clear[i] == 1) {
-          compare_val_mod_s = modAdd(
-              modAdd(
-                  compare_val_mod_s,
-                  pref.orResults[i],
-                  this->prefInfo->s),
-              this->prefInfo->s - pref.orResults[i - 1],
-              this->prefInfo->s);
-        }
-      }
+      bitwiseCompareFromPrefixOr(
+          pref.orResults,
+          this->b_in_the_clear,
+          *this->prefInfo,
+          *this->prefInfo->rev == this->getSelf(),
+          compare_val_mod_s,
+          this->equalityCheckValue);
 
-      this->equalityCheckValue = this->prefInfo->s -
-          pref.orResults[this->shares_of_a.size() - 1];
-      if (*this->prefInfo->rev == this->getSelf()) {
-        this->equalityCheckValue += 1;
-      }
-      this->equalityCheckValue %= this->prefInfo->s;
       log_debug(
           "Invoking tcb on value: %u with beaver triple %u %u %u and "
           "tcTriple %u %u %u",
@@ -159,3 +188,131 @@ void BitwiseCompare<FF_TYPES, Number_T>::handleComplete(
       log_error("BitwiseCompare state machine in unexpected state");
   }
 }
+
+template<FF_TYPENAMES, typename Number_T>
+std::string BatchedBitwiseCompare<FF_TYPES, Number_T>::name() {
+  return std::string("Batched Bitwise Compare size: ") +
+      std::to_string(this->shares_of_a.size()) +
+      " small mod: " + dec(this->prefInfo->s);
+}
+
+template<FF_TYPENAMES, typename Number_T>
+BatchedBitwiseCompare<FF_TYPES, Number_T>::BatchedBitwiseCompare(
+    std::vector<std::vector<Number_T>> && shares_of_a,
+    std::vector<std::vector<Number_T>> && b_in_the_clear,
+    PrefixOrInfo<Identity_T, Number_T> const * const prefInfo,
+    std::vector<BitwiseCompareRandomness<Number_T>> && randomness) :
+    shares_of_a(std::move(shares_of_a)),
+    b_in_the_clear(std::move(b_in_the_clear)),
+    prefInfo(prefInfo),
+    randomness(std::move(randomness)) {
+  log_assert(this->shares_of_a.size() == this->b_in_the_clear.size());
+  log_assert(this->shares_of_a.size() == this->randomness.size());
+  for (size_t i = 0; i < this->shares_of_a.size(); i++) {
+    log_assert(
+        this->prefInfo->lambda * this->prefInfo->lambda >
+        this->shares_of_a[i].size());
+    log_assert(
+        this->shares_of_a[i].size() == this->b_in_the_clear[i].size());
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedBitwiseCompare<FF_TYPES, Number_T>::init() {
+  log_debug("Calling init on BatchedBitwiseCompare");
+  if (this->shares_of_a.empty()) {
+    this->complete();
+    return;
+  }
+
+  bool const is_revealer = *this->prefInfo->rev == this->getSelf();
+  std::unique_ptr<Batch<FF_TYPES>> batch(new Batch<FF_TYPES>());
+  for (size_t i = 0; i < this->shares_of_a.size(); i++) {
+    bitwiseCompareXorB(
+        this->shares_of_a[i],
+        this->b_in_the_clear[i],
+        *this->prefInfo,
+        is_revealer);
+    batch->children.emplace_back(new PrefixOr<FF_TYPES, Number_T>(
+        this->shares_of_a[i],
+        this->prefInfo,
+        std::move(this->randomness[i].randomness)));
+  }
+  this->invoke(std::move(batch), this->getPeers());
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedBitwiseCompare<FF_TYPES, Number_T>::handlePromise(
+    ff::Fronctocol<FF_TYPES> &) {
+  log_error("Unexpected handlePromise in BatchedBitwiseCompare");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedBitwiseCompare<FF_TYPES, Number_T>::handleReceive(
+    IncomingMessage_T &) {
+  log_error("Unexpected handleReceive in BatchedBitwiseCompare");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedBitwiseCompare<FF_TYPES, Number_T>::handleComplete(
+    ff::Fronctocol<FF_TYPES> & f) {
+  switch (this->state) {
+    case awaitingBatchPrefixOr: {
+      Batch<FF_TYPES> & batch = static_cast<Batch<FF_TYPES> &>(f);
+      bool const is_revealer = *this->prefInfo->rev == this->getSelf();
+      size_t const n = this->shares_of_a.size();
+
+      // Compare values at even indices, equality values at odd.
+      std::vector<Number_T> values(2 * n);
+      std::vector<BeaverTriple<Number_T>> beavers;
+      std::vector<TypeCastTriple<Number_T>> tcTriples;
+      beavers.reserve(2 * n);
+      tcTriples.reserve(2 * n);
+      for (size_t i = 0; i < n; i++) {
+        PrefixOr<FF_TYPES, Number_T> & pref =
+            static_cast<PrefixOr<FF_TYPES, Number_T> &>(
+                *batch.children[i]);
+        bitwiseCompareFromPrefixOr(
+            pref.orResults,
+            this->b_in_the_clear[i],
+            *this->prefInfo,
+            is_revealer,
+            values[2 * i],
+            values[2 * i + 1]);
+
+        BitwiseCompareRandomness<Number_T> & r = this->randomness[i];
+        beavers.push_back(r.beaver);
+        tcTriples.push_back(r.tcTriple);
+        beavers.push_back(r.beaver2);
+        tcTriples.push_back(r.tcTriple2);
+      }
+
+      this->state = awaitingBatchedTypeCast;
+      this->invoke(
+          std::unique_ptr<Fronctocol<FF_TYPES>>(
+              new BatchedTypeCast<FF_TYPES, Number_T>(
+                  std::move(values),
+                  this->prefInfo->s,
+                  this->prefInfo->rev,
+                  std::move(beavers),
+                  std::move(tcTriples))),
+          this->getPeers());
+    } break;
+    case awaitingBatchedTypeCast: {
+      std::vector<Boolean_t> const & bits =
+          static_cast<BatchedTypeCast<FF_TYPES, Number_T> &>(f)
+              .outputBitShares;
+      this->outputShares.resize(this->shares_of_a.size());
+      for (size_t i = 0; i < this->outputShares.size(); i++) {
+        this->outputShares[i] = static_cast<Boolean_t>(
+            bits[2 * i] ^ (bits[2 * i + 1] << 1));
+      }
+      this->complete();
+    } break;
+    default:
+      log_error("BatchedBitwiseCompare in unexpected state");
+      this->abort();
+  }
+}
@@ -10,6 +10,7 @@
 /* C++ Headers */
 #include <cmath>
 #include <cstdint>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -83,6 +84,49 @@ struct DecomposedBitSetInfo {
   DecomposedBitSetInfo() = default;
 };
 
+/**
+ * A decomposed bit set packs r to packedWidth(p) bits, the ell bit
+ * shares to packedWidth(s) bits each, and r_0 to one bit, without the
+ * bit shares' length.
+ */
+template<typename Large_T, typename Small_T>
+struct PackedRandomness<
+    DecomposedBitSet<Large_T, Small_T>,
+    DecomposedBitSetInfo<Large_T, Small_T>> {
+  static constexpr bool packed = true;
+
+  static size_t
+  bits(DecomposedBitSetInfo<Large_T, Small_T> const & info) {
+    return packedWidth(info.p) + info.ell * packedWidth(info.s) + 1;
+  }
+
+  static void pack(
+      BitWriter & writer,
+      DecomposedBitSetInfo<Large_T, Small_T> const & info,
+      DecomposedBitSet<Large_T, Small_T> const & dbs) {
+    log_assert(dbs.r_is.size() == info.ell);
+    packNumber(writer, dbs.r, packedWidth(info.p));
+    size_t const width = packedWidth(info.s);
+    for (Small_T const & r_i : dbs.r_is) {
+      packNumber(writer, r_i, width);
+    }
+    writer.write((uint64_t)dbs.r_0, 1);
+  }
+
+  static void unpack(
+      BitReader & reader,
+      DecomposedBitSetInfo<Large_T, Small_T> const & info,
+      DecomposedBitSet<Large_T, Small_T> & dbs) {
+    unpackNumber(reader, dbs.r, packedWidth(info.p));
+    size_t const width = packedWidth(info.s);
+    dbs.r_is.resize(info.ell);
+    for (Small_T & r_i : dbs.r_is) {
+      unpackNumber(reader, r_i, width);
+    }
+    dbs.r_0 = (Boolean_t)reader.read(1);
+  }
+};
+
 // p: some prime
 // s: some prime > 1 + ceil(log2(p))
 // ell: ceil(log2(p))
@@ -93,7 +137,9 @@ struct CompareInfo {
   const Small_T s;
   const size_t ell;
   const size_t lambda;
-  const std::vector<std::vector<Small_T>> lagrangePolynomialSet;
+  const std::shared_ptr<LagrangePolynomialSet<Small_T> const>
+      lagrangePolynomialStorage;
+  const LagrangePolynomialSet<Small_T> & lagrangePolynomialSet;
   const Identity_T * revealer;
   const PrefixOrInfo<Identity_T, Small_T> prefInfo;
 
@@ -103,9 +149,33 @@ struct CompareInfo {
       size_t const ell,
       size_t const lambda,
       std::vector<std::vector<Small_T>> const & lagrangePolynomialSet,
-      const Identity_T * revealer);
-  CompareInfo(const Large_T & p, Identity_T const * const revealer);
+      const Identity_T * revealer,
+      PrefixOrStrategy const strategy = PrefixOrStrategy::sqrtBlocks);
+  CompareInfo(
+      Large_T const & p,
+      Small_T const & s,
+      size_t const ell,
+      size_t const lambda,
+      std::shared_ptr<LagrangePolynomialSet<Small_T> const> const &
+          lagrangePolynomialSet,
+      const Identity_T * revealer,
+      PrefixOrStrategy const strategy = PrefixOrStrategy::sqrtBlocks);
+  CompareInfo(
+      const Large_T & p,
+      Identity_T const * const revealer,
+      PrefixOrStrategy const strategy = PrefixOrStrategy::sqrtBlocks);
   CompareInfo() = default;
+
+  /**
+   * The size of each ExponentSeries used by one Compare's PrefixOr,
+   * none at all for a logDepth PrefixOr.
+   */
+  std::vector<size_t> exponentSeriesNeeds() const;
+
+  /**
+   * The number of BeaverTriples used by one Compare.
+   */
+  size_t beaverTriplesNeeded() const;
 };
 
 template<typename Large_T, typename Small_T>
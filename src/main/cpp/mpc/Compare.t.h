@@ -188,22 +188,29 @@ void DecomposedBitSetInfo<Large_T, Small_T>::generate(
 
 template<typename Identity_T, typename Large_T, typename Small_T>
 CompareInfo<Identity_T, Large_T, Small_T>::CompareInfo(
-    const Large_T & modulus, Identity_T const * const revealer) :
+    const Large_T & modulus,
+    Identity_T const * const revealer,
+    PrefixOrStrategy const strategy) :
     p(modulus),
     s(nextPrime(static_cast<Small_T>(approxLog2(modulus)) + 3)),
     ell(static_cast<size_t>(approxLog2(modulus)) + 1),
     lambda(
         static_cast<size_t>(std::sqrt(static_cast<double>(this->ell))) +
         1),
-    lagrangePolynomialSet(generateLagrangePolynomialSet(
-        this->ell, this->lambda, this->s)),
+    lagrangePolynomialStorage(
+        strategy == PrefixOrStrategy::logDepth ?
+            std::make_shared<LagrangePolynomialSet<Small_T> const>() :
+            cachedLagrangePolynomialSet(
+                this->ell, this->lambda, this->s)),
+    lagrangePolynomialSet(*this->lagrangePolynomialStorage),
     revealer(revealer),
     prefInfo(
         this->s,
         this->lambda,
         this->ell,
-        this->lagrangePolynomialSet,
-        this->revealer) {
+        this->lagrangePolynomialStorage,
+        this->revealer,
+        strategy) {
   log_debug("prefInfo s: %s", dec(this->prefInfo.s).c_str());
 }
 
@@ -214,22 +221,79 @@ CompareInfo<Identity_T, Large_T, Small_T>::CompareInfo(
     size_t const ell,
     size_t const lambda,
     std::vector<std::vector<Small_T>> const & lagrangePolynomialSet,
-    const Identity_T * revealer) :
+    const Identity_T * revealer,
+    PrefixOrStrategy const strategy) :
+    CompareInfo(
+        p,
+        s,
+        ell,
+        lambda,
+        std::make_shared<LagrangePolynomialSet<Small_T> const>(
+            lagrangePolynomialSet),
+        revealer,
+        strategy) {
+}
+
+template<typename Identity_T, typename Large_T, typename Small_T>
+CompareInfo<Identity_T, Large_T, Small_T>::CompareInfo(
+    Large_T const & p,
+    Small_T const & s,
+    size_t const ell,
+    size_t const lambda,
+    std::shared_ptr<LagrangePolynomialSet<Small_T> const> const &
+        lagrangePolynomialSet,
+    const Identity_T * revealer,
+    PrefixOrStrategy const strategy) :
     p(p),
     s(s),
     ell(ell),
     lambda(lambda),
-    lagrangePolynomialSet(lagrangePolynomialSet),
+    lagrangePolynomialStorage(lagrangePolynomialSet),
+    lagrangePolynomialSet(*this->lagrangePolynomialStorage),
     revealer(revealer),
     prefInfo(
         this->s,
         this->lambda,
         this->ell,
-        this->lagrangePolynomialSet,
-        this->revealer) {
+        this->lagrangePolynomialStorage,
+        this->revealer,
+        strategy) {
   log_debug("prefInfo s: %s", dec(this->prefInfo.s).c_str());
 }
 
+template<typename Identity_T, typename Large_T, typename Small_T>
+std::vector<size_t>
+CompareInfo<Identity_T, Large_T, Small_T>::exponentSeriesNeeds() const {
+  std::vector<size_t> needs;
+  if (this->prefInfo.strategy == PrefixOrStrategy::logDepth) {
+    return needs;
+  }
+
+  size_t block_size = this->lambda;
+  while (block_size < this->ell) {
+    needs.emplace_back(block_size);
+    block_size += this->lambda;
+  }
+  needs.emplace_back(this->ell);
+
+  block_size = 1;
+  while ((block_size - 1) < this->lambda) {
+    needs.emplace_back(block_size);
+    block_size++;
+  }
+  return needs;
+}
+
+template<typename Identity_T, typename Large_T, typename Small_T>
+size_t
+CompareInfo<Identity_T, Large_T, Small_T>::beaverTriplesNeeded() const {
+  // Compare itself multiplies twice, and the rest go to PrefixOr.
+  if (this->prefInfo.strategy == PrefixOrStrategy::logDepth) {
+    return numLogDepthPrefixOrMultiplies(this->ell) + 2;
+  }
+  return 2 * this->ell + this->exponentSeriesNeeds().size() + 2;
+}
+
 template<typename Large_T, typename Small_T>
 CompareRandomness<Large_T, Small_T>::CompareRandomness(
     std::vector<ExponentSeries<Small_T>> && exponentSeries,
@@ -20,6 +20,7 @@
 /* Fortissimo Headers */
 #include <ff/Fronctocol.h>
 #include <ff/Message.h>
+#include <ff/Promise.h>
 
 #include <mpc/Compare.h>
 #include <mpc/Multiply.h>
@@ -35,6 +36,12 @@
 namespace ff {
 namespace mpc {
 
+/**
+ * The CompareRandomnessHouse deals every type of randomness which
+ * Compare needs. Given a list of dealers, each of which runs a
+ * CompareRandomnessHouse with the same list, every type is sharded
+ * amongst them. Otherwise this house deals alone.
+ */
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
 class CompareRandomnessHouse : public Fronctocol<FF_TYPES> {
 public:
@@ -47,14 +54,22 @@ public:
 
   CompareRandomnessHouse(
       CompareInfo<Identity_T, Large_T, Small_T> const * const
-          compareInfo);
+          compareInfo,
+      std::vector<Identity_T> const & dealers =
+          std::vector<Identity_T>());
 
 private:
   CompareInfo<Identity_T, Large_T, Small_T> const * const compareInfo;
+  std::vector<Identity_T> dealers;
 
   size_t numDealersRemaining = 0;
 };
 
+/**
+ * The CompareRandomnessPatron collects Compare randomness from a
+ * single dealer, or from a list of dealers sharing the work, each of
+ * which runs a CompareRandomnessHouse with the same list.
+ */
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
 class CompareRandomnessPatron : public Fronctocol<FF_TYPES> {
 public:
@@ -76,21 +91,22 @@ public:
       Identity_T const * const dealerIdentity,
       const size_t dispenserSize);
 
+  CompareRandomnessPatron(
+      CompareInfo<Identity_T, Large_T, Small_T> const * const
+          compareInfo,
+      std::vector<Identity_T> const & dealers,
+      const size_t dispenserSize);
+
 private:
   void generateOutputDispenser();
 
-  enum ComparePatronPromiseState {
-    awaitingExponentSeries,
-    awaitingMultiply,
-    awaitingTct,
-    awaitingDbs
-  };
-  ComparePatronPromiseState promiseState = awaitingExponentSeries;
+  /* Every randomness type is requested from the dealer at once. */
+  PromiseJoin<FF_TYPES> join;
 
   size_t numMultiplies;
 
   CompareInfo<Identity_T, Large_T, Small_T> const * const compareInfo;
-  const Identity_T * dealerIdentity;
+  std::vector<Identity_T> const dealers;
   size_t dispenserSize;
 
   std::vector<size_t> UnboundedFaninOrRandomnessNeeds;
@@ -99,31 +115,6 @@ private:
   BeaverInfo<Small_T> beaverInfo;
   DecomposedBitSetInfo<Large_T, Small_T> dbsInfo;
 
-  std::unique_ptr<Promise<
-      FF_TYPES,
-      RandomnessDispenser<
-          ExponentSeries<Small_T>,
-          ExponentSeriesInfo<Small_T>>>>
-      exponentPromiseDispenser;
-
-  std::unique_ptr<Promise<
-      FF_TYPES,
-      RandomnessDispenser<BeaverTriple<Small_T>, BeaverInfo<Small_T>>>>
-      fullMultiplyPromiseDispenser;
-
-  std::unique_ptr<Promise<
-      FF_TYPES,
-      RandomnessDispenser<
-          TypeCastTriple<Small_T>,
-          TypeCastInfo<Small_T>>>>
-      fullTctPromiseDispenser;
-  std::unique_ptr<Promise<
-      FF_TYPES,
-      RandomnessDispenser<
-          DecomposedBitSet<Large_T, Small_T>,
-          DecomposedBitSetInfo<Large_T, Small_T>>>>
-      fullDbsPromiseDispenser;
-
   std::vector<std::unique_ptr<RandomnessDispenser<
       ExponentSeries<Small_T>,
       ExponentSeriesInfo<Small_T>>>>
@@ -16,6 +16,7 @@
 /* 3rd Party Headers */
 
 /* Fortissimo Headers */
+#include <ff/Continuation.h>
 #include <ff/Fronctocol.h>
 #include <ff/Message.h>
 #include <mpc/Batch.h>
@@ -44,7 +45,9 @@ struct DivideInfo {
   const Identity_T * revealer;
   size_t const ell;
   size_t const lambda;
-  const std::vector<std::vector<Small_T>> lagrangePolynomialSet;
+  const std::shared_ptr<LagrangePolynomialSet<Small_T> const>
+      lagrangePolynomialStorage;
+  const LagrangePolynomialSet<Small_T> & lagrangePolynomialSet;
   CompareInfo<Identity_T, Large_T, Small_T> const * const compareInfo;
   Large_T modulus;
   Small_T smallModulus;
@@ -53,17 +56,36 @@ struct DivideInfo {
       Large_T modulus,
       size_t ell,
       size_t lambda,
-      const std::vector<std::vector<Small_T>> & lagrangePolynomialSet,
+      std::shared_ptr<LagrangePolynomialSet<Small_T> const> const &
+          lagrangePolynomialSet,
       CompareInfo<Identity_T, Large_T, Small_T> const * const
           compareInfo) :
       revealer(r),
       ell(ell),
       lambda(lambda),
-      lagrangePolynomialSet(lagrangePolynomialSet),
+      lagrangePolynomialStorage(lagrangePolynomialSet),
+      lagrangePolynomialSet(*this->lagrangePolynomialStorage),
       compareInfo(compareInfo),
       modulus(modulus),
       smallModulus(nextPrime<Small_T>(static_cast<Small_T>(ell) + 2)) {
   }
+  DivideInfo(
+      Identity_T const * const r,
+      Large_T modulus,
+      size_t ell,
+      size_t lambda,
+      const std::vector<std::vector<Small_T>> & lagrangePolynomialSet,
+      CompareInfo<Identity_T, Large_T, Small_T> const * const
+          compareInfo) :
+      DivideInfo(
+          r,
+          modulus,
+          ell,
+          lambda,
+          std::make_shared<LagrangePolynomialSet<Small_T> const>(
+              lagrangePolynomialSet),
+          compareInfo) {
+  }
 };
 
 // TO-DO: Templatize (so multiply and TCT can be bignum)
@@ -77,6 +99,9 @@ struct DivideRandomness {
       RandomnessDispenser<BeaverTriple<Large_T>, BeaverInfo<Large_T>>>
       multiplyDispenser;
   /* Additional Vars for Batch Compare */
+  BatchedPosIntCompareRandomness<Large_T, Small_T>
+      batchedCompareRandomness;
+  /* Vars for the Compare of each iteration */
   std::unique_ptr<RandomnessDispenser<
       PosIntCompareRandomness<Large_T, Small_T>,
       DoNotGenerateInfo>>
@@ -107,6 +132,8 @@ struct DivideRandomness {
       std::unique_ptr<RandomnessDispenser<
           BeaverTriple<Large_T>,
           BeaverInfo<Large_T>>> multiplyDispenser,
+      BatchedPosIntCompareRandomness<Large_T, Small_T> &&
+          batchedCompareRandomness,
       std::unique_ptr<RandomnessDispenser<
           PosIntCompareRandomness<Large_T, Small_T>,
           DoNotGenerateInfo>> compareDispenser,
@@ -126,8 +153,12 @@ struct DivideRandomness {
           TypeCastFromBitInfo<Large_T>>> endPrimeTCTripleDispenser);
 };
 
+/**
+ * Divide is written as a chain of continuations: each step invokes
+ * the next child and names the step which consumes its result.
+ */
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
-class Divide : public Fronctocol<FF_TYPES> {
+class Divide : public ContinuationFronctocol<FF_TYPES> {
 
 public:
   std::string name() override;
@@ -146,25 +177,26 @@ public:
       DivideRandomness<Large_T, Small_T> && randomness);
 
   void init() override; // Initialization
-  void divide_awaitingBatchCompare(ff::Fronctocol<FF_TYPES> & f);
-  void divide_awaitingBatchTypecast(ff::Fronctocol<FF_TYPES> & f);
-  void divide_awaitingSecondBatchTypecast(ff::Fronctocol<FF_TYPES> & f);
-  void divide_awaitingThirdBatchTypecast(ff::Fronctocol<FF_TYPES> & f);
-  void divide_awaitingPrefixOR(ff::Fronctocol<FF_TYPES> & f);
-  void divide_awaitingBatchMultiply();
-  void divide_awaitingCompare(ff::Fronctocol<FF_TYPES> & f);
-  void divide_awaitingEndLoopTypecast(ff::Fronctocol<FF_TYPES> & f);
-  void handlePromise(ff::Fronctocol<FF_TYPES> & f) override;
-  void handleReceive(IncomingMessage_T & imsg) override;
-  void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
 
 private:
+  void divide_afterBatchCompare(
+      BatchedPosIntCompare<FF_TYPES, Large_T, Small_T> & compare);
+  void divide_afterBatchTypecast(Batch<FF_TYPES> & batch);
+  void divide_afterPrefixOR(PrefixOr<FF_TYPES, Small_T> & pref);
+  void divide_afterSecondBatchTypecast(Batch<FF_TYPES> & batch);
+  void divide_afterThirdBatchTypecast(Batch<FF_TYPES> & batch);
+  void divide_iterate();
+  void divide_afterBatchMultiply();
+  void divide_afterCompare(
+      PosIntCompare<FF_TYPES, Large_T, Small_T> & comp);
+  void divide_afterEndLoopTypecast(
+      TypeCastFromBit<FF_TYPES, Large_T> & tct);
+
   Large_T sh_dividend = 0;
   Large_T sh_divisor = 0;
   Large_T * const sh_quotient; // dividend = q*divisor + r
   DivideInfo<Identity_T, Large_T, Small_T> const * const info;
   size_t itr = 0;
-  std::unique_ptr<Batch<FF_TYPES>> compare_batch;
   std::unique_ptr<Batch<FF_TYPES>> typecast_batch;
   std::unique_ptr<Batch<FF_TYPES>> mult_batch;
 
@@ -187,19 +219,6 @@ private:
   Large_T w_rhs_product = 0;
   Large_T c_rhs_product = 0;
   MultiplyInfo<Identity_T, BeaverInfo<Large_T>> large_mult_info; // ???
-
-  /*Correlated Randomness for Batched Comparison, PrefixOR, Batched Multiplications */
-  enum div_state {
-    awaitingBatchCompare,
-    awaitingBatchTypecast,
-    awaitingPrefixOR,
-    awaitingSecondBatchTypecast,
-    awaitingThirdBatchTypecast,
-    awaitingBatchMultiply,
-    awaitingCompare,
-    awaitingEndLoopTypecast
-  };
-  div_state state;
 };
 
 } // namespace mpc
@@ -12,6 +12,8 @@ DivideRandomness<Large_T, Small_T>::DivideRandomness(
     std::unique_ptr<
         RandomnessDispenser<BeaverTriple<Large_T>, BeaverInfo<Large_T>>>
         multiplyDispenser,
+    BatchedPosIntCompareRandomness<Large_T, Small_T> &&
+        batchedCompareRandomness,
     std::unique_ptr<RandomnessDispenser<
         PosIntCompareRandomness<Large_T, Small_T>,
         DoNotGenerateInfo>> compareDispenser,
@@ -31,6 +33,7 @@ DivideRandomness<Large_T, Small_T>::DivideRandomness(
         TypeCastFromBitInfo<Large_T>>> endPrimeTCTripleDispenser) :
     prefixOrDispenser(std::move(prefixOrDispenser)),
     multiplyDispenser(std::move(multiplyDispenser)),
+    batchedCompareRandomness(std::move(batchedCompareRandomness)),
     compareDispenser(std::move(compareDispenser)),
     smallPrimeTCTripleFromBitDispenser(
         std::move(smallPrimeTCTripleFromBitDispenser)),
@@ -61,20 +64,6 @@ Divide<FF_TYPES, Large_T, Small_T>::Divide(
         info->revealer, BeaverInfo<Large_T>(this->info->modulus)) {
 }
 
-template<FF_TYPENAMES, typename Large_T, typename Small_T>
-void Divide<FF_TYPES, Large_T, Small_T>::handlePromise(
-    ff::Fronctocol<FF_TYPES> &) {
-  log_error("handlePromise called");
-  this->abort();
-}
-
-template<FF_TYPENAMES, typename Large_T, typename Small_T>
-void Divide<FF_TYPES, Large_T, Small_T>::handleReceive(
-    IncomingMessage_T &) {
-  log_error("handleReceive called");
-  this->abort();
-}
-
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
 void Divide<FF_TYPES, Large_T, Small_T>::init() {
 
@@ -107,34 +96,34 @@ void Divide<FF_TYPES, Large_T, Small_T>::init() {
   }
   /* Invoke Batched Compare */
   log_debug("[JC] prep batched comparison");
-  this->compare_batch =
-      std::unique_ptr<Batch<FF_TYPES>>(new Batch<FF_TYPES>());
+  std::vector<Large_T> lhs;
+  std::vector<Large_T> rhs;
   for (size_t i = 1; i < this->info->ell; i++) {
-    this->compare_batch->children.emplace_back(
-        new PosIntCompare<FF_TYPES, Large_T, Small_T>(
-            this->sh_tiy[i - 1],
-            this->sh_tiy[i],
-            this->info->compareInfo,
-            ::std::move(this->randomness.compareDispenser->get())));
+    lhs.push_back(this->sh_tiy[i - 1]);
+    rhs.push_back(this->sh_tiy[i]);
   }
-  this->invoke(std::move(this->compare_batch), this->getPeers());
+  this->invokeThen(
+      std::unique_ptr<BatchedPosIntCompare<FF_TYPES, Large_T, Small_T>>(
+          new BatchedPosIntCompare<FF_TYPES, Large_T, Small_T>(
+              std::move(lhs),
+              std::move(rhs),
+              this->info->compareInfo,
+              std::move(this->randomness.batchedCompareRandomness))),
+      this->getPeers(),
+      [this](BatchedPosIntCompare<FF_TYPES, Large_T, Small_T> & c) {
+        this->divide_afterBatchCompare(c);
+      });
   log_debug("Invoked Batched Comparison");
-  this->state = awaitingBatchCompare;
   log_debug("End of Init()");
 }
 
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
-void Divide<FF_TYPES, Large_T, Small_T>::divide_awaitingBatchCompare(
-    ff::Fronctocol<FF_TYPES> & f) {
-  Batch<FF_TYPES> & batch = static_cast<Batch<FF_TYPES> &>(f);
-  log_debug("=> awaitingBatchCompare");
+void Divide<FF_TYPES, Large_T, Small_T>::divide_afterBatchCompare(
+    BatchedPosIntCompare<FF_TYPES, Large_T, Small_T> & compare) {
+  log_debug("=> afterBatchCompare");
   this->sh_ais.push_back(0);
   for (size_t i = 0; i < this->info->ell - 1; i++) {
-    this->sh_ais.push_back(
-        static_cast<PosIntCompare<FF_TYPES, Large_T, Small_T> &>(
-            *batch.children[i])
-            .outputShare %
-        2);
+    this->sh_ais.push_back(compare.outputShares[i] % 2);
   }
   for (size_t i = 0; i < this->info->ell; i++) {
     log_debug("%u", this->sh_ais[i]);
@@ -151,16 +140,19 @@ void Divide<FF_TYPES, Large_T, Small_T>::divide_awaitingBatchCompare(
             this->randomness.smallPrimeTCTripleFromBitDispenser
                 ->get()));
   }
-  this->invoke(std::move(this->typecast_batch), this->getPeers());
+  this->invokeThen(
+      std::move(this->typecast_batch),
+      this->getPeers(),
+      [this](Batch<FF_TYPES> & batch) {
+        this->divide_afterBatchTypecast(batch);
+      });
   log_debug("Invoked Batched TypeCastFromBit");
-  this->state = awaitingBatchTypecast;
 }
 
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
-void Divide<FF_TYPES, Large_T, Small_T>::divide_awaitingBatchTypecast(
-    ff::Fronctocol<FF_TYPES> & f) {
-  log_debug("=> awaitingBatchTypecast");
-  Batch<FF_TYPES> & batch = static_cast<Batch<FF_TYPES> &>(f);
+void Divide<FF_TYPES, Large_T, Small_T>::divide_afterBatchTypecast(
+    Batch<FF_TYPES> & batch) {
+  log_debug("=> afterBatchTypecast");
   for (size_t i = 0; i < this->info->ell; i++) {
     this->sh_ais_modp.push_back(
         static_cast<TypeCastFromBit<FF_TYPES, Small_T> &>(
@@ -177,17 +169,19 @@ void Divide<FF_TYPES, Large_T, Small_T>::divide_awaitingBatchTypecast(
               this->info->ell,
               this->info->revealer),
           ::std::move(this->randomness.prefixOrDispenser->get())));
-  this->invoke(std::move(pref), this->getPeers());
+  this->invokeThen(
+      std::move(pref),
+      this->getPeers(),
+      [this](PrefixOr<FF_TYPES, Small_T> & p) {
+        this->divide_afterPrefixOR(p);
+      });
   log_debug("PrefixOR invoked");
-  this->state = awaitingPrefixOR;
 }
 
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
-void Divide<FF_TYPES, Large_T, Small_T>::divide_awaitingPrefixOR(
-    ff::Fronctocol<FF_TYPES> & f) {
-  log_debug("=> awaitingPrefixOR");
-  PrefixOr<FF_TYPES, Small_T> & pref =
-      static_cast<PrefixOr<FF_TYPES, Small_T> &>(f);
+void Divide<FF_TYPES, Large_T, Small_T>::divide_afterPrefixOR(
+    PrefixOr<FF_TYPES, Small_T> & pref) {
+  log_debug("=> afterPrefixOR");
   /* [LC]: Compute [b_i] */
   for (size_t i = 0; i < this->info->ell; i++) {
     log_debug(
@@ -218,16 +212,19 @@ void Divide<FF_TYPES, Large_T, Small_T>::divide_awaitingPrefixOR(
             this->randomness.smallPrimeBeaverDispenser->get(),
             this->randomness.smallPrimeTCTripleDispenser->get()));
   }
-  this->invoke(std::move(this->typecast_batch), this->getPeers());
+  this->invokeThen(
+      std::move(this->typecast_batch),
+      this->getPeers(),
+      [this](Batch<FF_TYPES> & batch) {
+        this->divide_afterSecondBatchTypecast(batch);
+      });
   log_debug("Invoked Batched TypeCast");
-  this->state = awaitingSecondBatchTypecast;
 }
 
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
 void Divide<FF_TYPES, Large_T, Small_T>::
-    divide_awaitingSecondBatchTypecast(ff::Fronctocol<FF_TYPES> & f) {
-  log_debug("=> awaitingBatchTypecast2");
-  Batch<FF_TYPES> & batch = static_cast<Batch<FF_TYPES> &>(f);
+    divide_afterSecondBatchTypecast(Batch<FF_TYPES> & batch) {
+  log_debug("=> afterBatchTypecast2");
   for (size_t i = 0; i < this->info->ell; i++) {
     this->sh_bis_bits.push_back(
         static_cast<TypeCast<FF_TYPES, Small_T> &>(*batch.children[i])
@@ -246,16 +243,19 @@ void Divide<FF_TYPES, Large_T, Small_T>::
             this->info->revealer,
             this->randomness.endPrimeTCTripleDispenser->get()));
   }
-  this->invoke(std::move(this->typecast_batch), this->getPeers());
+  this->invokeThen(
+      std::move(this->typecast_batch),
+      this->getPeers(),
+      [this](Batch<FF_TYPES> & batch) {
+        this->divide_afterThirdBatchTypecast(batch);
+      });
   log_debug("Invoked Batched TypeCastFromBit");
-  this->state = awaitingThirdBatchTypecast;
 }
 
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
 void Divide<FF_TYPES, Large_T, Small_T>::
-    divide_awaitingThirdBatchTypecast(ff::Fronctocol<FF_TYPES> & f) {
-  log_debug("=> awaitingBatchTypecast3");
-  Batch<FF_TYPES> & batch = static_cast<Batch<FF_TYPES> &>(f);
+    divide_afterThirdBatchTypecast(Batch<FF_TYPES> & batch) {
+  log_debug("=> afterBatchTypecast3");
   for (size_t i = 0; i < this->info->ell; i++) {
     this->sh_bis_large_prime.push_back(
         static_cast<TypeCastFromBit<FF_TYPES, Large_T> &>(
@@ -271,6 +271,12 @@ void Divide<FF_TYPES, Large_T, Small_T>::
   log_debug("sh_w[0] = %u", this->sh_wis[0]);
   log_debug("sh_c[0] = %u", this->sh_cis[0]);
   this->itr++; // iterator is now 1.
+  this->divide_iterate();
+}
+
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+void Divide<FF_TYPES, Large_T, Small_T>::divide_iterate() {
+  log_debug("Iteration #%zu Started", this->itr);
   /* Invoke Batched Multiply */
   this->mult_batch =
       std::unique_ptr<Batch<FF_TYPES>>(new Batch<FF_TYPES>());
@@ -293,17 +299,18 @@ void Divide<FF_TYPES, Large_T, Small_T>::
           &this->c_rhs_product,
           this->randomness.multiplyDispenser->get(),
           &large_mult_info)); // computing [c_(i-1)]*[y]
-  this->invoke(std::move(this->mult_batch), this->getPeers());
+  this->invokeThen(
+      std::move(this->mult_batch),
+      this->getPeers(),
+      [this](Batch<FF_TYPES> &) { this->divide_afterBatchMultiply(); });
   log_debug(
       "Invoked Batched Multiplication for iteration #%zu", this->itr);
-  this->state = awaitingBatchMultiply;
 }
 
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
-void Divide<FF_TYPES, Large_T, Small_T>::
-    divide_awaitingBatchMultiply() {
+void Divide<FF_TYPES, Large_T, Small_T>::divide_afterBatchMultiply() {
   log_debug("Loop (%zu)", this->itr);
-  log_debug("=> awaitingBatchMultiply");
+  log_debug("=> afterBatchMultiply");
   log_debug("RHS W value = %u", this->w_rhs_product);
   log_debug("RHS C value = %u", this->c_rhs_product);
   /* [LC]: compute [w_i] */
@@ -321,40 +328,43 @@ void Divide<FF_TYPES, Large_T, Small_T>::
               this->info->modulus),
           this->info->compareInfo,
           ::std::move(this->randomness.compareDispenser->get())));
-  this->invoke(std::move(comp), this->getPeers());
+  this->invokeThen(
+      std::move(comp),
+      this->getPeers(),
+      [this](PosIntCompare<FF_TYPES, Large_T, Small_T> & c) {
+        this->divide_afterCompare(c);
+      });
   log_debug("Invoked Comparison for Interation #%zu", this->itr);
-  this->state = awaitingCompare;
 }
 
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
-void Divide<FF_TYPES, Large_T, Small_T>::divide_awaitingCompare(
-    ff::Fronctocol<FF_TYPES> & f) {
-  log_debug("=> awaitingCompare");
+void Divide<FF_TYPES, Large_T, Small_T>::divide_afterCompare(
+    PosIntCompare<FF_TYPES, Large_T, Small_T> & comp) {
+  log_debug("=> afterCompare");
   /* [LC]: Store [c_i] */
-  PosIntCompare<FF_TYPES, Large_T, Small_T> & comp =
-      static_cast<PosIntCompare<FF_TYPES, Large_T, Small_T> &>(f);
   this->sh_cis_bits.push_back(comp.outputShare % 2);
 
   log_debug("Loop (%zu)", this->itr);
-  /* [LC]: compute [w_i] */
-  /* Invoke Compare with [w_i] and [RHS] */
+  /* Invoke TypeCastFromBit with [c_i] */
   std::unique_ptr<TypeCastFromBit<FF_TYPES, Large_T>> typecast(
       new TypeCastFromBit<FF_TYPES, Large_T>(
           this->sh_cis_bits[this->itr],
           this->info->modulus,
           this->info->revealer,
           this->randomness.endPrimeTCTripleDispenser->get()));
-  this->invoke(std::move(typecast), this->getPeers());
+  this->invokeThen(
+      std::move(typecast),
+      this->getPeers(),
+      [this](TypeCastFromBit<FF_TYPES, Large_T> & tct) {
+        this->divide_afterEndLoopTypecast(tct);
+      });
   log_debug("Invoked TypeCast for Interation #%zu", this->itr);
-  this->state = awaitingEndLoopTypecast;
 }
 
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
-void Divide<FF_TYPES, Large_T, Small_T>::divide_awaitingEndLoopTypecast(
-    ff::Fronctocol<FF_TYPES> & f) {
-  log_debug("=> awaitingEndLoopTypecast");
-  TypeCastFromBit<FF_TYPES, Large_T> & tct =
-      static_cast<TypeCastFromBit<FF_TYPES, Large_T> &>(f);
+void Divide<FF_TYPES, Large_T, Small_T>::divide_afterEndLoopTypecast(
+    TypeCastFromBit<FF_TYPES, Large_T> & tct) {
+  log_debug("=> afterEndLoopTypecast");
   this->sh_cis.push_back(tct.outputBitShare);
 
   log_debug(
@@ -364,84 +374,27 @@ void Divide<FF_TYPES, Large_T, Small_T>::divide_awaitingEndLoopTypecast(
   log_debug("Iteration #%zu Completed", this->itr);
   this->itr++; // increment the counter
   if (this->itr < this->info->ell + 1) {
-    log_debug("Iteration #%zu Started", this->itr);
-    /* Invoke Batched Multiply */
-    this->mult_batch =
-        std::unique_ptr<Batch<FF_TYPES>>(new Batch<FF_TYPES>());
-    this->mult_batch->children.emplace_back(
-        new Multiply<FF_TYPES, Large_T, BeaverInfo<Large_T>>(
-            this->sh_cis[this->itr - 1],
-            this->sh_tiy[this->info->ell + 1 - this->itr],
-            &this->w_rhs_product,
-            this->randomness.multiplyDispenser->get(),
-            &large_mult_info));
-    log_assert(this->randomness.multiplyDispenser != nullptr);
-    this->mult_batch->children.emplace_back(
-        new Multiply<FF_TYPES, Large_T, BeaverInfo<Large_T>>(
-            this->sh_bis_large_prime[this->info->ell - this->itr],
-            this->sh_tiy[this->info->ell - this->itr],
-            &this->c_rhs_product,
-            this->randomness.multiplyDispenser->get(),
-            &large_mult_info)); // computing [c_(i-1)]*[y]
-    this->invoke(std::move(this->mult_batch), this->getPeers());
-    log_debug(
-        "Invoked Batched Multiplication for iteration #%zu", this->itr);
-    this->state = awaitingBatchMultiply;
-  } else {
-    for (size_t i = 1; i < this->info->ell + 1; i++) {
-      log_debug("sh_cis[%zu] := %u", i, this->sh_cis[i]);
-    }
-    log_debug("Iteration #%zu DID NOT Started", this->itr);
-    for (size_t i = 1; i < this->info->ell + 1; i++) {
-      log_debug("sh_quotient := %u", *this->sh_quotient);
-      *this->sh_quotient = modAdd(
-          *this->sh_quotient,
-          modMul(
-              this->sh_cis[i],
-              this->powtwos[this->info->ell - i],
-              this->info->modulus),
-          this->info->modulus);
-    }
-    log_debug(
-        "Division Completed with sh_quotient = %u", *this->sh_quotient);
-    this->complete();
+    this->divide_iterate();
+    return;
   }
-}
 
-template<FF_TYPENAMES, typename Large_T, typename Small_T>
-void Divide<FF_TYPES, Large_T, Small_T>::handleComplete(
-    ff::Fronctocol<FF_TYPES> & f) {
-  log_debug("State MACHINE START AT %i", this->state);
-  log_debug("Divide handleComplete Called");
-  switch (this->state) {
-    case awaitingBatchCompare: {
-      this->divide_awaitingBatchCompare(f);
-    } break;
-    case awaitingBatchTypecast: {
-      this->divide_awaitingBatchTypecast(f);
-    } break;
-    case awaitingPrefixOR: {
-      this->divide_awaitingPrefixOR(f);
-    } break;
-    case awaitingSecondBatchTypecast: {
-      this->divide_awaitingSecondBatchTypecast(f);
-    } break;
-    case awaitingThirdBatchTypecast: {
-      this->divide_awaitingThirdBatchTypecast(f);
-    } break;
-    case awaitingBatchMultiply: {
-      this->divide_awaitingBatchMultiply();
-    } break;
-    case awaitingCompare: {
-      this->divide_awaitingCompare(f);
-    } break;
-    case awaitingEndLoopTypecast: {
-      this->divide_awaitingEndLoopTypecast(f);
-    } break;
-    default:
-      log_error("state machine in unexpected state");
+  for (size_t i = 1; i < this->info->ell + 1; i++) {
+    log_debug("sh_cis[%zu] := %u", i, this->sh_cis[i]);
   }
-  log_debug("State MACHINE END AT %i", this->state);
+  log_debug("Iteration #%zu DID NOT Started", this->itr);
+  for (size_t i = 1; i < this->info->ell + 1; i++) {
+    log_debug("sh_quotient := %u", *this->sh_quotient);
+    *this->sh_quotient = modAdd(
+        *this->sh_quotient,
+        modMul(
+            this->sh_cis[i],
+            this->powtwos[this->info->ell - i],
+            this->info->modulus),
+        this->info->modulus);
+  }
+  log_debug(
+      "Division Completed with sh_quotient = %u", *this->sh_quotient);
+  this->complete();
 }
 
 } // namespace mpc
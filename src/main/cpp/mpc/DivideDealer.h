@@ -85,6 +85,7 @@ private:
     awaitingPrefixOr,
     awaitingMultiply,
     awaitingCompare,
+    awaitingBatchedCompare,
     awaitingTct,
     awaitingMultiply2,
     awaitingTct2,
@@ -99,6 +100,7 @@ private:
   size_t numPrefixOrsNeeded;
   size_t numBeaverTriplesNeeded;
   size_t numComparesNeeded;
+  size_t batchedCompareSize;
   size_t numStartTCTriplesFromBitNeeded;
   size_t numStartTCTriplesNeeded;
   size_t numEndTCTriplesNeeded;
@@ -111,6 +113,10 @@ private:
       RandomnessDispenser<BeaverTriple<Large_T>, BeaverInfo<Large_T>>>
       multiplyDispenser;
   /* Additional Vars for Batch Compare */
+  std::unique_ptr<RandomnessDispenser<
+      BatchedPosIntCompareRandomness<Large_T, Small_T>,
+      DoNotGenerateInfo>>
+      batchedCompareDispenser;
   std::unique_ptr<RandomnessDispenser<
       PosIntCompareRandomness<Large_T, Small_T>,
       DoNotGenerateInfo>>
@@ -45,6 +45,11 @@ void DivideRandomnessHouse<FF_TYPES, Large_T, Small_T>::init() {
               this->info->modulus, this->info->revealer)));
   this->invoke(std::move(rd3), this->getPeers());
 
+  std::unique_ptr<ff::Fronctocol<FF_TYPES>> rd3b(
+      new PosIntCompareRandomnessHouse<FF_TYPES, Large_T, Small_T>(
+          this->info->compareInfo));
+  this->invoke(std::move(rd3b), this->getPeers());
+
   std::unique_ptr<ff::Fronctocol<FF_TYPES>> rd4(
       new RandomnessHouse<
           FF_TYPES,
@@ -72,7 +77,7 @@ void DivideRandomnessHouse<FF_TYPES, Large_T, Small_T>::init() {
           TypeCastFromBitInfo<Large_T>>());
   this->invoke(std::move(rd7), this->getPeers());
 
-  this->numDealersRemaining = 7;
+  this->numDealersRemaining = 8;
 }
 
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
@@ -121,7 +126,9 @@ DivideRandomnessPatron<FF_TYPES, Large_T, Small_T>::
     dispenserSize(
         dispenserSize) { // dispenserSize = num divides we're going to need
 
-  this->numComparesNeeded = 2 * this->info->ell;
+  // ell - 1 in one BatchedPosIntCompare, then one in each iteration.
+  this->batchedCompareSize = this->info->ell - 1;
+  this->numComparesNeeded = this->info->ell;
   this->numBeaverTriplesNeeded = 2 * this->info->ell;
   this->numPrefixOrsNeeded = 1;
   this->numStartTCTriplesFromBitNeeded = this->info->ell;
@@ -201,6 +208,26 @@ void DivideRandomnessPatron<FF_TYPES, Large_T, Small_T>::handleComplete(
                         Large_T,
                         Small_T> &>(f)
                         .posIntCompareDispenser);
+
+      std::unique_ptr<Fronctocol<FF_TYPES>> patron(
+          new BatchedPosIntCompareRandomnessPatron<
+              FF_TYPES,
+              Large_T,
+              Small_T>(
+              this->info->compareInfo,
+              dealerIdentity,
+              this->batchedCompareSize,
+              this->dispenserSize));
+      this->invoke(std::move(patron), this->getPeers());
+      this->state = awaitingBatchedCompare;
+    } break;
+    case awaitingBatchedCompare: {
+      this->batchedCompareDispenser =
+          std::move(static_cast<BatchedPosIntCompareRandomnessPatron<
+                        FF_TYPES,
+                        Large_T,
+                        Small_T> &>(f)
+                        .batchedPosIntCompareDispenser);
       log_debug("Launching tcts");
       std::unique_ptr<Fronctocol<FF_TYPES>> patron(
           new RandomnessPatron<
@@ -313,6 +340,7 @@ void DivideRandomnessPatron<FF_TYPES, Large_T, Small_T>::
             prefixOrDispenser->littleDispenser(numPrefixOrsNeeded)),
         std::move(
             multiplyDispenser->littleDispenser(numBeaverTriplesNeeded)),
+        batchedCompareDispenser->get(),
         std::move(compareDispenser->littleDispenser(numComparesNeeded)),
         std::move(smallPrimeTCTripleFromBitDispenser->littleDispenser(
             numStartTCTriplesFromBitNeeded)),
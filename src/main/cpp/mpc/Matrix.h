@@ -8,7 +8,10 @@
 /* C and POSIX Headers */
 
 /* C++ Headers */
+#include <algorithm>
+#include <cstddef>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -24,6 +27,12 @@
 namespace ff {
 namespace mpc {
 
+/* Width of the column panels factored by Matrix::DecomposeLU. */
+size_t constexpr MATRIX_BLOCK_SIZE = 64;
+
+/* Multiply-adds worth starting another thread for. */
+size_t constexpr MATRIX_THREAD_WORK = 1 << 18;
+
 template<typename Number_T>
 class Matrix {
 private:
@@ -79,8 +88,55 @@ public:
   //     then the output b will be the solution for 'x' in: Mx = y.
   void
   MakeIdentity(const Number_T & modulus, Matrix<Number_T> & b) const;
+  //   - Factors P * M = L * U in place, with L unit lower triangular
+  //     (below the diagonal) and U upper triangular (on and above it).
+  //     Row i of P * M is row rowOrder[i] of M, and oddSwaps is set if P
+  //     is an odd permutation. Returns false if M is singular, in which
+  //     case M is left partly factored.
+  //     Columns are factored in panels of MATRIX_BLOCK_SIZE, and the
+  //     rest of the matrix is updated once per panel with the
+  //     matrixMultKernel used by plainMatrixMult.
+  bool DecomposeLU(
+      const Number_T & modulus,
+      std::vector<size_t> & rowOrder,
+      bool & oddSwaps);
+
+private:
+  //   - Given M factored by DecomposeLU, sets b -> M^-1 * b.
+  void SolveLU(
+      const Number_T & modulus,
+      std::vector<size_t> const & rowOrder,
+      Matrix<Number_T> & b) const;
 };
 
+/**
+ * Calls f(begin, end) on ranges which cover [0, rows), splitting them
+ * over threads when there is enough work (given per row) to pay for
+ * starting them.
+ */
+template<typename F>
+void parallelRows(size_t const rows, size_t const rowWork, F const & f);
+
+/**
+ * Sets c = a * b^T, or c = c - a * b^T if subtract, for row major
+ * blocks of the given sizes within larger matrices, whose rows are the
+ * given strides (ld*) apart. a is rows x depth, bt is cols x depth and
+ * c is rows x cols. Rows of c are split over threads.
+ */
+template<typename Number_T>
+void matrixMultKernel(
+    Number_T const * const a,
+    size_t const lda,
+    Number_T const * const bt,
+    size_t const ldbt,
+    Number_T * const c,
+    size_t const ldc,
+    size_t const rows,
+    size_t const cols,
+    size_t const depth,
+    Number_T const & p,
+    bool const subtract);
+
 template<typename Number_T>
 void plainMatrixMult(
     Matrix<Number_T> const * const A,
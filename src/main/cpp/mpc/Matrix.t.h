@@ -80,83 +80,162 @@ Matrix<Number_T>::at(size_t const i, size_t const j) const {
 template<typename Number_T>
 void Matrix<Number_T>::MakeIdentity(
     const Number_T & modulus, Matrix<Number_T> & b) const {
-  Matrix<Number_T> Mcopy(*this);
-
-  for (size_t i = 0; i < this->numRows - 1; ++i) {
-    // Find the first row that has a non-zero entry in column i.
-    size_t i2 = i;
-    while (i2 < this->numRows && Mcopy.at(i2, i) == 0) {
-      i2++;
-    }
-
-    log_assert(i2 != this->numRows);
+  log_assert(b.numRows == this->numRows);
+
+  Matrix<Number_T> lu(*this);
+  std::vector<size_t> row_order;
+  bool odd_swaps = false;
+  if (!lu.DecomposeLU(modulus, row_order, odd_swaps)) {
+    log_error("Row reduction of a singular matrix");
+    return;
+  }
+  lu.SolveLU(modulus, row_order, b);
+}
 
-    if (i2 != i) {
-      // Swap row i and row i2.
+template<typename Number_T>
+bool Matrix<Number_T>::DecomposeLU(
+    const Number_T & modulus,
+    std::vector<size_t> & rowOrder,
+    bool & oddSwaps) {
+  log_assert(this->numRows > 0 && this->numRows == this->numColumns);
+  size_t const n = this->numRows;
+  Number_T * const m = this->buffer.data();
 
-      for (size_t k = i; k < Mcopy.numColumns; ++k) {
-        Number_T tmp = Mcopy.at(i, k);
-        Mcopy.at(i, k) = Mcopy.at(i2, k);
-        Mcopy.at(i2, k) = tmp;
+  rowOrder.resize(n);
+  for (size_t i = 0; i < n; i++) {
+    rowOrder[i] = i;
+  }
+  oddSwaps = false;
+
+  std::vector<Number_T> u_transpose;
+  for (size_t k0 = 0; k0 < n; k0 += MATRIX_BLOCK_SIZE) {
+    size_t const k1 = std::min(k0 + MATRIX_BLOCK_SIZE, n);
+
+    // Factor columns k0 through k1, all the way down, only updating
+    // the panel itself.
+    for (size_t j = k0; j < k1; j++) {
+      size_t pivot = j;
+      while (pivot < n && m[pivot * n + j] == 0) {
+        pivot++;
       }
-
-      // Ditto, for augmented matrix.
-      for (size_t k = 0; k < b.numColumns; ++k) {
-        Number_T tmp = b.at(i, k);
-        b.at(i, k) = b.at(i2, k);
-        b.at(i2, k) = tmp;
+      if (pivot == n) {
+        return false;
+      }
+      if (pivot != j) {
+        std::swap_ranges(m + pivot * n, m + pivot * n + n, m + j * n);
+        std::swap(rowOrder[pivot], rowOrder[j]);
+        oddSwaps = !oddSwaps;
       }
-    }
 
-    // Divide row i by Mcopy.at(i,i).
-    Number_T inv = modInvert<Number_T>(Mcopy.at(i, i), modulus);
-    for (size_t k = i; k < Mcopy.numColumns; ++k) {
-      Mcopy.at(i, k) = modMul<Number_T>(Mcopy.at(i, k), inv, modulus);
+      Number_T const inv = modInvert<Number_T>(m[j * n + j], modulus);
+      for (size_t i = j + 1; i < n; i++) {
+        Number_T & l = m[i * n + j];
+        if (l == 0) {
+          continue;
+        }
+        l = modMul<Number_T>(l, inv, modulus);
+        for (size_t c = j + 1; c < k1; c++) {
+          m[i * n + c] = modSub<Number_T>(
+              m[i * n + c],
+              modMul<Number_T>(l, m[j * n + c], modulus),
+              modulus);
+        }
+      }
     }
-    // Ditto, for augmented matrix.
-    for (size_t k = 0; k < b.numColumns; ++k) {
-      b.at(i, k) = modMul<Number_T>(b.at(i, k), inv, modulus);
+    if (k1 == n) {
+      break;
     }
 
-    // Subtract row i from rows i+1...(numRows-1)
-    for (size_t i2 = i + 1; i2 < Mcopy.numRows; ++i2) {
-      Number_T tmp = Mcopy.at(i2, i);
-      for (size_t l = i; l < Mcopy.numColumns; ++l) {
-        Number_T ratio = modMul<Number_T>(tmp, Mcopy.at(i, l), modulus);
-        ratio = modulus - ratio;
-        Mcopy.at(i2, l) =
-            modAdd<Number_T>(Mcopy.at(i2, l), ratio, modulus);
+    // The panel's rows of U, right of the panel, are L11^-1 * A12.
+    for (size_t i = k0 + 1; i < k1; i++) {
+      for (size_t j = k0; j < i; j++) {
+        Number_T const l = m[i * n + j];
+        if (l == 0) {
+          continue;
+        }
+        for (size_t c = k1; c < n; c++) {
+          m[i * n + c] = modSub<Number_T>(
+              m[i * n + c],
+              modMul<Number_T>(l, m[j * n + c], modulus),
+              modulus);
+        }
       }
-      // Ditto, for augmented matrix.
-      for (size_t l = 0; l < b.numColumns; ++l) {
-        Number_T ratio = modMul<Number_T>(tmp, b.at(i, l), modulus);
-        ratio = modulus - ratio;
-        b.at(i2, l) = modAdd<Number_T>(b.at(i2, l), ratio, modulus);
+    }
+
+    // The trailing submatrix, A22 -> A22 - L21 * U12, is most of the
+    // work, and goes to the multiplication kernel.
+    size_t const rest = n - k1;
+    size_t const depth = k1 - k0;
+    u_transpose.resize(rest * depth);
+    for (size_t j = 0; j < depth; j++) {
+      for (size_t c = 0; c < rest; c++) {
+        u_transpose[c * depth + j] = m[(k0 + j) * n + k1 + c];
       }
     }
+    matrixMultKernel<Number_T>(
+        m + k1 * n + k0,
+        n,
+        u_transpose.data(),
+        depth,
+        m + k1 * n + k1,
+        n,
+        rest,
+        rest,
+        depth,
+        modulus,
+        true);
+  }
+
+  return true;
+}
+
+template<typename Number_T>
+void Matrix<Number_T>::SolveLU(
+    const Number_T & modulus,
+    std::vector<size_t> const & rowOrder,
+    Matrix<Number_T> & b) const {
+  size_t const n = this->numRows;
+  size_t const k = b.numColumns;
+  Number_T const * const m = this->buffer.data();
+
+  std::vector<Number_T> diagonal_inverses(n);
+  for (size_t i = 0; i < n; i++) {
+    diagonal_inverses[i] = modInvert<Number_T>(m[i * n + i], modulus);
   }
 
-  // Done with all rows except last; the last row just has a non-identity
-  // element in the last column (i.e. the on-diagonal position).
-  Number_T inv = modInvert<Number_T>(
-      Mcopy.at(Mcopy.numRows - 1, Mcopy.numColumns - 1), modulus);
-  Mcopy.at(Mcopy.numRows - 1, Mcopy.numColumns - 1) = 1;
-  for (size_t l = 0; l < b.numColumns; ++l) {
-    b.at(Mcopy.numRows - 1, l) =
-        modMul<Number_T>(b.at(Mcopy.numRows - 1, l), inv, modulus);
+  // Each column of b is solved on its own, as a row of b^T, so that
+  // both substitutions are dot products of contiguous rows.
+  std::vector<Number_T> bt(k * n);
+  for (size_t i = 0; i < n; i++) {
+    for (size_t c = 0; c < k; c++) {
+      bt[c * n + i] = b.buffer[rowOrder[i] * k + c];
+    }
   }
 
-  // Now cancel all the upper-triangle coordinates.
-  for (size_t i = Mcopy.numRows - 1; i > 0; --i) {
-    // Subtract row i from rows i-1...0.
-    for (size_t l = 0; l < i; ++l) {
-      Number_T tmp = Mcopy.at(l, i);
-      for (size_t k = 0; k < b.numColumns; ++k) {
-        Number_T ratio = modMul<Number_T>(b.at(i, k), tmp, modulus);
-        ratio = modulus - ratio;
-        b.at(l, k) = modAdd<Number_T>(b.at(l, k), ratio, modulus);
+  parallelRows(k, n * n, [&](size_t const begin, size_t const end) {
+    ModDotProduct<Number_T> const dot(modulus);
+    for (size_t c = begin; c < end; c++) {
+      Number_T * const y = bt.data() + c * n;
+      // L * y = P * b
+      for (size_t i = 1; i < n; i++) {
+        y[i] = modSub<Number_T>(y[i], dot(m + i * n, y, i), modulus);
+      }
+      // U * x = y
+      for (size_t i = n; i-- > 0;) {
+        Number_T const sum =
+            dot(m + i * n + i + 1, y + i + 1, n - i - 1);
+        y[i] = modMul<Number_T>(
+            modSub<Number_T>(y[i], sum, modulus),
+            diagonal_inverses[i],
+            modulus);
       }
     }
+  });
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t c = 0; c < k; c++) {
+      b.buffer[i * k + c] = bt[c * n + i];
+    }
   }
 }
 
@@ -220,58 +299,21 @@ void Matrix<Number_T>::DoTranspose() {
 template<typename Number_T>
 Number_T Matrix<Number_T>::Det(const Number_T & modulus) const {
   log_assert(this->numRows > 0 && this->numRows == this->numColumns);
-  // Make a copy, since this method is const and the Determinant
-  // protocol needs to modify the matrix.
-  Matrix<Number_T> tmp = *this;
-  bool neg_one = false;
-  Number_T to_return = 1;
-  for (size_t i = 0; i < tmp.numRows - 1; ++i) {
-    // Find the first row that has a non-zero entry in column i.
-    size_t i2 = i;
-    while (i2 < tmp.numRows && tmp.at(i2, i) == 0) {
-      i2++;
-    }
-    if (i2 == tmp.numRows) {
-      return 0;
-    }
-    if (i2 != i) {
-      // Swap row i and row i2.
-      neg_one ^=
-          true; // Determinant switches sign when swapping two rows.
-      for (size_t k = i; k < tmp.numColumns; ++k) {
-        Number_T tmp2 = tmp.at(i, k);
-        tmp.at(i, k) = tmp.at(i2, k);
-        tmp.at(i2, k) = tmp2;
-      }
-    }
-
-    // Divide row i by tmp.at(i,i).
-    Number_T inv = modInvert<Number_T>(tmp.at(i, i), modulus);
-    // Multiplying a row by 'inv' will affect the determinant
-    // by a factor 1 / inv (i.e. by original value).
-    to_return = modMul<Number_T>(to_return, tmp.at(i, i), modulus);
-    for (size_t k = i; k < tmp.numColumns; ++k) {
-      tmp.at(i, k) = modMul<Number_T>(tmp.at(i, k), inv, modulus);
-    }
-
-    // Subtract row i from rows i+1...(numRows-1)
-    for (size_t i2 = i + 1; i2 < tmp.numRows; ++i2) {
-      Number_T tmp2 = tmp.at(i2, i);
-      for (size_t l = i; l < tmp.numColumns; ++l) {
-        Number_T ratio = modMul<Number_T>(tmp2, tmp.at(i, l), modulus);
-        ratio = modulus - ratio;
-        tmp.at(i2, l) = modAdd<Number_T>(tmp.at(i2, l), ratio, modulus);
-      }
-    }
+  // Make a copy, since this method is const and the factorization
+  // modifies the matrix.
+  Matrix<Number_T> lu = *this;
+  std::vector<size_t> row_order;
+  bool odd_swaps = false;
+  if (!lu.DecomposeLU(modulus, row_order, odd_swaps)) {
+    return 0;
   }
 
-  // Done with all rows except last; the last row just has a non-identity
-  // element in the last column (i.e. the on-diagonal position).
-  to_return = modMul<Number_T>(
-      to_return, tmp.at(tmp.numRows - 1, tmp.numRows - 1), modulus);
-
-  // Finally, apply -1 factor, if relevant.
-  if (neg_one && to_return != 0)
+  // det(L) = 1, and each row swap negates the determinant.
+  Number_T to_return = 1;
+  for (size_t i = 0; i < lu.numRows; ++i) {
+    to_return = modMul<Number_T>(to_return, lu.at(i, i), modulus);
+  }
+  if (odd_swaps && to_return != 0)
     to_return = modulus - to_return;
   return to_return;
 }
@@ -287,6 +329,64 @@ Number_T Matrix<Number_T>::Trace() const {
   return to_return;
 }
 
+template<typename F>
+void parallelRows(
+    size_t const rows, size_t const rowWork, F const & f) {
+  size_t num_threads = ::std::thread::hardware_concurrency();
+  num_threads = ::std::min(num_threads, rows);
+  num_threads =
+      ::std::min(num_threads, rows * rowWork / MATRIX_THREAD_WORK);
+  if (num_threads <= 1) {
+    f(0, rows);
+    return;
+  }
+
+  ::std::vector<::std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (size_t t = 1; t < num_threads; t++) {
+    size_t const begin = rows * t / num_threads;
+    size_t const end = rows * (t + 1) / num_threads;
+    threads.emplace_back([&f, begin, end]() { f(begin, end); });
+  }
+  f(0, rows / num_threads);
+  for (::std::thread & thread : threads) {
+    thread.join();
+  }
+}
+
+template<typename Number_T>
+void matrixMultKernel(
+    Number_T const * const a,
+    size_t const lda,
+    Number_T const * const bt,
+    size_t const ldbt,
+    Number_T * const c,
+    size_t const ldc,
+    size_t const rows,
+    size_t const cols,
+    size_t const depth,
+    Number_T const & p,
+    bool const subtract) {
+  parallelRows(
+      rows, cols * depth, [&](size_t const begin, size_t const end) {
+        ModDotProduct<Number_T> const dot(p);
+        // Columns are taken MATRIX_BLOCK_SIZE at a time, so that their
+        // rows of bt stay in cache for every row of a.
+        for (size_t j0 = 0; j0 < cols; j0 += MATRIX_BLOCK_SIZE) {
+          size_t const j1 = ::std::min(j0 + MATRIX_BLOCK_SIZE, cols);
+          for (size_t i = begin; i < end; i++) {
+            Number_T const * const a_row = a + i * lda;
+            Number_T * const c_row = c + i * ldc;
+            for (size_t j = j0; j < j1; j++) {
+              Number_T const sum = dot(a_row, bt + j * ldbt, depth);
+              c_row[j] = subtract ? modSub<Number_T>(c_row[j], sum, p)
+                                  : sum;
+            }
+          }
+        }
+      });
+}
+
 template<typename Number_T>
 void plainMatrixMult(
     Matrix<Number_T> const * const A,
@@ -297,19 +397,35 @@ void plainMatrixMult(
   log_assert(C->getNumRows() == A->getNumRows());
   log_assert(C->getNumColumns() == B->getNumColumns());
 
-  for (size_t i = 0; i < A->getNumRows(); i++) {
-    for (size_t j = 0; j < B->getNumColumns(); j++) {
-      Number_T sum = 0;
-      for (size_t k = 0;
-           k < A->getNumColumns() /* && k < B->getNumRows() */;
-           k++) {
-        Number_T const a = A->at(i, k);
-        Number_T const b = B->at(k, j);
-        sum = modAdd<Number_T>(sum, a * b, p);
-      }
-      C->at(i, j) = sum;
+  size_t const rows = A->getNumRows();
+  size_t const cols = B->getNumColumns();
+  size_t const depth = A->getNumColumns();
+  if (rows == 0 || cols == 0) {
+    return;
+  }
+  if (depth == 0) {
+    *C = Matrix<Number_T>(rows, cols);
+    return;
+  }
+
+  std::vector<Number_T> bt(cols * depth);
+  for (size_t k = 0; k < depth; k++) {
+    for (size_t j = 0; j < cols; j++) {
+      bt[j * depth + k] = B->at(k, j);
     }
   }
+  matrixMultKernel<Number_T>(
+      &A->at(0, 0),
+      depth,
+      bt.data(),
+      depth,
+      &C->at(0, 0),
+      cols,
+      rows,
+      cols,
+      depth,
+      p,
+      false);
 }
 
 } // namespace mpc
@@ -0,0 +1,159 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/*
+ * Inverts a shared square matrix in a constant number of rounds, by
+ * opening it under a random invertible mask from the dealer.
+ */
+
+#ifndef FF_MPC_MATRIX_INVERSE_H_
+#define FF_MPC_MATRIX_INVERSE_H_
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <ff/Fronctocol.h>
+#include <ff/Message.h>
+
+#include <mpc/Matrix.h>
+#include <mpc/MatrixMult.h>
+#include <mpc/ModUtils.h>
+#include <mpc/Multiply.h>
+#include <mpc/Randomness.h>
+#include <mpc/Reveal.h>
+#include <mpc/templates.h>
+
+/* Logging config */
+#include <ff/logging.h>
+
+namespace ff {
+namespace mpc {
+
+/**
+ * A share of a uniformly random invertible matrix R, shared entry by
+ * entry.
+ */
+template<typename Number_T>
+struct RandomInvertibleMatrix {
+  Matrix<Number_T> r;
+
+  RandomInvertibleMatrix<Number_T>(Matrix<Number_T> && r);
+
+  template<typename Info_T>
+  RandomInvertibleMatrix<Number_T>(Info_T const & info) :
+      r(info.dimension, info.dimension) {
+  }
+
+  static std::string name() {
+    return std::string("Random Invertible Matrix");
+  }
+};
+
+template<typename Number_T>
+struct RandomInvertibleMatrixInfo {
+  Number_T modulus;
+  size_t dimension;
+
+  size_t instanceSize() const {
+    return this->dimension * this->dimension * numberLen(this->modulus);
+  }
+
+  void generate(
+      size_t n_parties,
+      size_t,
+      std::vector<RandomInvertibleMatrix<Number_T>> & vals) const;
+
+  bool
+  operator==(RandomInvertibleMatrixInfo<Number_T> const & other) const {
+    return this->modulus == other.modulus &&
+        this->dimension == other.dimension;
+  }
+
+  bool
+  operator!=(RandomInvertibleMatrixInfo<Number_T> const & other) const {
+    return !(*this == other);
+  }
+
+  RandomInvertibleMatrixInfo<Number_T>(
+      Number_T const & modulus, size_t const dimension) :
+      modulus(modulus), dimension(dimension) {
+  }
+  RandomInvertibleMatrixInfo<Number_T>() = default;
+};
+
+/**
+ * Computes shares of A^-1 for a shared, square A. The parties multiply
+ * R * A with Beaver triples, open it, and invert it in the clear. As
+ * (R * A)^-1 = A^-1 * R^-1 is public, multiplying it back by R is
+ * local, so the whole inversion takes the rounds of one Multiply and
+ * one Reveal.
+ *
+ * R * A is uniformly random when A is invertible, and singular exactly
+ * when A is. A singular A is not an error: invertible is set false and
+ * the output is left as is, since the parties learn it either way.
+ *
+ * It uses dimension^3 Beaver triples, and one RandomInvertibleMatrix
+ * of the same dimension and modulus.
+ */
+template<FF_TYPENAMES, typename Number_T>
+class MatrixInverse : public Fronctocol<FF_TYPES> {
+public:
+  std::string name() override;
+
+  // Input matrix
+  Matrix<Number_T> const * const A;
+
+  // Output matrix
+  Matrix<Number_T> * const AInverse;
+
+  // Whether A was invertible, valid once complete.
+  bool invertible = false;
+
+  MatrixInverse(
+      Matrix<Number_T> const * const A,
+      Matrix<Number_T> * const AInverse,
+      MultiplyInfo<Identity_T, BeaverInfo<Number_T>> mi,
+      ::std::unique_ptr<RandomnessDispenser<
+          BeaverTriple<Number_T>,
+          BeaverInfo<Number_T>>> bts,
+      RandomInvertibleMatrix<Number_T> && mask);
+
+  void init() override;
+  void handleReceive(IncomingMessage_T & imsg) override;
+  void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
+  void handlePromise(ff::Fronctocol<FF_TYPES> & f) override;
+
+private:
+  MultiplyInfo<Identity_T, BeaverInfo<Number_T>> const multInfo;
+  ::std::unique_ptr<
+      RandomnessDispenser<BeaverTriple<Number_T>, BeaverInfo<Number_T>>>
+      beaverTriples;
+
+  RandomInvertibleMatrix<Number_T> mask;
+
+  // Shares of R * A, before it is opened.
+  Matrix<Number_T> masked;
+
+  enum State { awaitingMultiply, awaitingReveal };
+  State state = awaitingMultiply;
+};
+
+} // namespace mpc
+} // namespace ff
+
+#include <mpc/MatrixInverse.t.h>
+
+#define LOG_UNCLUDE
+#include <ff/logging.h>
+
+#endif // FF_MPC_MATRIX_INVERSE_H_
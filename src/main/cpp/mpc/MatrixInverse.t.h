@@ -0,0 +1,209 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+namespace ff {
+
+template<typename Identity_T, typename Number_T>
+bool msg_read(
+    IncomingMessage<Identity_T> & msg,
+    mpc::RandomInvertibleMatrixInfo<Number_T> & info) {
+  uint64_t dimension = 0;
+  bool success = msg.template read<Number_T>(info.modulus);
+  success = success && msg.template read<uint64_t>(dimension);
+  info.dimension = (size_t)dimension;
+  return success;
+}
+
+template<typename Identity_T, typename Number_T>
+bool msg_write(
+    OutgoingMessage<Identity_T> & msg,
+    mpc::RandomInvertibleMatrixInfo<Number_T> const & info) {
+  bool success = msg.template write<Number_T>(info.modulus);
+  success =
+      success && msg.template write<uint64_t>((uint64_t)info.dimension);
+  return success;
+}
+
+template<typename Identity_T, typename Number_T>
+bool msg_read(
+    IncomingMessage<Identity_T> & msg,
+    mpc::RandomInvertibleMatrix<Number_T> & mask) {
+  bool success = true;
+  for (size_t i = 0; i < mask.r.getNumRows(); i++) {
+    for (size_t j = 0; j < mask.r.getNumColumns(); j++) {
+      success =
+          success && msg.template read<Number_T>(mask.r.at(i, j));
+    }
+  }
+  return success;
+}
+
+template<typename Identity_T, typename Number_T>
+bool msg_write(
+    OutgoingMessage<Identity_T> & msg,
+    mpc::RandomInvertibleMatrix<Number_T> const & mask) {
+  bool success = true;
+  for (size_t i = 0; i < mask.r.getNumRows(); i++) {
+    for (size_t j = 0; j < mask.r.getNumColumns(); j++) {
+      success =
+          success && msg.template write<Number_T>(mask.r.at(i, j));
+    }
+  }
+  return success;
+}
+
+namespace mpc {
+
+template<typename Number_T>
+RandomInvertibleMatrix<Number_T>::RandomInvertibleMatrix(
+    Matrix<Number_T> && r) :
+    r(::std::move(r)) {
+}
+
+template<typename Number_T>
+void RandomInvertibleMatrixInfo<Number_T>::generate(
+    size_t n_parties,
+    size_t,
+    std::vector<RandomInvertibleMatrix<Number_T>> & vals) const {
+  size_t const n = this->dimension;
+
+  // Rejection sample, for R uniform over the invertible matrices.
+  Matrix<Number_T> r(n, n);
+  do {
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        r.at(i, j) = randomModP<Number_T>(this->modulus);
+      }
+    }
+  } while (r.Det(this->modulus) == 0);
+
+  vals.clear();
+  vals.reserve(n_parties);
+  for (size_t k = 0; k < n_parties; k++) {
+    vals.emplace_back(Matrix<Number_T>(n, n));
+  }
+
+  ::std::vector<Number_T> shares;
+  shares.reserve(n_parties);
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      arithmeticSecretShare(
+          n_parties, this->modulus, r.at(i, j), shares);
+      for (size_t k = 0; k < n_parties; k++) {
+        vals[k].r.at(i, j) = shares[k];
+      }
+    }
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T>
+std::string MatrixInverse<FF_TYPES, Number_T>::name() {
+  return std::string("MatrixInverse A: ") +
+      std::to_string(this->A->getNumRows()) + "x" +
+      std::to_string(this->A->getNumColumns()) +
+      " mod: " + dec(this->multInfo.info.modulus);
+}
+
+template<FF_TYPENAMES, typename Number_T>
+MatrixInverse<FF_TYPES, Number_T>::MatrixInverse(
+    Matrix<Number_T> const * const A,
+    Matrix<Number_T> * const AInverse,
+    MultiplyInfo<Identity_T, BeaverInfo<Number_T>> mi,
+    ::std::unique_ptr<RandomnessDispenser<
+        BeaverTriple<Number_T>,
+        BeaverInfo<Number_T>>> bts,
+    RandomInvertibleMatrix<Number_T> && mask) :
+    A(A),
+    AInverse(AInverse),
+    multInfo(mi),
+    beaverTriples(::std::move(bts)),
+    mask(::std::move(mask)),
+    masked(A->getNumRows(), A->getNumColumns()) {
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void MatrixInverse<FF_TYPES, Number_T>::init() {
+  size_t const n = this->A->getNumRows();
+  log_assert(n > 0 && n == this->A->getNumColumns());
+  log_assert(this->AInverse->getNumRows() == n);
+  log_assert(this->AInverse->getNumColumns() == n);
+  log_assert(this->mask.r.getNumRows() == n);
+  log_assert(this->mask.r.getNumColumns() == n);
+
+  this->invoke(
+      ::std::unique_ptr<Fronctocol<FF_TYPES>>(
+          new MatrixMult<FF_TYPES, Number_T>(
+              &this->mask.r,
+              this->A,
+              &this->masked,
+              this->multInfo,
+              ::std::move(this->beaverTriples))),
+      this->getPeers());
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void MatrixInverse<FF_TYPES, Number_T>::handleReceive(
+    IncomingMessage_T &) {
+  log_error("MatrixInverse received unexpected handle receive");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void MatrixInverse<FF_TYPES, Number_T>::handleComplete(
+    ff::Fronctocol<FF_TYPES> & f) {
+  size_t const n = this->A->getNumRows();
+  Number_T const & modulus = this->multInfo.info.modulus;
+
+  switch (this->state) {
+    case awaitingMultiply: {
+      ::std::vector<Number_T> shares;
+      shares.reserve(n * n);
+      for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+          shares.push_back(this->masked.at(i, j));
+        }
+      }
+
+      this->state = awaitingReveal;
+      this->invoke(
+          ::std::unique_ptr<Fronctocol<FF_TYPES>>(
+              new BatchedReveal<FF_TYPES, Number_T>(
+                  ::std::move(shares),
+                  modulus,
+                  this->multInfo.revealer,
+                  this->multInfo.opening)),
+          this->getPeers());
+    } break;
+    case awaitingReveal: {
+      BatchedReveal<FF_TYPES, Number_T> & reveal =
+          static_cast<BatchedReveal<FF_TYPES, Number_T> &>(f);
+      Matrix<Number_T> opened(::std::move(reveal.openedValues), n, n);
+
+      this->invertible = opened.Det(modulus) != 0;
+      if (this->invertible) {
+        // A^-1 = (R * A)^-1 * R, where only R is shared.
+        opened.Invert(modulus);
+        plainMatrixMult(
+            &opened, &this->mask.r, this->AInverse, modulus);
+      } else {
+        log_warn("MatrixInverse of a singular matrix");
+      }
+      this->complete();
+    } break;
+    default: {
+      log_error("MatrixInverse received unexpected handle complete");
+      this->abort();
+    }
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void MatrixInverse<FF_TYPES, Number_T>::handlePromise(
+    ff::Fronctocol<FF_TYPES> &) {
+  log_error("MatrixInverse received unexpected handle promise");
+  this->abort();
+}
+
+} // namespace mpc
+} // namespace ff
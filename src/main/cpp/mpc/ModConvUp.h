@@ -16,6 +16,7 @@
 /* C++ Headers */
 #include <cmath>
 #include <cstdint>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -25,8 +26,10 @@
 
 #include <ff/Fronctocol.h>
 #include <ff/Message.h>
+#include <mpc/BatchedTypeCast.h>
 #include <mpc/BitwiseCompare.h>
 #include <mpc/Multiply.h>
+#include <mpc/PackedRandomness.h>
 #include <mpc/PrefixOr.h>
 #include <mpc/Randomness.h>
 #include <mpc/Reveal.h>
@@ -71,6 +74,17 @@ struct TypeCastFromBitInfo {
   TypeCastFromBitInfo<Number_T>() = default;
 };
 
+template<typename Number_T>
+struct PackedRandomness<
+    TypeCastTriple<Number_T>,
+    TypeCastFromBitInfo<Number_T>,
+    typename ::std::enable_if<
+        ::std::is_integral<Number_T>::value>::type>
+    : public PackedTypeCastTriple<
+          Number_T,
+          TypeCastFromBitInfo<Number_T>> {
+};
+
 template<
     typename SmallNumber_T,
     typename MediumNumber_T,
@@ -156,6 +170,57 @@ struct ModConvUpAuxInfo {
   ModConvUpAuxInfo() = default;
 };
 
+/**
+ * An auxiliary instance packs r and x to packedWidth(q) bits each, the
+ * bits of x to packedWidth(s) bits each, and LSB(r) to one bit,
+ * without the length of the bits of x.
+ */
+template<
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+struct PackedRandomness<
+    ModConvUpAux<SmallNumber_T, MediumNumber_T, LargeNumber_T>,
+    ModConvUpAuxInfo<SmallNumber_T, MediumNumber_T, LargeNumber_T>> {
+  using Aux_T =
+      ModConvUpAux<SmallNumber_T, MediumNumber_T, LargeNumber_T>;
+  using Info_T =
+      ModConvUpAuxInfo<SmallNumber_T, MediumNumber_T, LargeNumber_T>;
+
+  static constexpr bool packed = true;
+
+  static size_t bits(Info_T const & info) {
+    return 2 * packedWidth(info.endModulus) +
+        info.x_bitLength * packedWidth(info.smallModulus) + 1;
+  }
+
+  static void pack(
+      BitWriter & writer, Info_T const & info, Aux_T const & aux) {
+    log_assert(aux.bits_of_x.size() == info.x_bitLength);
+    size_t const large_width = packedWidth(info.endModulus);
+    packNumber(writer, aux.r, large_width);
+    packNumber(writer, aux.x, large_width);
+    size_t const small_width = packedWidth(info.smallModulus);
+    for (SmallNumber_T const & bit : aux.bits_of_x) {
+      packNumber(writer, bit, small_width);
+    }
+    writer.write((uint64_t)aux.LSB_of_r, 1);
+  }
+
+  static void
+  unpack(BitReader & reader, Info_T const & info, Aux_T & aux) {
+    size_t const large_width = packedWidth(info.endModulus);
+    unpackNumber(reader, aux.r, large_width);
+    unpackNumber(reader, aux.x, large_width);
+    size_t const small_width = packedWidth(info.smallModulus);
+    aux.bits_of_x.resize(info.x_bitLength);
+    for (SmallNumber_T & bit : aux.bits_of_x) {
+      unpackNumber(reader, bit, small_width);
+    }
+    aux.LSB_of_r = (Boolean_t)reader.read(1);
+  }
+};
+
 template<FF_TYPENAMES, typename Number_T>
 class TypeCastFromBit : public Fronctocol<FF_TYPES> {
 public:
@@ -329,6 +394,115 @@ private:
   Boolean_t fakeAndResult = 0x00;
 };
 
+/**
+ * Randomness for a BatchedModConvUp of batch size N, held in contiguous
+ * arrays rather than in dispensers per conversion:
+ *  - bitwise: 2N, the two BitwiseCompares of each conversion in turn,
+ *  - endPrimeTCTriples: 3N, from a TypeCastFromBitInfo mod q,
+ *  - XORBeavers: 2 * ceil(N / 8), as each AND packs eight conversions,
+ *  - mcuas: N.
+ */
+template<
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+struct BatchedModConvUpRandomness {
+  std::vector<BitwiseCompareRandomness<SmallNumber_T>> bitwise;
+  std::vector<TypeCastTriple<LargeNumber_T>> endPrimeTCTriples;
+  std::vector<BeaverTriple<Boolean_t>> XORBeavers;
+  std::vector<
+      ModConvUpAux<SmallNumber_T, MediumNumber_T, LargeNumber_T>>
+      mcuas;
+
+  static size_t numXORBeavers(size_t const batchSize) {
+    return 2 * ((batchSize + 7) / 8);
+  }
+};
+
+/**
+ * Vectorized ModConvUp, converting a vector of shares mod p to shares
+ * mod q in the rounds of a single conversion. Each step of ModConvUp is
+ * one fronctocol over the whole vector: a BatchedReveal of the masked
+ * inputs, one BatchedBitwiseCompare for both comparisons of every
+ * input, boolean BatchedMultiplys of bits packed eight to a byte, and
+ * one BatchedTypeCastFromBit for all three carry bits of every input.
+ *
+ * The two comparisons do not depend on each other, so they share a
+ * round where ModConvUp takes one each.
+ */
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+class BatchedModConvUp : public Fronctocol<FF_TYPES> {
+public:
+  std::string name() override;
+
+  std::vector<LargeNumber_T> outputShares;
+
+  /*
+   * mod p to mod q, p*num_parties < q
+   */
+  BatchedModConvUp(
+      std::vector<MediumNumber_T> && inputShares,
+      ModConvUpInfo<
+          Identity_T,
+          SmallNumber_T,
+          MediumNumber_T,
+          LargeNumber_T> const * const info,
+      BatchedModConvUpRandomness<
+          SmallNumber_T,
+          MediumNumber_T,
+          LargeNumber_T> && randomness);
+
+  void init() override;
+
+  void handleReceive(IncomingMessage_T & imsg) override;
+
+  void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
+
+  void handlePromise(ff::Fronctocol<FF_TYPES> & fronctocol) override;
+
+private:
+  enum BatchedModConvState {
+    awaitingReveal,
+    awaitingBitwiseCompare,
+    awaitingFirstXORMultiply,
+    awaitingLastXORMultiply,
+    awaitingTypeCast
+  };
+  BatchedModConvState state = awaitingReveal;
+
+  std::vector<MediumNumber_T> const inputShares;
+  ModConvUpInfo<
+      Identity_T,
+      SmallNumber_T,
+      MediumNumber_T,
+      LargeNumber_T> const * const info;
+  BatchedModConvUpRandomness<
+      SmallNumber_T,
+      MediumNumber_T,
+      LargeNumber_T>
+      randomness;
+
+  LargeNumber_T q_tilde = 0U;
+  std::vector<LargeNumber_T> t;
+  std::vector<Boolean_t> LSB_sum_shares_plus_r;
+
+  std::vector<Boolean_t> firstStartPrimeCarryBits;
+  std::vector<Boolean_t> endPrimeCarryBits;
+  std::vector<Boolean_t> andResults;
+
+  /* Conversions whose t + q_tilde < p, needing a second AND. */
+  std::vector<size_t> unwrapped;
+
+  /* Output of each boolean BatchedMultiply, eight bits to a byte. */
+  std::vector<Boolean_t> packedAndResults;
+
+  void invokeTypeCast();
+};
+
 } // namespace mpc
 #include <mpc/ModConvUp.t.h>
 
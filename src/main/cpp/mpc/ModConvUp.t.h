@@ -824,4 +824,325 @@ void ModConvUp<FF_TYPES, SmallNumber_T, MediumNumber_T, LargeNumber_T>::
   }
 }
 
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+std::string BatchedModConvUp<
+    FF_TYPES,
+    SmallNumber_T,
+    MediumNumber_T,
+    LargeNumber_T>::name() {
+  return std::string("Batched Mod Conv Up size: ") +
+      std::to_string(this->inputShares.size()) +
+      " large mod: " + dec(this->info->mcuaInfo.endModulus) +
+      " medium mod: " + dec(this->info->mcuaInfo.startModulus) +
+      " small mod: " + dec(this->info->prefInfo.s);
+}
+
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+BatchedModConvUp<
+    FF_TYPES,
+    SmallNumber_T,
+    MediumNumber_T,
+    LargeNumber_T>::
+    BatchedModConvUp(
+        std::vector<MediumNumber_T> && inputShares,
+        ModConvUpInfo<
+            Identity_T,
+            SmallNumber_T,
+            MediumNumber_T,
+            LargeNumber_T> const * const info,
+        BatchedModConvUpRandomness<
+            SmallNumber_T,
+            MediumNumber_T,
+            LargeNumber_T> && randomness) :
+    inputShares(std::move(inputShares)),
+    info(info),
+    randomness(std::move(randomness)) {
+  size_t const n = this->inputShares.size();
+  log_assert(this->randomness.mcuas.size() == n);
+  log_assert(this->randomness.bitwise.size() == 2 * n);
+  log_assert(this->randomness.endPrimeTCTriples.size() == 3 * n);
+  log_assert(
+      this->randomness.XORBeavers.size() ==
+      this->randomness.numXORBeavers(n));
+}
+
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+void BatchedModConvUp<
+    FF_TYPES,
+    SmallNumber_T,
+    MediumNumber_T,
+    LargeNumber_T>::init() {
+  log_debug("Calling init on BatchedModConvUp");
+  if (this->inputShares.empty()) {
+    this->complete();
+    return;
+  }
+
+  LargeNumber_T const & q = this->info->mcuaInfo.endModulus;
+  std::vector<LargeNumber_T> masked;
+  masked.reserve(this->inputShares.size());
+  for (size_t i = 0; i < this->inputShares.size(); i++) {
+    masked.push_back(modAdd(
+        static_cast<LargeNumber_T>(this->inputShares[i]),
+        this->randomness.mcuas[i].r,
+        q));
+  }
+
+  this->invoke(
+      std::unique_ptr<Fronctocol<FF_TYPES>>(
+          new BatchedReveal<FF_TYPES, LargeNumber_T>(
+              std::move(masked), q, this->info->prefInfo.rev)),
+      this->getPeers());
+}
+
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+void BatchedModConvUp<
+    FF_TYPES,
+    SmallNumber_T,
+    MediumNumber_T,
+    LargeNumber_T>::handlePromise(ff::Fronctocol<FF_TYPES> &) {
+  log_error("Unexpected handlePromise in BatchedModConvUp");
+  this->abort();
+}
+
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+void BatchedModConvUp<
+    FF_TYPES,
+    SmallNumber_T,
+    MediumNumber_T,
+    LargeNumber_T>::handleReceive(IncomingMessage_T &) {
+  log_error("Unexpected handleReceive in BatchedModConvUp");
+  this->abort();
+}
+
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+void BatchedModConvUp<
+    FF_TYPES,
+    SmallNumber_T,
+    MediumNumber_T,
+    LargeNumber_T>::handleComplete(ff::Fronctocol<FF_TYPES> & f) {
+  size_t const n = this->inputShares.size();
+  size_t const ell = this->info->mcuaInfo.x_bitLength;
+  LargeNumber_T const p = this->info->mcuaInfo.startModulus;
+  bool const is_revealer = *this->info->prefInfo.rev == this->getSelf();
+
+  switch (this->state) {
+    case awaitingReveal: {
+      std::vector<LargeNumber_T> const & opened =
+          static_cast<BatchedReveal<FF_TYPES, LargeNumber_T> &>(f)
+              .openedValues;
+      this->q_tilde = this->info->mcuaInfo.endModulus % p;
+      this->t.resize(n);
+      this->LSB_sum_shares_plus_r.resize(n);
+
+      // As ModConvUp, compare x to t + 1, and to (t + q_tilde) % p + 1.
+      std::vector<std::vector<SmallNumber_T>> shares_of_x;
+      std::vector<std::vector<SmallNumber_T>> compare_bits;
+      shares_of_x.reserve(2 * n);
+      compare_bits.reserve(2 * n);
+      for (size_t i = 0; i < n; i++) {
+        this->t[i] = opened[i] % p;
+        this->LSB_sum_shares_plus_r[i] =
+            static_cast<Boolean_t>(opened[i] % 2);
+
+        LargeNumber_T const values[2] = {
+            this->t[i] + 1, (this->t[i] + this->q_tilde) % p + 1};
+        for (LargeNumber_T value : values) {
+          shares_of_x.push_back(this->randomness.mcuas[i].bits_of_x);
+          compare_bits.emplace_back(ell, 0);
+          for (size_t j = 0; j < ell; j++) {
+            compare_bits.back()[ell - 1 - j] =
+                static_cast<SmallNumber_T>(value % 2);
+            value /= 2;
+          }
+        }
+      }
+
+      this->state = awaitingBitwiseCompare;
+      this->invoke(
+          std::unique_ptr<Fronctocol<FF_TYPES>>(
+              new BatchedBitwiseCompare<FF_TYPES, SmallNumber_T>(
+                  std::move(shares_of_x),
+                  std::move(compare_bits),
+                  &this->info->prefInfo,
+                  std::move(this->randomness.bitwise))),
+          this->getPeers());
+    } break;
+    case awaitingBitwiseCompare: {
+      std::vector<Boolean_t> const & compares =
+          static_cast<BatchedBitwiseCompare<FF_TYPES, SmallNumber_T> &>(
+              f)
+              .outputShares;
+
+      this->firstStartPrimeCarryBits.resize(n);
+      this->endPrimeCarryBits.resize(n);
+      std::vector<Boolean_t> lhs((n + 7) / 8, 0x00);
+      std::vector<Boolean_t> rhs((n + 7) / 8, 0x00);
+      for (size_t i = 0; i < n; i++) {
+        Boolean_t first = compares[2 * i] % 2;
+        Boolean_t second = compares[2 * i + 1] % 2;
+        Boolean_t end =
+            static_cast<Boolean_t>(this->inputShares[i] % 2) ^
+            this->randomness.mcuas[i].LSB_of_r;
+        if (is_revealer) {
+          first = first ^ 0x01;
+          end = end ^ this->LSB_sum_shares_plus_r[i];
+        }
+        if (this->t[i] + this->q_tilde >= p) {
+          second = second ^ first;
+        } else {
+          this->unwrapped.push_back(i);
+        }
+        this->firstStartPrimeCarryBits[i] = first;
+        this->endPrimeCarryBits[i] = end;
+
+        lhs[i / 8] |= static_cast<Boolean_t>(end << (i % 8));
+        rhs[i / 8] |= static_cast<Boolean_t>(second << (i % 8));
+      }
+
+      std::vector<BeaverTriple<Boolean_t>> beavers(
+          this->randomness.XORBeavers.begin(),
+          this->randomness.XORBeavers.begin() + lhs.size());
+
+      this->state = awaitingFirstXORMultiply;
+      std::unique_ptr<Fronctocol<FF_TYPES>> multiply(
+          new BatchedMultiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>(
+              std::move(lhs),
+              std::move(rhs),
+              &this->packedAndResults,
+              std::move(beavers),
+              &this->info->multiplyInfo));
+      this->invoke(std::move(multiply), this->getPeers());
+    } break;
+    case awaitingFirstXORMultiply: {
+      this->andResults.resize(n);
+      for (size_t i = 0; i < n; i++) {
+        this->andResults[i] =
+            (this->packedAndResults[i / 8] >> (i % 8)) & 0x01;
+      }
+      if (this->unwrapped.empty()) {
+        this->invokeTypeCast();
+        break;
+      }
+
+      // Whether t + q_tilde wraps is public, so only the conversions
+      // that do not wrap take the second AND.
+      size_t const m = this->unwrapped.size();
+      std::vector<Boolean_t> lhs((m + 7) / 8, 0x00);
+      std::vector<Boolean_t> rhs((m + 7) / 8, 0x00);
+      for (size_t k = 0; k < m; k++) {
+        size_t const i = this->unwrapped[k];
+        lhs[k / 8] |=
+            static_cast<Boolean_t>(this->andResults[i] << (k % 8));
+        rhs[k / 8] |= static_cast<Boolean_t>(
+            this->firstStartPrimeCarryBits[i] << (k % 8));
+      }
+
+      size_t const offset = (n + 7) / 8;
+      std::vector<BeaverTriple<Boolean_t>> beavers(
+          this->randomness.XORBeavers.begin() + offset,
+          this->randomness.XORBeavers.begin() + offset + lhs.size());
+
+      this->state = awaitingLastXORMultiply;
+      std::unique_ptr<Fronctocol<FF_TYPES>> multiply(
+          new BatchedMultiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>(
+              std::move(lhs),
+              std::move(rhs),
+              &this->packedAndResults,
+              std::move(beavers),
+              &this->info->multiplyInfo));
+      this->invoke(std::move(multiply), this->getPeers());
+    } break;
+    case awaitingLastXORMultiply: {
+      for (size_t k = 0; k < this->unwrapped.size(); k++) {
+        this->andResults[this->unwrapped[k]] =
+            (this->packedAndResults[k / 8] >> (k % 8)) & 0x01;
+      }
+      this->invokeTypeCast();
+    } break;
+    case awaitingTypeCast: {
+      using TypeCast = BatchedTypeCastFromBit<FF_TYPES, LargeNumber_T>;
+      std::vector<LargeNumber_T> const & bits =
+          static_cast<TypeCast &>(f).outputBitShares[0];
+      LargeNumber_T const & q = this->info->mcuaInfo.endModulus;
+
+      // t - x + p * first + q_tilde * end - p * and, with only the
+      // revealer adding the public t.
+      this->outputShares.resize(n);
+      for (size_t i = 0; i < n; i++) {
+        LargeNumber_T share = modAdd(
+            modMul(p, bits[3 * i], q),
+            modAdd(
+                modMul(this->q_tilde, bits[3 * i + 1], q),
+                modMul(q - p, bits[3 * i + 2], q),
+                q),
+            q);
+        share = modAdd(share, q - this->randomness.mcuas[i].x, q);
+        if (is_revealer) {
+          share = modAdd(share, this->t[i], q);
+        }
+        this->outputShares[i] = share;
+      }
+      this->complete();
+    } break;
+    default:
+      log_error("BatchedModConvUp state machine in unexpected state");
+      this->abort();
+  }
+}
+
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+void BatchedModConvUp<
+    FF_TYPES,
+    SmallNumber_T,
+    MediumNumber_T,
+    LargeNumber_T>::invokeTypeCast() {
+  size_t const n = this->inputShares.size();
+  std::vector<Boolean_t> bits;
+  bits.reserve(3 * n);
+  for (size_t i = 0; i < n; i++) {
+    bits.push_back(this->firstStartPrimeCarryBits[i]);
+    bits.push_back(this->endPrimeCarryBits[i]);
+    bits.push_back(this->andResults[i]);
+  }
+
+  this->state = awaitingTypeCast;
+  this->invoke(
+      std::unique_ptr<Fronctocol<FF_TYPES>>(
+          new BatchedTypeCastFromBit<FF_TYPES, LargeNumber_T>(
+              bits,
+              this->info->mcuaInfo.endModulus,
+              this->info->prefInfo.rev,
+              this->randomness.endPrimeTCTriples)),
+      this->getPeers());
+}
+
 } // namespace mpc
@@ -18,6 +18,7 @@
 /* Fortissimo Headers */
 
 #include <ff/Fronctocol.h>
+#include <ff/Promise.h>
 #include <mpc/ModConvUp.h>
 #include <mpc/Multiply.h>
 #include <mpc/PrefixOrDealer.h>
@@ -158,6 +159,93 @@ private:
       fullModConvUpAuxDispenser;
 };
 
+/**
+ * Deals the randomness for one BatchedModConvUp of batchSize
+ * conversions, from the same ModConvUpRandomnessHouse as the patron
+ * above. Rather than a dispenser of ModConvUpRandomness, it fills the
+ * contiguous arrays of a BatchedModConvUpRandomness, and asks for only
+ * as many XOR triples as the packed ANDs use.
+ */
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+class BatchedModConvUpRandomnessPatron : public Fronctocol<FF_TYPES> {
+public:
+  std::string name() override;
+
+  void init() override;
+  void handleReceive(IncomingMessage_T & imsg) override;
+  void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
+  void handlePromise(ff::Fronctocol<FF_TYPES> & f) override;
+
+  BatchedModConvUpRandomness<
+      SmallNumber_T,
+      MediumNumber_T,
+      LargeNumber_T>
+      randomness;
+
+  BatchedModConvUpRandomnessPatron(
+      ModConvUpInfo<
+          Identity_T,
+          SmallNumber_T,
+          MediumNumber_T,
+          LargeNumber_T> const * const info,
+      Identity_T const * const dealerIdentity,
+      const size_t batchSize);
+
+private:
+  void generateOutput();
+
+  ModConvUpInfo<
+      Identity_T,
+      SmallNumber_T,
+      MediumNumber_T,
+      LargeNumber_T> const * const info;
+  const Identity_T * dealerIdentity;
+  size_t batchSize;
+
+  size_t numBitwiseComparesNeeded = 2;
+  size_t numEndPrimeTCTsNeeded = 3;
+
+  /*
+   * Every randomness type is requested from the dealer at once: the
+   * PrefixOr patron is invoked, and the rest are joined promises.
+   */
+  PromiseJoin<FF_TYPES> join;
+  bool awaitingPrefixOr = true;
+
+  std::unique_ptr<RandomnessDispenser<
+      PrefixOrRandomness<SmallNumber_T>,
+      DoNotGenerateInfo>>
+      fullPrefixOrDispenser;
+
+  std::unique_ptr<RandomnessDispenser<
+      BeaverTriple<SmallNumber_T>,
+      BeaverInfo<SmallNumber_T>>>
+      fullStartPrimeMultiplyDispenser;
+
+  std::unique_ptr<RandomnessDispenser<
+      TypeCastTriple<SmallNumber_T>,
+      TypeCastInfo<SmallNumber_T>>>
+      fullStartTCTDispenser;
+
+  std::unique_ptr<RandomnessDispenser<
+      TypeCastTriple<LargeNumber_T>,
+      TypeCastFromBitInfo<LargeNumber_T>>>
+      fullEndPrimeTCTDispenser;
+
+  std::unique_ptr<
+      RandomnessDispenser<BeaverTriple<Boolean_t>, BooleanBeaverInfo>>
+      fullXORMultiplyDispenser;
+
+  std::unique_ptr<RandomnessDispenser<
+      ModConvUpAux<SmallNumber_T, MediumNumber_T, LargeNumber_T>,
+      ModConvUpAuxInfo<SmallNumber_T, MediumNumber_T, LargeNumber_T>>>
+      fullModConvUpAuxDispenser;
+};
+
 } // namespace mpc
 } // namespace ff
 
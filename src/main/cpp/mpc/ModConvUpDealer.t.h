@@ -437,5 +437,277 @@ void ModConvUpRandomnessPatron<
   this->complete();
 }
 
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+std::string BatchedModConvUpRandomnessPatron<
+    FF_TYPES,
+    SmallNumber_T,
+    MediumNumber_T,
+    LargeNumber_T>::name() {
+  return std::string(
+             "Batched Mod Conv Up Randomness Patron large mod: ") +
+      dec(this->info->mcuaInfo.endModulus) +
+      " medium mod: " + dec(this->info->mcuaInfo.startModulus) +
+      " small mod: " + dec(this->info->prefInfo.s) +
+      " size: " + std::to_string(this->batchSize);
+}
+
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+BatchedModConvUpRandomnessPatron<
+    FF_TYPES,
+    SmallNumber_T,
+    MediumNumber_T,
+    LargeNumber_T>::
+    BatchedModConvUpRandomnessPatron(
+        ModConvUpInfo<
+            Identity_T,
+            SmallNumber_T,
+            MediumNumber_T,
+            LargeNumber_T> const * const info,
+        const Identity_T * dealerIdentity,
+        const size_t batchSize) :
+    info(info), dealerIdentity(dealerIdentity), batchSize(batchSize) {
+}
+
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+void BatchedModConvUpRandomnessPatron<
+    FF_TYPES,
+    SmallNumber_T,
+    MediumNumber_T,
+    LargeNumber_T>::init() {
+  log_debug("BatchedModConvUpPatron init");
+
+  /* The house invokes its houses in this same order. */
+  std::unique_ptr<Fronctocol<FF_TYPES>> patron(
+      new PrefixOrRandomnessPatron<FF_TYPES, SmallNumber_T>(
+          &info->prefInfo,
+          dealerIdentity,
+          this->numBitwiseComparesNeeded * this->batchSize));
+  this->invoke(std::move(patron), this->getPeers());
+
+  this->join.add(
+      *this,
+      std::unique_ptr<PromiseFronctocol<
+          FF_TYPES,
+          RandomnessDispenser<
+              BeaverTriple<SmallNumber_T>,
+              BeaverInfo<SmallNumber_T>>>>(
+          new RandomnessPatron<
+              FF_TYPES,
+              BeaverTriple<SmallNumber_T>,
+              BeaverInfo<SmallNumber_T>>(
+              *dealerIdentity,
+              2 * this->numBitwiseComparesNeeded * this->batchSize,
+              BeaverInfo<SmallNumber_T>(
+                  this->info->mcuaInfo.smallModulus))),
+      this->getPeers(),
+      &this->fullStartPrimeMultiplyDispenser);
+
+  this->join.add(
+      *this,
+      std::unique_ptr<PromiseFronctocol<
+          FF_TYPES,
+          RandomnessDispenser<
+              TypeCastTriple<SmallNumber_T>,
+              TypeCastInfo<SmallNumber_T>>>>(
+          new RandomnessPatron<
+              FF_TYPES,
+              TypeCastTriple<SmallNumber_T>,
+              TypeCastInfo<SmallNumber_T>>(
+              *dealerIdentity,
+              2 * this->numBitwiseComparesNeeded * this->batchSize,
+              TypeCastInfo<SmallNumber_T>(
+                  this->info->mcuaInfo.smallModulus))),
+      this->getPeers(),
+      &this->fullStartTCTDispenser);
+
+  this->join.add(
+      *this,
+      std::unique_ptr<PromiseFronctocol<
+          FF_TYPES,
+          RandomnessDispenser<
+              TypeCastTriple<LargeNumber_T>,
+              TypeCastFromBitInfo<LargeNumber_T>>>>(
+          new RandomnessPatron<
+              FF_TYPES,
+              TypeCastTriple<LargeNumber_T>,
+              TypeCastFromBitInfo<LargeNumber_T>>(
+              *dealerIdentity,
+              this->numEndPrimeTCTsNeeded * this->batchSize,
+              TypeCastFromBitInfo<LargeNumber_T>(
+                  this->info->mcuaInfo.endModulus))),
+      this->getPeers(),
+      &this->fullEndPrimeTCTDispenser);
+
+  this->join.add(
+      *this,
+      std::unique_ptr<PromiseFronctocol<
+          FF_TYPES,
+          RandomnessDispenser<
+              BeaverTriple<Boolean_t>,
+              BooleanBeaverInfo>>>(new RandomnessPatron<
+                                   FF_TYPES,
+                                   BeaverTriple<Boolean_t>,
+                                   BooleanBeaverInfo>(
+          *dealerIdentity,
+          this->randomness.numXORBeavers(this->batchSize),
+          BooleanBeaverInfo())),
+      this->getPeers(),
+      &this->fullXORMultiplyDispenser);
+
+  this->join.add(
+      *this,
+      std::unique_ptr<PromiseFronctocol<
+          FF_TYPES,
+          RandomnessDispenser<
+              ModConvUpAux<
+                  SmallNumber_T,
+                  MediumNumber_T,
+                  LargeNumber_T>,
+              ModConvUpAuxInfo<
+                  SmallNumber_T,
+                  MediumNumber_T,
+                  LargeNumber_T>>>>(
+          new RandomnessPatron<
+              FF_TYPES,
+              ModConvUpAux<
+                  SmallNumber_T,
+                  MediumNumber_T,
+                  LargeNumber_T>,
+              ModConvUpAuxInfo<
+                  SmallNumber_T,
+                  MediumNumber_T,
+                  LargeNumber_T>>(
+              *dealerIdentity, this->batchSize, this->info->mcuaInfo)),
+      this->getPeers(),
+      &this->fullModConvUpAuxDispenser);
+}
+
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+void BatchedModConvUpRandomnessPatron<
+    FF_TYPES,
+    SmallNumber_T,
+    MediumNumber_T,
+    LargeNumber_T>::handleReceive(IncomingMessage_T &) {
+  log_error("BatchedModConvUpPatron Fronctocol received unexpected "
+            "handle receive");
+  this->abort();
+}
+
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+void BatchedModConvUpRandomnessPatron<
+    FF_TYPES,
+    SmallNumber_T,
+    MediumNumber_T,
+    LargeNumber_T>::handleComplete(ff::Fronctocol<FF_TYPES> & f) {
+  log_debug("BatchedModConvUpPatron received handle complete");
+  if (!this->awaitingPrefixOr) {
+    log_error("BatchedModConvUpPatron received unexpected "
+              "handle complete");
+    this->abort();
+    return;
+  }
+
+  this->fullPrefixOrDispenser = std::move(
+      static_cast<PrefixOrRandomnessPatron<FF_TYPES, SmallNumber_T> &>(
+          f)
+          .prefixOrDispenser);
+  this->awaitingPrefixOr = false;
+
+  if (this->join.done()) {
+    this->generateOutput();
+  }
+}
+
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+void BatchedModConvUpRandomnessPatron<
+    FF_TYPES,
+    SmallNumber_T,
+    MediumNumber_T,
+    LargeNumber_T>::handlePromise(ff::Fronctocol<FF_TYPES> & f) {
+  log_debug("BatchedModConvUpPatron received handle promise");
+  if (!this->join.collect(f)) {
+    log_error("BatchedModConvUpPatron received an unexpected promise");
+    this->abort();
+    return;
+  }
+
+  if (this->join.done() && !this->awaitingPrefixOr) {
+    this->generateOutput();
+  }
+}
+
+template<
+    FF_TYPENAMES,
+    typename SmallNumber_T,
+    typename MediumNumber_T,
+    typename LargeNumber_T>
+void BatchedModConvUpRandomnessPatron<
+    FF_TYPES,
+    SmallNumber_T,
+    MediumNumber_T,
+    LargeNumber_T>::generateOutput() {
+  this->randomness.mcuas.reserve(this->batchSize);
+  for (size_t i = 0; i < this->batchSize; i++) {
+    this->randomness.mcuas.emplace_back(
+        this->fullModConvUpAuxDispenser->get());
+  }
+
+  size_t const numBitwise =
+      this->numBitwiseComparesNeeded * this->batchSize;
+  this->randomness.bitwise.reserve(numBitwise);
+  for (size_t i = 0; i < numBitwise; i++) {
+    this->randomness.bitwise.emplace_back(
+        this->fullPrefixOrDispenser->get(),
+        this->fullStartPrimeMultiplyDispenser->get(),
+        this->fullStartTCTDispenser->get(),
+        this->fullStartPrimeMultiplyDispenser->get(),
+        this->fullStartTCTDispenser->get());
+  }
+
+  size_t const numEndTCTs =
+      this->numEndPrimeTCTsNeeded * this->batchSize;
+  this->randomness.endPrimeTCTriples.reserve(numEndTCTs);
+  for (size_t i = 0; i < numEndTCTs; i++) {
+    this->randomness.endPrimeTCTriples.emplace_back(
+        this->fullEndPrimeTCTDispenser->get());
+  }
+
+  size_t const numXORBeavers = BatchedModConvUpRandomness<
+      SmallNumber_T,
+      MediumNumber_T,
+      LargeNumber_T>::numXORBeavers(this->batchSize);
+  this->randomness.XORBeavers.reserve(numXORBeavers);
+  for (size_t i = 0; i < numXORBeavers; i++) {
+    this->randomness.XORBeavers.emplace_back(
+        this->fullXORMultiplyDispenser->get());
+  }
+
+  this->complete();
+}
+
 } // namespace mpc
 } // namespace ff
@@ -115,11 +115,13 @@ modInvert(sst::bignum const & num, sst::bignum const & mod) {
 
 template<>
 uint32_t modInvert(uint32_t const & a, uint32_t const & modulus) {
-  uint32_t r_zero = modulus;
-  uint32_t r_one = a;
-  uint32_t t_zero = 0;
-  uint32_t t_one = 1;
-  uint32_t r_two, t_two, q;
+  // The Bezout coefficient is in (-modulus, modulus), which takes a
+  // signed type wider than the modulus.
+  int64_t r_zero = modulus;
+  int64_t r_one = a;
+  int64_t t_zero = 0;
+  int64_t t_one = 1;
+  int64_t r_two, t_two, q;
 
   while (r_one != 0) {
     q = r_zero / r_one;
@@ -130,18 +132,21 @@ uint32_t modInvert(uint32_t const & a, uint32_t const & modulus) {
     r_one = r_two;
     t_one = t_two;
   }
-  t_zero += modulus;
-  t_zero %= modulus;
-  return t_zero;
+  if (t_zero < 0) {
+    t_zero += modulus;
+  }
+  return (uint32_t)t_zero;
 }
 
 template<>
 uint64_t modInvert(uint64_t const & a, uint64_t const & modulus) {
-  uint64_t r_zero = modulus;
-  uint64_t r_one = a;
-  uint64_t t_zero = 0;
-  uint64_t t_one = 1;
-  uint64_t r_two, t_two, q;
+  // The Bezout coefficient is in (-modulus, modulus), which takes a
+  // signed type wider than the modulus.
+  __int128_t r_zero = modulus;
+  __int128_t r_one = a;
+  __int128_t t_zero = 0;
+  __int128_t t_one = 1;
+  __int128_t r_two, t_two, q;
 
   while (r_one != 0) {
     q = r_zero / r_one;
@@ -152,9 +157,10 @@ uint64_t modInvert(uint64_t const & a, uint64_t const & modulus) {
     r_one = r_two;
     t_one = t_two;
   }
-  t_zero += modulus;
-  t_zero %= modulus;
-  return t_zero;
+  if (t_zero < 0) {
+    t_zero += modulus;
+  }
+  return (uint64_t)t_zero;
 }
 
 } // namespace mpc
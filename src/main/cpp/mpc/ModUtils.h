@@ -5,6 +5,8 @@
 #ifndef FF_MPC_MOD_UTIL_H_
 #define FF_MPC_MOD_UTIL_H_
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 
 /** Logging config */
@@ -37,6 +39,85 @@ modSub(Number_T const & a, Number_T const & b, Number_T const & p) {
 template<typename Number_T>
 std::size_t approxLog2(Number_T val);
 
+/**
+ * Sums of products mod p. Operands must be reduced mod p.
+ */
+template<typename Number_T>
+struct ModDotProduct {
+  Number_T const p;
+
+  explicit ModDotProduct(Number_T const & p) : p(p) {
+  }
+
+  Number_T operator()(
+      Number_T const * const a,
+      Number_T const * const b,
+      std::size_t const len) const {
+    Number_T sum = 0;
+    for (std::size_t i = 0; i < len; i++) {
+      sum = modAdd<Number_T>(sum, modMul<Number_T>(a[i], b[i], p), p);
+    }
+    return sum;
+  }
+};
+
+/**
+ * Integer dot products add the products into a double width integer,
+ * and reduce only when the next product might overflow it, rather than
+ * dividing once per product.
+ */
+template<typename Number_T, typename Wide_T>
+struct WideModDotProduct {
+  Number_T const p;
+
+  /* Products which may be added to a reduced sum without overflow. */
+  std::size_t const maxTerms;
+
+  explicit WideModDotProduct(Number_T const & p) :
+      p(p), maxTerms(WideModDotProduct::terms(p)) {
+  }
+
+  Number_T operator()(
+      Number_T const * const a,
+      Number_T const * const b,
+      std::size_t const len) const {
+    Wide_T sum = 0;
+    std::size_t i = 0;
+    while (i < len) {
+      std::size_t const end = i + std::min(this->maxTerms, len - i);
+      for (; i < end; i++) {
+        sum += (Wide_T)a[i] * (Wide_T)b[i];
+      }
+      sum %= (Wide_T)this->p;
+    }
+    return (Number_T)sum;
+  }
+
+private:
+  static std::size_t terms(Number_T const & p) {
+    Wide_T const max_residue = p > 1 ? (Wide_T)(p - 1) : 1;
+    Wide_T const max_terms =
+        (~(Wide_T)0 - max_residue) / (max_residue * max_residue);
+    return max_terms < (Wide_T)SIZE_MAX ? (std::size_t)max_terms
+                                        : SIZE_MAX;
+  }
+};
+
+template<>
+struct ModDotProduct<uint32_t> : WideModDotProduct<uint32_t, uint64_t> {
+  explicit ModDotProduct(uint32_t const & p) :
+      WideModDotProduct<uint32_t, uint64_t>(p) {
+  }
+};
+
+template<>
+struct ModDotProduct<uint64_t>
+    : WideModDotProduct<uint64_t, __uint128_t> {
+  explicit ModDotProduct(uint64_t const & p) :
+      WideModDotProduct<uint64_t, __uint128_t>(p) {
+  }
+};
+
 /*
  * Inverts a mod s
  */
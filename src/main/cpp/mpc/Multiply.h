@@ -18,6 +18,8 @@
 
 /* C++ Headers */
 #include <cstdint>
+#include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -28,6 +30,8 @@
 #include <ff/Fronctocol.h>
 #include <ff/Message.h>
 #include <mpc/ModUtils.h>
+#include <mpc/Opening.h>
+#include <mpc/PackedRandomness.h>
 #include <mpc/Randomness.h>
 #include <mpc/templates.h>
 
@@ -103,13 +107,58 @@ struct BooleanBeaverInfo {
   }
 };
 
+/**
+ * Beaver triples of an integral modulus pack to three fields of
+ * packedWidth(modulus) bits.
+ */
+template<typename Number_T>
+struct PackedRandomness<
+    BeaverTriple<Number_T>,
+    BeaverInfo<Number_T>,
+    typename ::std::enable_if<
+        ::std::is_integral<Number_T>::value>::type> {
+  static constexpr bool packed = true;
+
+  static size_t bits(BeaverInfo<Number_T> const & info) {
+    return 3 * packedWidth(info.modulus);
+  }
+
+  static void pack(
+      BitWriter & writer,
+      BeaverInfo<Number_T> const & info,
+      BeaverTriple<Number_T> const & triple) {
+    size_t const width = packedWidth(info.modulus);
+    writer.write((uint64_t)triple.a, width);
+    writer.write((uint64_t)triple.b, width);
+    writer.write((uint64_t)triple.c, width);
+  }
+
+  static void unpack(
+      BitReader & reader,
+      BeaverInfo<Number_T> const & info,
+      BeaverTriple<Number_T> & triple) {
+    size_t const width = packedWidth(info.modulus);
+    triple.a = (Number_T)reader.read(width);
+    triple.b = (Number_T)reader.read(width);
+    triple.c = (Number_T)reader.read(width);
+  }
+};
+
+/**
+ * The revealer adds the public d * e into its share of the product, and
+ * is the root of king and tree openings of d and e.
+ */
 template<typename Identity_T, typename Info_T>
 struct MultiplyInfo {
   Identity_T const * const revealer;
   Info_T const info;
+  Opening const opening;
 
-  MultiplyInfo(Identity_T const * const r, Info_T const & i) :
-      revealer(r), info(i) {
+  MultiplyInfo(
+      Identity_T const * const r,
+      Info_T const & i,
+      Opening const & o = Opening()) :
+      revealer(r), info(i), opening(o) {
   }
 };
 
@@ -117,7 +166,7 @@ template<
     FF_TYPENAMES,
     typename Number_T,
     typename Info_T = BeaverInfo<Number_T>>
-class Multiply : public Fronctocol<FF_TYPES> {
+class Multiply : public OpeningFronctocol<FF_TYPES> {
 public:
   virtual std::string name() override;
   // share of z, for z = x * y, where shares of x and y are below
@@ -136,6 +185,7 @@ public:
       Number_T * const out,
       BeaverTriple<Number_T> && b,
       MultiplyInfo<Identity_T, Info_T> const * const i) :
+      OpeningFronctocol<FF_TYPES>(i->opening, i->revealer),
       myShare_z(out),
       myShare_x(ms_x),
       myShare_y(ms_y),
@@ -148,12 +198,71 @@ public:
   void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
   void handlePromise(ff::Fronctocol<FF_TYPES> & f) override;
 
+protected:
+  void writeShares(OutgoingMessage_T & omsg) override;
+  void combineShares(IncomingMessage_T & imsg) override;
+  void readOpened(IncomingMessage_T & imsg) override;
+  void opened() override;
+
 private:
   Number_T revealed_d = 0;
   Number_T revealed_e = 0;
-  size_t numOutstandingMessages = 0;
+};
+
+/**
+ * Multiplies many pairs of arithmetic shares in lock-step, exchanging
+ * a single message with each peer for all of the pairs. This avoids the
+ * overhead of one Multiply fronctocol per pair when many independent
+ * products are needed in the same round.
+ *
+ * Results are written to myShares_z, which is resized to the number of
+ * pairs.
+ */
+template<
+    FF_TYPENAMES,
+    typename Number_T,
+    typename Info_T = BeaverInfo<Number_T>>
+class BatchedMultiply : public OpeningFronctocol<FF_TYPES> {
+public:
+  virtual std::string name() override;
+
+  ::std::vector<Number_T> * const myShares_z;
+
+  ::std::vector<Number_T> const myShares_x;
+  ::std::vector<Number_T> const myShares_y;
+
+  ::std::vector<BeaverTriple<Number_T>> beavers;
+
+  MultiplyInfo<Identity_T, Info_T> const * const info;
+
+  BatchedMultiply(
+      ::std::vector<Number_T> && ms_x,
+      ::std::vector<Number_T> && ms_y,
+      ::std::vector<Number_T> * const out,
+      ::std::vector<BeaverTriple<Number_T>> && bs,
+      MultiplyInfo<Identity_T, Info_T> const * const i) :
+      OpeningFronctocol<FF_TYPES>(i->opening, i->revealer),
+      myShares_z(out),
+      myShares_x(::std::move(ms_x)),
+      myShares_y(::std::move(ms_y)),
+      beavers(::std::move(bs)),
+      info(i) {
+  }
+
+  void init() override;
+  void handleReceive(IncomingMessage_T & imsg) override;
+  void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
+  void handlePromise(ff::Fronctocol<FF_TYPES> & f) override;
 
-  void computeResultShare();
+protected:
+  void writeShares(OutgoingMessage_T & omsg) override;
+  void combineShares(IncomingMessage_T & imsg) override;
+  void readOpened(IncomingMessage_T & imsg) override;
+  void opened() override;
+
+private:
+  ::std::vector<Number_T> revealed_d;
+  ::std::vector<Number_T> revealed_e;
 };
 
 } // namespace mpc
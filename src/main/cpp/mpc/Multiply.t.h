@@ -97,26 +97,42 @@ std::string Multiply<FF_TYPES, Number_T, Info_T>::name() {
 
 template<FF_TYPENAMES, typename Number_T, typename Info_T>
 void Multiply<FF_TYPES, Number_T, Info_T>::init() {
-  this->numOutstandingMessages = 0;
   this->revealed_d =
       modSub(this->myShare_x, this->beaver.a, this->info->info.modulus);
   this->revealed_e =
       modSub(this->myShare_y, this->beaver.b, this->info->info.modulus);
 
-  this->getPeers().forEach([this](Identity_T const & other) {
-    if (this->getSelf() != other) {
-      std::unique_ptr<OutgoingMessage_T> omsg(
-          new OutgoingMessage_T(other));
-      omsg->template write<Number_T>(this->revealed_d);
-      omsg->template write<Number_T>(this->revealed_e);
-      this->send(std::move(omsg));
-      this->numOutstandingMessages++;
-    }
-  });
+  this->open();
+}
+
+template<FF_TYPENAMES, typename Number_T, typename Info_T>
+void Multiply<FF_TYPES, Number_T, Info_T>::writeShares(
+    OutgoingMessage_T & omsg) {
+  omsg.template write<Number_T>(this->revealed_d);
+  omsg.template write<Number_T>(this->revealed_e);
+}
+
+template<FF_TYPENAMES, typename Number_T, typename Info_T>
+void Multiply<FF_TYPES, Number_T, Info_T>::combineShares(
+    IncomingMessage_T & imsg) {
+  Number_T temp_val = 0;
+  imsg.template read<Number_T>(temp_val);
+  this->revealed_d =
+      modAdd(this->revealed_d, temp_val, this->info->info.modulus);
+  imsg.template read<Number_T>(temp_val);
+  this->revealed_e =
+      modAdd(this->revealed_e, temp_val, this->info->info.modulus);
+}
+
+template<FF_TYPENAMES, typename Number_T, typename Info_T>
+void Multiply<FF_TYPES, Number_T, Info_T>::readOpened(
+    IncomingMessage_T & imsg) {
+  imsg.template read<Number_T>(this->revealed_d);
+  imsg.template read<Number_T>(this->revealed_e);
 }
 
 template<FF_TYPENAMES, typename Number_T, typename Info_T>
-void Multiply<FF_TYPES, Number_T, Info_T>::computeResultShare() {
+void Multiply<FF_TYPES, Number_T, Info_T>::opened() {
   /*
    * z = x * y = (a+d)*(b+e) = a*b + b*d + a*e + d*e = c + b*d + a*e + d*e
    * We hold shares of a,b,c, but d,e are public.
@@ -153,18 +169,7 @@ void Multiply<FF_TYPES, Number_T, Info_T>::computeResultShare() {
 template<FF_TYPENAMES, typename Number_T, typename Info_T>
 void Multiply<FF_TYPES, Number_T, Info_T>::handleReceive(
     IncomingMessage_T & imsg) {
-  Number_T temp_val = 0;
-  imsg.template read<Number_T>(temp_val);
-  this->revealed_d =
-      modAdd(this->revealed_d, temp_val, this->info->info.modulus);
-  imsg.template read<Number_T>(temp_val);
-  this->revealed_e =
-      modAdd(this->revealed_e, temp_val, this->info->info.modulus);
-
-  this->numOutstandingMessages--;
-  if (this->numOutstandingMessages == 0) {
-    this->computeResultShare();
-  }
+  this->receiveOpening(imsg);
 }
 
 template<FF_TYPENAMES, typename Number_t, typename Info_t>
@@ -181,9 +186,118 @@ void Multiply<FF_TYPES, Number_t, Info_t>::handleComplete(
             "handle complete");
 }
 
+template<FF_TYPENAMES, typename Number_T, typename Info_T>
+std::string BatchedMultiply<FF_TYPES, Number_T, Info_T>::name() {
+  return std::string("Batched Multiply size: ") +
+      std::to_string(this->myShares_x.size()) +
+      " mod: " + dec(this->info->info.modulus);
+}
+
+template<FF_TYPENAMES, typename Number_T, typename Info_T>
+void BatchedMultiply<FF_TYPES, Number_T, Info_T>::init() {
+  log_assert(this->myShares_x.size() == this->myShares_y.size());
+  log_assert(this->myShares_x.size() == this->beavers.size());
+
+  Number_T const & modulus = this->info->info.modulus;
+  size_t const n = this->myShares_x.size();
+
+  this->revealed_d.resize(n);
+  this->revealed_e.resize(n);
+  for (size_t i = 0; i < n; i++) {
+    this->revealed_d[i] =
+        modSub(this->myShares_x[i], this->beavers[i].a, modulus);
+    this->revealed_e[i] =
+        modSub(this->myShares_y[i], this->beavers[i].b, modulus);
+  }
+
+  this->open();
+}
+
+template<FF_TYPENAMES, typename Number_T, typename Info_T>
+void BatchedMultiply<FF_TYPES, Number_T, Info_T>::writeShares(
+    OutgoingMessage_T & omsg) {
+  for (size_t i = 0; i < this->revealed_d.size(); i++) {
+    omsg.template write<Number_T>(this->revealed_d[i]);
+    omsg.template write<Number_T>(this->revealed_e[i]);
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T, typename Info_T>
+void BatchedMultiply<FF_TYPES, Number_T, Info_T>::combineShares(
+    IncomingMessage_T & imsg) {
+  Number_T const & modulus = this->info->info.modulus;
+  Number_T temp_val = 0;
+  for (size_t i = 0; i < this->revealed_d.size(); i++) {
+    imsg.template read<Number_T>(temp_val);
+    this->revealed_d[i] =
+        modAdd(this->revealed_d[i], temp_val, modulus);
+    imsg.template read<Number_T>(temp_val);
+    this->revealed_e[i] =
+        modAdd(this->revealed_e[i], temp_val, modulus);
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T, typename Info_T>
+void BatchedMultiply<FF_TYPES, Number_T, Info_T>::readOpened(
+    IncomingMessage_T & imsg) {
+  for (size_t i = 0; i < this->revealed_d.size(); i++) {
+    imsg.template read<Number_T>(this->revealed_d[i]);
+    imsg.template read<Number_T>(this->revealed_e[i]);
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T, typename Info_T>
+void BatchedMultiply<FF_TYPES, Number_T, Info_T>::opened() {
+  Number_T const & modulus = this->info->info.modulus;
+  bool const is_revealer = *this->info->revealer == this->getSelf();
+
+  this->myShares_z->resize(this->myShares_x.size());
+  for (size_t i = 0; i < this->myShares_x.size(); i++) {
+    BeaverTriple<Number_T> const & beaver = this->beavers[i];
+    Number_T z = modAdd(
+        modAdd(
+            modMul(beaver.b, this->revealed_d[i], modulus),
+            modMul(beaver.a, this->revealed_e[i], modulus),
+            modulus),
+        beaver.c,
+        modulus);
+
+    if (is_revealer) {
+      z = modAdd(
+          z,
+          modMul(this->revealed_d[i], this->revealed_e[i], modulus),
+          modulus);
+    }
+    (*this->myShares_z)[i] = z;
+  }
+
+  this->complete();
+}
+
+template<FF_TYPENAMES, typename Number_T, typename Info_T>
+void BatchedMultiply<FF_TYPES, Number_T, Info_T>::handleReceive(
+    IncomingMessage_T & imsg) {
+  this->receiveOpening(imsg);
+}
+
+template<FF_TYPENAMES, typename Number_T, typename Info_T>
+void BatchedMultiply<FF_TYPES, Number_T, Info_T>::handlePromise(
+    ff::Fronctocol<FF_TYPES> &) {
+  log_error("Batched Multiply Fronctocol unexpected handle promise");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Number_T, typename Info_T>
+void BatchedMultiply<FF_TYPES, Number_T, Info_T>::handleComplete(
+    ff::Fronctocol<FF_TYPES> &) {
+  log_error("Batched Multiply Fronctocol received unexpected "
+            "handle complete");
+  this->abort();
+}
+
 template<FF_TYPENAMES>
 class Multiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>
-    : public Fronctocol<FF_TYPES> {
+    : public OpeningFronctocol<FF_TYPES> {
 public:
   virtual std::string name() override {
     return std::string("Multiply Boolean");
@@ -205,6 +319,7 @@ public:
       Boolean_t * const ms_z,
       BeaverTriple<Boolean_t> && b,
       MultiplyInfo<Identity_T, BooleanBeaverInfo> const * const i) :
+      OpeningFronctocol<FF_TYPES>(i->opening, i->revealer),
       myShare_z(ms_z),
       myShare_x(ms_x),
       myShare_y(ms_y),
@@ -217,12 +332,15 @@ public:
   void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
   void handlePromise(ff::Fronctocol<FF_TYPES> & f) override;
 
+protected:
+  void writeShares(OutgoingMessage_T & omsg) override;
+  void combineShares(IncomingMessage_T & imsg) override;
+  void readOpened(IncomingMessage_T & imsg) override;
+  void opened() override;
+
 private:
   Boolean_t revealed_d = 0;
   Boolean_t revealed_e = 0;
-  size_t numOutstandingMessages = 0;
-
-  void computeResultShare();
 };
 
 template<FF_TYPENAMES>
@@ -241,25 +359,38 @@ void Multiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::handleComplete(
 
 template<FF_TYPENAMES>
 void Multiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::init() {
-  this->numOutstandingMessages = 0;
   this->revealed_d = this->myShare_x ^ this->beaver.a;
   this->revealed_e = this->myShare_y ^ this->beaver.b;
 
-  this->getPeers().forEach([this](Identity_T const & other) {
-    if (this->getSelf() != other) {
-      std::unique_ptr<OutgoingMessage_T> omsg(
-          new OutgoingMessage_T(other));
-      omsg->template write<Boolean_t>(this->revealed_d);
-      omsg->template write<Boolean_t>(this->revealed_e);
-      this->send(std::move(omsg));
-      this->numOutstandingMessages++;
-    }
-  });
+  this->open();
 }
 
 template<FF_TYPENAMES>
-void Multiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::
-    computeResultShare() {
+void Multiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::writeShares(
+    OutgoingMessage_T & omsg) {
+  omsg.template write<Boolean_t>(this->revealed_d);
+  omsg.template write<Boolean_t>(this->revealed_e);
+}
+
+template<FF_TYPENAMES>
+void Multiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::combineShares(
+    IncomingMessage_T & imsg) {
+  Boolean_t temp_val = 0;
+  imsg.template read<Boolean_t>(temp_val);
+  this->revealed_d = this->revealed_d ^ temp_val;
+  imsg.template read<Boolean_t>(temp_val);
+  this->revealed_e = this->revealed_e ^ temp_val;
+}
+
+template<FF_TYPENAMES>
+void Multiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::readOpened(
+    IncomingMessage_T & imsg) {
+  imsg.template read<Boolean_t>(this->revealed_d);
+  imsg.template read<Boolean_t>(this->revealed_e);
+}
+
+template<FF_TYPENAMES>
+void Multiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::opened() {
   /*
    * z = x * y = (a+d)*(b+e) = a*b + b*d + a*e + d*e = c + b*d + a*e + d*e
    * We hold shares of a,b,c, but d,e are public.
@@ -280,17 +411,146 @@ void Multiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::
 template<FF_TYPENAMES>
 void Multiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::handleReceive(
     IncomingMessage_T & imsg) {
+  this->receiveOpening(imsg);
+}
+
+/**
+ * Multiplies (ANDs) many pairs of XOR shared bytes with one opening, as
+ * the boolean Multiply does one. Each byte is eight independent bits,
+ * so callers may pack several small products into each pair.
+ */
+template<FF_TYPENAMES>
+class BatchedMultiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>
+    : public OpeningFronctocol<FF_TYPES> {
+public:
+  virtual std::string name() override {
+    return std::string("Batched Multiply Boolean size: ") +
+        std::to_string(this->myShares_x.size());
+  }
+
+  ::std::vector<Boolean_t> * const myShares_z;
+
+  ::std::vector<Boolean_t> const myShares_x;
+  ::std::vector<Boolean_t> const myShares_y;
+
+  ::std::vector<BeaverTriple<Boolean_t>> beavers;
+
+  MultiplyInfo<Identity_T, BooleanBeaverInfo> const * const info;
+
+  BatchedMultiply(
+      ::std::vector<Boolean_t> && ms_x,
+      ::std::vector<Boolean_t> && ms_y,
+      ::std::vector<Boolean_t> * const out,
+      ::std::vector<BeaverTriple<Boolean_t>> && bs,
+      MultiplyInfo<Identity_T, BooleanBeaverInfo> const * const i) :
+      OpeningFronctocol<FF_TYPES>(i->opening, i->revealer),
+      myShares_z(out),
+      myShares_x(::std::move(ms_x)),
+      myShares_y(::std::move(ms_y)),
+      beavers(::std::move(bs)),
+      info(i) {
+  }
+
+  void init() override;
+  void handleReceive(IncomingMessage_T & imsg) override;
+  void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
+  void handlePromise(ff::Fronctocol<FF_TYPES> & f) override;
+
+protected:
+  void writeShares(OutgoingMessage_T & omsg) override;
+  void combineShares(IncomingMessage_T & imsg) override;
+  void readOpened(IncomingMessage_T & imsg) override;
+  void opened() override;
+
+private:
+  ::std::vector<Boolean_t> revealed_d;
+  ::std::vector<Boolean_t> revealed_e;
+};
+
+template<FF_TYPENAMES>
+void BatchedMultiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::init() {
+  log_assert(this->myShares_x.size() == this->myShares_y.size());
+  log_assert(this->myShares_x.size() == this->beavers.size());
+
+  size_t const n = this->myShares_x.size();
+  this->revealed_d.resize(n);
+  this->revealed_e.resize(n);
+  for (size_t i = 0; i < n; i++) {
+    this->revealed_d[i] = this->myShares_x[i] ^ this->beavers[i].a;
+    this->revealed_e[i] = this->myShares_y[i] ^ this->beavers[i].b;
+  }
+
+  this->open();
+}
+
+template<FF_TYPENAMES>
+void BatchedMultiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::
+    writeShares(OutgoingMessage_T & omsg) {
+  for (size_t i = 0; i < this->revealed_d.size(); i++) {
+    omsg.template write<Boolean_t>(this->revealed_d[i]);
+    omsg.template write<Boolean_t>(this->revealed_e[i]);
+  }
+}
+
+template<FF_TYPENAMES>
+void BatchedMultiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::
+    combineShares(IncomingMessage_T & imsg) {
   Boolean_t temp_val = 0;
-  imsg.template read<Boolean_t>(temp_val);
-  this->revealed_d = this->revealed_d ^ temp_val;
-  imsg.template read<Boolean_t>(temp_val);
-  this->revealed_e = this->revealed_e ^ temp_val;
+  for (size_t i = 0; i < this->revealed_d.size(); i++) {
+    imsg.template read<Boolean_t>(temp_val);
+    this->revealed_d[i] = this->revealed_d[i] ^ temp_val;
+    imsg.template read<Boolean_t>(temp_val);
+    this->revealed_e[i] = this->revealed_e[i] ^ temp_val;
+  }
+}
 
-  this->numOutstandingMessages--;
-  if (this->numOutstandingMessages == 0) {
-    this->computeResultShare();
+template<FF_TYPENAMES>
+void BatchedMultiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::
+    readOpened(IncomingMessage_T & imsg) {
+  for (size_t i = 0; i < this->revealed_d.size(); i++) {
+    imsg.template read<Boolean_t>(this->revealed_d[i]);
+    imsg.template read<Boolean_t>(this->revealed_e[i]);
   }
 }
 
+template<FF_TYPENAMES>
+void BatchedMultiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::opened() {
+  bool const is_revealer = *this->info->revealer == this->getSelf();
+
+  this->myShares_z->resize(this->myShares_x.size());
+  for (size_t i = 0; i < this->myShares_x.size(); i++) {
+    BeaverTriple<Boolean_t> const & beaver = this->beavers[i];
+    Boolean_t z = (beaver.b & this->revealed_d[i]) ^
+        (beaver.a & this->revealed_e[i]) ^ beaver.c;
+    if (is_revealer) {
+      z = z ^ (this->revealed_d[i] & this->revealed_e[i]);
+    }
+    (*this->myShares_z)[i] = z;
+  }
+
+  this->complete();
+}
+
+template<FF_TYPENAMES>
+void BatchedMultiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::
+    handleReceive(IncomingMessage_T & imsg) {
+  this->receiveOpening(imsg);
+}
+
+template<FF_TYPENAMES>
+void BatchedMultiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::
+    handlePromise(ff::Fronctocol<FF_TYPES> &) {
+  log_error("Batched Multiply Fronctocol unexpected handle promise");
+  this->abort();
+}
+
+template<FF_TYPENAMES>
+void BatchedMultiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>::
+    handleComplete(ff::Fronctocol<FF_TYPES> &) {
+  log_error("Batched Multiply Fronctocol received unexpected "
+            "handle complete");
+  this->abort();
+}
+
 } // namespace mpc
 } // namespace ff
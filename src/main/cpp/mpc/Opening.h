@@ -0,0 +1,125 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/*
+ * Message topologies for opening additively shared values, used by
+ * Reveal and by the d and e openings of Multiply.
+ */
+
+#ifndef FF_MPC_OPENING_H_
+#define FF_MPC_OPENING_H_
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <ff/Fronctocol.h>
+#include <mpc/templates.h>
+
+/* Logging configuration */
+#include <ff/logging.h>
+
+namespace ff {
+namespace mpc {
+
+enum class OpeningStrategy {
+  /*
+   * Every party sends its share to every other party: one round, but
+   * n * (n - 1) messages.
+   */
+  allToAll,
+
+  /*
+   * Every party sends its share to the root, which sends back the
+   * opened value: two rounds and 2 * (n - 1) messages, all through the
+   * root.
+   */
+  king,
+
+  /*
+   * Shares are summed up a tree with the given arity towards the root,
+   * and the opened value is sent back down: 2 * (n - 1) messages, no
+   * party handles more than arity + 1 of them, in 2 * log_arity(n)
+   * rounds.
+   */
+  tree
+};
+
+struct Opening {
+  OpeningStrategy strategy;
+  size_t arity;
+
+  Opening(
+      OpeningStrategy const s = OpeningStrategy::allToAll,
+      size_t const a = 2) :
+      strategy(s), arity(a) {
+  }
+};
+
+/**
+ * Base for fronctocols which open shared values. Subclasses call open()
+ * from init() and receiveOpening() from handleReceive(), and implement
+ * the hooks to write their values and to read a peer's.
+ *
+ * The root of king and tree openings is the given identity, or the
+ * least party when it is null.
+ */
+template<FF_TYPENAMES>
+class OpeningFronctocol : public Fronctocol<FF_TYPES> {
+public:
+  Opening const opening;
+
+protected:
+  OpeningFronctocol(Opening const & o, Identity_T const * const r) :
+      opening(o), root(r) {
+  }
+
+  void open();
+  void receiveOpening(IncomingMessage_T & imsg);
+
+  /* Writes this party's values: its share, a partial sum or the opened
+   * value, depending on the stage of the opening. */
+  virtual void writeShares(OutgoingMessage_T & omsg) = 0;
+
+  /* Reads a peer's share or partial sum, adding it to this party's. */
+  virtual void combineShares(IncomingMessage_T & imsg) = 0;
+
+  /* Reads the opened values, replacing this party's partial sum. */
+  virtual void readOpened(IncomingMessage_T & imsg) = 0;
+
+  /* Called once the opened values are held. */
+  virtual void opened() = 0;
+
+private:
+  Identity_T const * const root;
+
+  enum OpeningState { idle, gathering, awaitingParent, done };
+  OpeningState openingState = idle;
+  size_t numOutstandingShares = 0;
+
+  /* Parent and children in a king or tree opening. */
+  ::std::vector<Identity_T> parent;
+  ::std::vector<Identity_T> children;
+
+  void sendShares(Identity_T const & recipient);
+  void gathered();
+};
+
+} // namespace mpc
+} // namespace ff
+
+#include <mpc/Opening.t.h>
+
+#define LOG_UNCLUDE
+#include <ff/logging.h>
+
+#endif //FF_MPC_OPENING_H_
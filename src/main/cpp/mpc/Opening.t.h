@@ -0,0 +1,123 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+namespace ff {
+namespace mpc {
+
+template<FF_TYPENAMES>
+void OpeningFronctocol<FF_TYPES>::open() {
+  this->numOutstandingShares = 0;
+  this->parent.clear();
+  this->children.clear();
+
+  if (this->opening.strategy == OpeningStrategy::allToAll) {
+    this->getPeers().forEach([this](Identity_T const & other) {
+      if (this->getSelf() != other) {
+        this->sendShares(other);
+        this->numOutstandingShares++;
+      }
+    });
+  } else {
+    ::std::vector<Identity_T> order;
+    this->getPeers().forEach(
+        [&order](Identity_T const & id) { order.push_back(id); });
+    ::std::sort(order.begin(), order.end());
+
+    Identity_T const & r =
+        this->root == nullptr ? order.front() : *this->root;
+    size_t const n = order.size();
+    size_t const root_idx = (size_t)(
+        ::std::lower_bound(order.begin(), order.end(), r) -
+        order.begin());
+    size_t const self_idx =
+        (size_t)(::std::lower_bound(
+                     order.begin(), order.end(), this->getSelf()) -
+                 order.begin());
+    if (root_idx == n || order[root_idx] != r) {
+      log_error("Opening root is not a peer");
+      this->abort();
+      return;
+    }
+
+    // A king is the root of a tree as wide as the rest of the parties.
+    size_t arity = this->opening.arity;
+    if (this->opening.strategy == OpeningStrategy::king || arity == 0) {
+      arity = n > 1 ? n - 1 : 1;
+    }
+
+    // Parties are ranked from the root, and the children of rank i are
+    // ranks arity * i + 1 through arity * i + arity.
+    size_t const rank = (self_idx + n - root_idx) % n;
+    if (rank != 0) {
+      size_t const parent_rank = (rank - 1) / arity;
+      this->parent.push_back(order[(parent_rank + root_idx) % n]);
+    }
+    size_t const first_child = rank * arity + 1;
+    size_t const end_child = ::std::min(first_child + arity, n);
+    for (size_t c = first_child; c < end_child; c++) {
+      this->children.push_back(order[(c + root_idx) % n]);
+    }
+    this->numOutstandingShares = this->children.size();
+  }
+
+  this->openingState = gathering;
+  if (this->numOutstandingShares == 0) {
+    this->gathered();
+  }
+}
+
+template<FF_TYPENAMES>
+void OpeningFronctocol<FF_TYPES>::receiveOpening(
+    IncomingMessage_T & imsg) {
+  switch (this->openingState) {
+    case gathering: {
+      this->combineShares(imsg);
+      this->numOutstandingShares--;
+      if (this->numOutstandingShares == 0) {
+        this->gathered();
+      }
+      break;
+    }
+    case awaitingParent: {
+      this->readOpened(imsg);
+      for (Identity_T const & child : this->children) {
+        this->sendShares(child);
+      }
+      this->openingState = done;
+      this->opened();
+      break;
+    }
+    default: {
+      log_error("Opening received unexpected message");
+      this->abort();
+    }
+  }
+}
+
+template<FF_TYPENAMES>
+void OpeningFronctocol<FF_TYPES>::sendShares(
+    Identity_T const & recipient) {
+  ::std::unique_ptr<OutgoingMessage_T> omsg(
+      new OutgoingMessage_T(recipient));
+  this->writeShares(*omsg);
+  this->send(::std::move(omsg));
+}
+
+template<FF_TYPENAMES>
+void OpeningFronctocol<FF_TYPES>::gathered() {
+  if (this->parent.empty()) {
+    // Either all-to-all, or the root with the sum of every share.
+    for (Identity_T const & child : this->children) {
+      this->sendShares(child);
+    }
+    this->openingState = done;
+    this->opened();
+  } else {
+    this->sendShares(this->parent.front());
+    this->openingState = awaitingParent;
+  }
+}
+
+} // namespace mpc
+} // namespace ff
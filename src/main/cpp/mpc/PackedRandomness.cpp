@@ -0,0 +1,100 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* 3rd Party Headers */
+#include <openssl/bn.h>
+
+/* Fortissimo Headers */
+#include <mpc/PackedRandomness.h>
+
+/* logging configuration */
+#include <ff/logging.h>
+
+namespace ff {
+namespace mpc {
+
+void BitWriter::write(uint64_t value, size_t width) {
+  log_assert(width <= 64);
+  if (width < 64) {
+    value = value & ((UINT64_C(1) << width) - 1);
+  }
+
+  this->buffer |= value << this->numBits;
+  size_t const total = this->numBits + width;
+  if (total < 64) {
+    this->numBits = total;
+    return;
+  }
+
+  for (size_t i = 0; i < 8; i++) {
+    this->bytes.push_back((uint8_t)(this->buffer >> (8 * i)));
+  }
+  this->buffer =
+      this->numBits == 0 ? 0 : value >> (64 - this->numBits);
+  this->numBits = total - 64;
+}
+
+uint64_t BitReader::read(size_t width) {
+  log_assert(width <= 64);
+  if (width > 56) {
+    uint64_t const low = this->read(32);
+    return low | (this->read(width - 32) << 32);
+  }
+
+  if (this->position / 8 + 8 > this->bytes.size()) {
+    this->success = false;
+    return 0;
+  }
+
+  size_t const offset = this->position % 8;
+  uint8_t const * const start = this->bytes.data() + this->position / 8;
+  uint64_t word = 0;
+  for (size_t i = 0; i < 8; i++) {
+    word |= (uint64_t)start[i] << (8 * i);
+  }
+  this->position += width;
+
+  return (word >> offset) & ((UINT64_C(1) << width) - 1);
+}
+
+size_t packedWidth(LargeNum const & modulus) {
+  LargeNum const max = modulus - LargeNum(1);
+  return (size_t)BN_num_bits(max.peek());
+}
+
+void packNumber(
+    BitWriter & writer, LargeNum const & value, size_t const width) {
+  size_t const len = (width + 7) / 8;
+  ::std::vector<uint8_t> bytes(len, 0x00);
+  if (len > 0) {
+    BN_bn2binpad(value.peek(), bytes.data(), (int)len);
+  }
+
+  // Little endian, so that the last byte holds the odd bits.
+  for (size_t i = 0; i < len; i++) {
+    size_t const bits = i + 1 < len ? 8 : width - 8 * i;
+    writer.write(bytes[len - 1 - i], bits);
+  }
+}
+
+void unpackNumber(
+    BitReader & reader, LargeNum & value, size_t const width) {
+  size_t const len = (width + 7) / 8;
+  ::std::vector<uint8_t> bytes(len, 0x00);
+  for (size_t i = 0; i < len; i++) {
+    size_t const bits = i + 1 < len ? 8 : width - 8 * i;
+    bytes[len - 1 - i] = (uint8_t)reader.read(bits);
+  }
+  BN_bin2bn(bytes.data(), (int)len, value.peek());
+}
+
+} // namespace mpc
+} // namespace ff
@@ -0,0 +1,154 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/*
+ * Bit exact encoding of randomness instances, for the dealer to send
+ * batches of instances without per element headers or padding.
+ */
+
+#ifndef FF_MPC_PACKED_RANDOMNESS_H_
+#define FF_MPC_PACKED_RANDOMNESS_H_
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <ff/Message.h>
+#include <mpc/templates.h>
+
+/* logging configuration */
+#include <ff/logging.h>
+
+namespace ff {
+namespace mpc {
+
+/**
+ * Appends fields of up to 64 bits to a little endian bit string, a
+ * 64 bit word at a time.
+ */
+class BitWriter {
+public:
+  /**
+   * Appends the low width bits of value.
+   */
+  void write(uint64_t value, size_t width);
+
+  /**
+   * Adds the bit string to a message, padded to a whole byte.
+   */
+  template<typename Identity_T>
+  bool flush(OutgoingMessage<Identity_T> & omsg);
+
+private:
+  ::std::vector<uint8_t> bytes;
+  uint64_t buffer = 0;
+  size_t numBits = 0;
+};
+
+/**
+ * Reads fields of up to 64 bits from a bit string written by a
+ * BitWriter.
+ */
+class BitReader {
+public:
+  /**
+   * Removes the bytes of a string of numBits from the message.
+   */
+  template<typename Identity_T>
+  BitReader(IncomingMessage<Identity_T> & imsg, size_t numBits);
+
+  /**
+   * False if the message was shorter than the bit string.
+   */
+  bool ok() const {
+    return this->success;
+  }
+
+  uint64_t read(size_t width);
+
+private:
+  ::std::vector<uint8_t> bytes;
+  size_t position = 0;
+  bool success = true;
+};
+
+/**
+ * The number of bits which hold any value mod the modulus.
+ */
+template<typename Number_T>
+size_t packedWidth(Number_T const & modulus) {
+  size_t width = 0;
+  for (Number_T max = modulus - 1; max != 0; max = max >> 1) {
+    width++;
+  }
+  return width;
+}
+
+size_t packedWidth(LargeNum const & modulus);
+
+/**
+ * Writes or reads a number of width bits. An integral number is one
+ * field, and a LargeNum is as many byte fields as it needs.
+ */
+template<typename Number_T>
+void packNumber(
+    BitWriter & writer, Number_T const & value, size_t const width) {
+  writer.write((uint64_t)value, width);
+}
+
+template<typename Number_T>
+void unpackNumber(
+    BitReader & reader, Number_T & value, size_t const width) {
+  value = (Number_T)reader.read(width);
+}
+
+void packNumber(
+    BitWriter & writer, LargeNum const & value, size_t const width);
+void unpackNumber(
+    BitReader & reader, LargeNum & value, size_t const width);
+
+/**
+ * The RandomnessHouse packs batches of a randomness type bit exactly
+ * when this is specialized for the type and its info. Specializations
+ * set packed to true, and define
+ *
+ *   static size_t bits(Info_T const &);
+ *   static void pack(BitWriter &, Info_T const &, Rand_T const &);
+ *   static void unpack(BitReader &, Info_T const &, Rand_T &);
+ *
+ * Otherwise each instance is written with msg_write, and the functions
+ * here are never called. Specializations belong beside the randomness
+ * types. Those which use packNumber work for LargeNum moduli as well.
+ */
+template<typename Rand_T, typename Info_T, typename Enable_T = void>
+struct PackedRandomness {
+  static constexpr bool packed = false;
+
+  static size_t bits(Info_T const &) {
+    return 0;
+  }
+
+  static void pack(BitWriter &, Info_T const &, Rand_T const &) {
+  }
+
+  static void unpack(BitReader &, Info_T const &, Rand_T &) {
+  }
+};
+
+} // namespace mpc
+} // namespace ff
+
+#include <mpc/PackedRandomness.t.h>
+
+#define LOG_UNCLUDE
+#include <ff/logging.h>
+
+#endif //FF_MPC_PACKED_RANDOMNESS_H_
@@ -0,0 +1,34 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+namespace ff {
+namespace mpc {
+
+template<typename Identity_T>
+bool BitWriter::flush(OutgoingMessage<Identity_T> & omsg) {
+  for (size_t i = 0; 8 * i < this->numBits; i++) {
+    this->bytes.push_back((uint8_t)(this->buffer >> (8 * i)));
+  }
+  this->buffer = 0;
+  this->numBits = 0;
+
+  size_t const len = this->bytes.size();
+  bool const success =
+      len == 0 || omsg.add(this->bytes.data(), len) == len;
+  this->bytes.clear();
+  return success;
+}
+
+template<typename Identity_T>
+BitReader::BitReader(
+    IncomingMessage<Identity_T> & imsg, size_t numBits) {
+  size_t const len = (numBits + 7) / 8;
+  // Pad so that read() may always load a whole word.
+  this->bytes.resize(len + 8, 0x00);
+  this->success =
+      len == 0 || imsg.remove(this->bytes.data(), len) == len;
+}
+
+} // namespace mpc
+} // namespace ff
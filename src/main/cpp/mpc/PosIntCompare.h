@@ -25,9 +25,11 @@
 
 #include <ff/Fronctocol.h>
 #include <mpc/Batch.h>
+#include <mpc/BitwiseCompare.h>
 #include <mpc/Compare.h>
 #include <mpc/Multiply.h>
 #include <mpc/Randomness.h>
+#include <mpc/Reveal.h>
 #include <mpc/templates.h>
 
 /* logging configuration */
@@ -55,6 +57,24 @@ struct PosIntCompareRandomness {
           BooleanBeaverInfo>> beaverDispenser);
 };
 
+/**
+ * Randomness for a BatchedPosIntCompare of batch size N, held in
+ * contiguous arrays rather than in dispensers per comparison:
+ *  - compareRandomness: 3N, the Compares of (x, y), (x, 0) and (y, 0)
+ *    for each comparison in turn,
+ *  - beavers: ceil(N / 2), as each byte of the multiply packs two
+ *    comparisons.
+ */
+template<typename Large_T, typename Small_T>
+struct BatchedPosIntCompareRandomness {
+  std::vector<CompareRandomness<Large_T, Small_T>> compareRandomness;
+  std::vector<BeaverTriple<Boolean_t>> beavers;
+
+  static size_t numBeavers(size_t const batchSize) {
+    return (batchSize + 1) / 2;
+  }
+};
+
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
 class PosIntCompare : public Fronctocol<FF_TYPES> {
 public:
@@ -107,6 +127,68 @@ private:
   PosIntCompareRandomness<Large_T, Small_T> randomness;
 };
 
+/**
+ * Vectorized PosIntCompare, comparing shares_of_x[i] to shares_of_y[i]
+ * for every i in lock-step. Each of the three phases is a single
+ * fronctocol over all of the comparisons:
+ *  - one BatchedReveal of the 3N masked differences of the Compares,
+ *  - one BatchedBitwiseCompare of their bits,
+ *  - one boolean BatchedMultiply, combining the 2-bit results.
+ * Both 2-bit products of two comparisons are packed into each byte
+ * of the multiply, so it uses one boolean Beaver triple per two
+ * comparisons.
+ *
+ * Takes a BatchedPosIntCompareRandomness of the same size, as dealt by
+ * BatchedPosIntCompareRandomnessPatron.
+ *
+ * outputShares[i] is this party's share of the i'th comparison, as the
+ * outputShare of a PosIntCompare.
+ */
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+class BatchedPosIntCompare : public Fronctocol<FF_TYPES> {
+public:
+  std::vector<Boolean_t> outputShares;
+
+  BatchedPosIntCompare(
+      std::vector<Large_T> && shares_of_x, // mod p
+      std::vector<Large_T> && shares_of_y, // mod p
+      CompareInfo<Identity_T, Large_T, Small_T> const * const
+          compareInfo,
+      BatchedPosIntCompareRandomness<Large_T, Small_T> && randomness);
+
+  std::string name() override;
+
+  void init() override;
+
+  void handleReceive(IncomingMessage_T & imsg) override;
+
+  void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
+
+  void handlePromise(ff::Fronctocol<FF_TYPES> & fronctocol) override;
+
+private:
+  enum BatchedCompareState {
+    awaitingBatchedReveal,
+    awaitingBatchedBitwiseCompare,
+    awaitingBatchedXORMultiply
+  };
+  BatchedCompareState state = awaitingBatchedReveal;
+
+  std::vector<Large_T> const shares_of_x;
+  std::vector<Large_T> const shares_of_y;
+
+  CompareInfo<Identity_T, Large_T, Small_T> const * const compareInfo;
+
+  BatchedPosIntCompareRandomness<Large_T, Small_T> randomness;
+
+  MultiplyInfo<Identity_T, BooleanBeaverInfo> const multiplyInfo;
+
+  /* Low bit of each opened value of the Compares. */
+  std::vector<Boolean_t> c_low_bits;
+
+  std::vector<Boolean_t> multiplyOutputs;
+};
+
 } // namespace mpc
 } // namespace ff
 
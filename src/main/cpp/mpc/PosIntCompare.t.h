@@ -146,5 +146,196 @@ void PosIntCompare<FF_TYPES, Large_T, Small_T>::handleComplete(
   }
 }
 
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+std::string BatchedPosIntCompare<FF_TYPES, Large_T, Small_T>::name() {
+  return std::string("Batched PosInt Compare size: ") +
+      std::to_string(this->shares_of_x.size()) +
+      " large mod: " + dec(this->compareInfo->p) +
+      " small mod: " + dec(this->compareInfo->s);
+}
+
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+BatchedPosIntCompare<FF_TYPES, Large_T, Small_T>::BatchedPosIntCompare(
+    std::vector<Large_T> && shares_of_x, // mod p
+    std::vector<Large_T> && shares_of_y, // mod p
+    CompareInfo<Identity_T, Large_T, Small_T> const * const compareInfo,
+    BatchedPosIntCompareRandomness<Large_T, Small_T> && randomness) :
+    shares_of_x(std::move(shares_of_x)),
+    shares_of_y(std::move(shares_of_y)),
+    compareInfo(compareInfo),
+    randomness(std::move(randomness)),
+    multiplyInfo(compareInfo->revealer, BooleanBeaverInfo()) {
+  log_assert(this->shares_of_x.size() == this->shares_of_y.size());
+  log_assert(
+      this->randomness.compareRandomness.size() ==
+      3 * this->shares_of_x.size());
+  log_assert(
+      this->randomness.beavers.size() ==
+      this->randomness.numBeavers(this->shares_of_x.size()));
+}
+
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+void BatchedPosIntCompare<FF_TYPES, Large_T, Small_T>::init() {
+  log_debug("Calling init on BatchedPosIntCompare");
+  if (this->shares_of_x.empty()) {
+    this->complete();
+    return;
+  }
+
+  Large_T const & p = this->compareInfo->p;
+  std::vector<Large_T> masked;
+  masked.reserve(this->randomness.compareRandomness.size());
+  for (size_t i = 0; i < this->shares_of_x.size(); i++) {
+    Large_T const diffs[3] = {
+        (p + this->shares_of_x[i] - this->shares_of_y[i]) % p,
+        this->shares_of_x[i] % p,
+        this->shares_of_y[i] % p};
+    for (size_t j = 0; j < 3; j++) {
+      Large_T const & r =
+          this->randomness.compareRandomness[3 * i + j].singleDbs.r;
+      masked.emplace_back((diffs[j] * 2 + r) % p);
+    }
+  }
+
+  this->invoke(
+      std::unique_ptr<Fronctocol<FF_TYPES>>(
+          new BatchedReveal<FF_TYPES, Large_T>(
+              std::move(masked), p, this->compareInfo->revealer)),
+      this->getPeers());
+}
+
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+void BatchedPosIntCompare<FF_TYPES, Large_T, Small_T>::handlePromise(
+    ff::Fronctocol<FF_TYPES> &) {
+  log_error("Unexpected handlePromise in BatchedPosIntCompare");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+void BatchedPosIntCompare<FF_TYPES, Large_T, Small_T>::handleReceive(
+    IncomingMessage_T &) {
+  log_error("Unexpected handleReceive in BatchedPosIntCompare");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+void BatchedPosIntCompare<FF_TYPES, Large_T, Small_T>::handleComplete(
+    ff::Fronctocol<FF_TYPES> & f) {
+  switch (this->state) {
+    case awaitingBatchedReveal: {
+      std::vector<Large_T> & opened =
+          static_cast<BatchedReveal<FF_TYPES, Large_T> &>(f)
+              .openedValues;
+      size_t const ell = this->compareInfo->ell;
+
+      std::vector<std::vector<Small_T>> shares_of_r;
+      std::vector<std::vector<Small_T>> c_bits;
+      std::vector<BitwiseCompareRandomness<Small_T>> randomness;
+      shares_of_r.reserve(opened.size());
+      c_bits.reserve(opened.size());
+      randomness.reserve(opened.size());
+      this->c_low_bits.resize(opened.size());
+      for (size_t j = 0; j < opened.size(); j++) {
+        CompareRandomness<Large_T, Small_T> & r =
+            this->randomness.compareRandomness[j];
+
+        Large_T c = opened[j];
+        this->c_low_bits[j] = static_cast<Boolean_t>(c % 2);
+        c_bits.emplace_back(ell, 0);
+        for (size_t i = 0; i < ell; i++) {
+          c_bits.back()[ell - 1 - i] = static_cast<Small_T>(c % 2);
+          c /= 2;
+        }
+        shares_of_r.emplace_back(r.singleDbs.r_is);
+
+        BeaverTriple<Small_T> beaver1 = r.multiplyDispenser->get();
+        BeaverTriple<Small_T> beaver2 = r.multiplyDispenser->get();
+        randomness.emplace_back(
+            PrefixOrRandomness<Small_T>(
+                std::move(r.exponentSeries),
+                std::move(r.multiplyDispenser)),
+            beaver1,
+            r.Tct1,
+            beaver2,
+            r.Tct2);
+      }
+
+      this->state = awaitingBatchedBitwiseCompare;
+      this->invoke(
+          std::unique_ptr<Fronctocol<FF_TYPES>>(
+              new BatchedBitwiseCompare<FF_TYPES, Small_T>(
+                  std::move(shares_of_r),
+                  std::move(c_bits),
+                  &this->compareInfo->prefInfo,
+                  std::move(randomness))),
+          this->getPeers());
+    } break;
+    case awaitingBatchedBitwiseCompare: {
+      std::vector<Boolean_t> const & bitwise =
+          static_cast<BatchedBitwiseCompare<FF_TYPES, Small_T> &>(f)
+              .outputShares;
+      bool const is_revealer =
+          this->getSelf() == *this->compareInfo->revealer;
+
+      std::vector<Boolean_t> compares(bitwise.size());
+      for (size_t j = 0; j < bitwise.size(); j++) {
+        compares[j] = bitwise[j] ^
+            this->randomness.compareRandomness[j].singleDbs.r_0;
+        if (is_revealer) {
+          compares[j] = compares[j] ^ this->c_low_bits[j];
+        }
+      }
+
+      // As PosIntCompare, (xy & ((x0^y0^1)%2)*3) ^ (y0 & (x0^y0)),
+      // packing both products of comparisons 2k and 2k+1 in byte k.
+      std::vector<Boolean_t> lhs(this->randomness.beavers.size(), 0x00);
+      std::vector<Boolean_t> rhs(this->randomness.beavers.size(), 0x00);
+      for (size_t i = 0; i < this->shares_of_x.size(); i++) {
+        Boolean_t const x_compare_y = compares[3 * i] & 3;
+        Boolean_t const x_compare_zero = compares[3 * i + 1] & 3;
+        Boolean_t const y_compare_zero = compares[3 * i + 2] & 3;
+
+        Boolean_t first_mult_second_input =
+            x_compare_zero ^ y_compare_zero;
+        if (is_revealer) {
+          first_mult_second_input = first_mult_second_input ^ 1;
+        }
+        first_mult_second_input =
+            static_cast<Boolean_t>(first_mult_second_input % 2 * 3);
+
+        size_t const shift = 4 * (i % 2);
+        lhs[i / 2] |= static_cast<Boolean_t>(
+            x_compare_y << shift | y_compare_zero << (shift + 2));
+        rhs[i / 2] |= static_cast<Boolean_t>(
+            first_mult_second_input << shift |
+            (x_compare_zero ^ y_compare_zero) << (shift + 2));
+      }
+
+      this->state = awaitingBatchedXORMultiply;
+      std::unique_ptr<Fronctocol<FF_TYPES>> multiply(
+          new BatchedMultiply<FF_TYPES, Boolean_t, BooleanBeaverInfo>(
+              std::move(lhs),
+              std::move(rhs),
+              &this->multiplyOutputs,
+              std::move(this->randomness.beavers),
+              &this->multiplyInfo));
+      this->invoke(std::move(multiply), this->getPeers());
+    } break;
+    case awaitingBatchedXORMultiply: {
+      this->outputShares.resize(this->shares_of_x.size());
+      for (size_t i = 0; i < this->outputShares.size(); i++) {
+        Boolean_t const z =
+            this->multiplyOutputs[i / 2] >> (4 * (i % 2));
+        this->outputShares[i] =
+            static_cast<Boolean_t>((z & 3) ^ ((z >> 2) & 3));
+      }
+      this->complete();
+    } break;
+    default:
+      log_error("BatchedPosIntCompare in unexpected state");
+      this->abort();
+  }
+}
+
 } // namespace mpc
 } // namespace ff
@@ -106,6 +106,59 @@ private:
       fullMultiplyDispenser;
 };
 
+/**
+ * Deals the randomness for BatchedPosIntCompares of batchSize
+ * comparisons each, from the same PosIntCompareRandomnessHouse as the
+ * patron above. Each BatchedPosIntCompareRandomness asks for only as
+ * many boolean triples as its packed multiply uses.
+ */
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+class BatchedPosIntCompareRandomnessPatron
+    : public Fronctocol<FF_TYPES> {
+public:
+  std::string name() override;
+
+  void init() override;
+  void handleReceive(IncomingMessage_T & imsg) override;
+  void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
+  void handlePromise(ff::Fronctocol<FF_TYPES> & f) override;
+
+  std::unique_ptr<RandomnessDispenser<
+      BatchedPosIntCompareRandomness<Large_T, Small_T>,
+      DoNotGenerateInfo>>
+      batchedPosIntCompareDispenser;
+
+  BatchedPosIntCompareRandomnessPatron(
+      CompareInfo<Identity_T, Large_T, Small_T> const * const
+          compareInfo,
+      Identity_T const * const dealerIdentity,
+      const size_t batchSize,
+      const size_t dispenserSize);
+
+private:
+  void generateOutputDispenser();
+
+  CompareInfo<Identity_T, Large_T, Small_T> const * const compareInfo;
+  const Identity_T * dealerIdentity;
+  size_t batchSize;
+  size_t dispenserSize;
+
+  /*
+   * Both randomness types are requested from the dealer at once: the
+   * Compare patron is invoked, and the boolean triples are promised.
+   */
+  PromiseJoin<FF_TYPES> join;
+  bool awaitingCompare = true;
+
+  std::unique_ptr<RandomnessDispenser<
+      CompareRandomness<Large_T, Small_T>,
+      DoNotGenerateInfo>>
+      fullCompareDispenser;
+  std::unique_ptr<
+      RandomnessDispenser<BeaverTriple<Boolean_t>, BooleanBeaverInfo>>
+      fullMultiplyDispenser;
+};
+
 } // namespace mpc
 } // namespace ff
 
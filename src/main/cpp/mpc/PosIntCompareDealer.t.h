@@ -174,5 +174,139 @@ void PosIntCompareRandomnessPatron<FF_TYPES, Large_T, Small_T>::
   this->complete();
 }
 
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+std::string
+BatchedPosIntCompareRandomnessPatron<FF_TYPES, Large_T, Small_T>::
+    name() {
+  return std::string("Batched PosInt Compare Randomness Patron ") +
+      "size: " + std::to_string(this->batchSize) +
+      " large mod: " + dec(this->compareInfo->p) +
+      " small mod: " + dec(this->compareInfo->s);
+}
+
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+BatchedPosIntCompareRandomnessPatron<FF_TYPES, Large_T, Small_T>::
+    BatchedPosIntCompareRandomnessPatron(
+        CompareInfo<Identity_T, Large_T, Small_T> const * const
+            compareInfo,
+        const Identity_T * dealerIdentity,
+        const size_t batchSize,
+        const size_t dispenserSize) :
+    batchedPosIntCompareDispenser(
+        new RandomnessDispenser<
+            BatchedPosIntCompareRandomness<Large_T, Small_T>,
+            DoNotGenerateInfo>(DoNotGenerateInfo())),
+    compareInfo(compareInfo),
+    dealerIdentity(dealerIdentity),
+    batchSize(batchSize),
+    dispenserSize(dispenserSize) {
+}
+
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+void BatchedPosIntCompareRandomnessPatron<FF_TYPES, Large_T, Small_T>::
+    init() {
+  log_debug("Calling init on BatchedPosIntComparePatron");
+
+  /* The house invokes its houses in this same order. */
+  std::unique_ptr<Fronctocol<FF_TYPES>> comparePatron(
+      new CompareRandomnessPatron<FF_TYPES, Large_T, Small_T>(
+          this->compareInfo,
+          this->dealerIdentity,
+          3 * this->batchSize * this->dispenserSize));
+  this->invoke(std::move(comparePatron), this->getPeers());
+
+  this->join.add(
+      *this,
+      std::unique_ptr<PromiseFronctocol<
+          FF_TYPES,
+          RandomnessDispenser<
+              BeaverTriple<Boolean_t>,
+              BooleanBeaverInfo>>>(new RandomnessPatron<
+                                   FF_TYPES,
+                                   BeaverTriple<Boolean_t>,
+                                   BooleanBeaverInfo>(
+          *this->dealerIdentity,
+          BatchedPosIntCompareRandomness<Large_T, Small_T>::numBeavers(
+              this->batchSize) *
+              this->dispenserSize,
+          BooleanBeaverInfo())),
+      this->getPeers(),
+      &this->fullMultiplyDispenser);
+}
+
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+void BatchedPosIntCompareRandomnessPatron<FF_TYPES, Large_T, Small_T>::
+    handleReceive(IncomingMessage_T &) {
+  log_error("BatchedPosIntComparePatron Fronctocol received "
+            "unexpected handle receive");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+void BatchedPosIntCompareRandomnessPatron<FF_TYPES, Large_T, Small_T>::
+    handleComplete(ff::Fronctocol<FF_TYPES> & f) {
+  log_debug("BatchedPosIntComparePatron received handle complete");
+  if (!this->awaitingCompare) {
+    log_error("BatchedPosIntComparePatron received unexpected "
+              "handle complete");
+    this->abort();
+    return;
+  }
+
+  this->fullCompareDispenser = std::move(
+      static_cast<
+          CompareRandomnessPatron<FF_TYPES, Large_T, Small_T> &>(f)
+          .compareDispenser);
+  this->awaitingCompare = false;
+
+  if (this->join.done()) {
+    this->generateOutputDispenser();
+  }
+}
+
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+void BatchedPosIntCompareRandomnessPatron<FF_TYPES, Large_T, Small_T>::
+    handlePromise(ff::Fronctocol<FF_TYPES> & f) {
+  log_debug("BatchedPosIntComparePatron received handle promise");
+  if (!this->join.collect(f)) {
+    log_error("BatchedPosIntComparePatron received an unexpected "
+              "promise");
+    this->abort();
+    return;
+  }
+
+  if (this->join.done() && !this->awaitingCompare) {
+    this->generateOutputDispenser();
+  }
+}
+
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+void BatchedPosIntCompareRandomnessPatron<FF_TYPES, Large_T, Small_T>::
+    generateOutputDispenser() {
+  size_t const numBeavers =
+      BatchedPosIntCompareRandomness<Large_T, Small_T>::numBeavers(
+          this->batchSize);
+
+  for (size_t i = 0; i < this->dispenserSize; i++) {
+    BatchedPosIntCompareRandomness<Large_T, Small_T> randomness;
+
+    randomness.compareRandomness.reserve(3 * this->batchSize);
+    for (size_t j = 0; j < 3 * this->batchSize; j++) {
+      randomness.compareRandomness.emplace_back(
+          this->fullCompareDispenser->get());
+    }
+
+    randomness.beavers.reserve(numBeavers);
+    for (size_t j = 0; j < numBeavers; j++) {
+      randomness.beavers.emplace_back(
+          this->fullMultiplyDispenser->get());
+    }
+
+    this->batchedPosIntCompareDispenser->insert(std::move(randomness));
+  }
+
+  this->complete();
+}
+
 } // namespace mpc
 } // namespace ff
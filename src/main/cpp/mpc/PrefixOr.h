@@ -10,7 +10,10 @@
 /* C++ Headers */
 #include <cmath>
 #include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -32,14 +35,59 @@
 namespace ff {
 namespace mpc {
 
+/**
+ * The set of Lagrange polynomials used by a PrefixOr over ell bits with
+ * blocks of size lambda, in the order that PrefixOr consumes them.
+ */
+template<typename Number_T>
+using LagrangePolynomialSet = std::vector<std::vector<Number_T>>;
+
+template<typename Number_T>
+LagrangePolynomialSet<Number_T> generateLagrangePolynomialSet(
+    size_t bitsPerPrime, size_t sqrtEll, Number_T const & smallModulus);
+
+/**
+ * Returns the LagrangePolynomialSet for the given parameters from a
+ * process-wide cache, generating it on first use. The set is immutable
+ * and shared by all callers. Safe to call from multiple threads.
+ */
+template<typename Number_T>
+std::shared_ptr<LagrangePolynomialSet<Number_T> const>
+cachedLagrangePolynomialSet(
+    size_t bitsPerPrime, size_t sqrtEll, Number_T const & smallModulus);
+
+enum class PrefixOrStrategy {
+  /*
+   * Blocks of lambda ~ sqrt(ell) bits, each or-ed with an
+   * UnboundedFaninOr: a constant number of rounds, but O(ell * lambda)
+   * exponent series and Lagrange polynomials of degree up to ell.
+   */
+  sqrtBlocks,
+
+  /*
+   * A Sklansky parallel prefix of two-input ors, a + b - a * b:
+   * ceil(log2(ell)) rounds of multiplication, using only
+   * numLogDepthPrefixOrMultiplies(ell) Beaver triples.
+   */
+  logDepth
+};
+
+/**
+ * The number of multiplications in a logDepth PrefixOr of ell bits.
+ */
+inline size_t numLogDepthPrefixOrMultiplies(size_t const ell);
+
 template<typename Identity_T, typename Number_T>
 struct PrefixOrInfo {
 
   const Number_T s;
   const size_t lambda; // such that lambda^2 > inputVals.size()
   const size_t ell;
-  const std::vector<std::vector<Number_T>> lagrangePolynomialSet;
+  const std::shared_ptr<LagrangePolynomialSet<Number_T> const>
+      lagrangePolynomialStorage;
+  const LagrangePolynomialSet<Number_T> & lagrangePolynomialSet;
   const Identity_T * rev;
+  const PrefixOrStrategy strategy;
 
   PrefixOrInfo(
       const Number_T s,
@@ -49,7 +97,23 @@ struct PrefixOrInfo {
       const Identity_T * rev);
 
   PrefixOrInfo(
-      const Number_T s, const size_t ell, const Identity_T * revealer);
+      const Number_T s,
+      const size_t lambda, // such that lambda^2 > inputVals.size()
+      const size_t ell,
+      std::shared_ptr<LagrangePolynomialSet<Number_T> const> const &
+          lagrangePolynomialSet,
+      const Identity_T * rev,
+      const PrefixOrStrategy strategy = PrefixOrStrategy::sqrtBlocks);
+
+  /**
+   * A logDepth PrefixOr skips generating the Lagrange polynomials
+   * altogether.
+   */
+  PrefixOrInfo(
+      const Number_T s,
+      const size_t ell,
+      const Identity_T * revealer,
+      const PrefixOrStrategy strategy = PrefixOrStrategy::sqrtBlocks);
 };
 
 template<typename Number_T>
@@ -94,13 +158,15 @@ public:
 
 private:
   void initAfterRandomness();
+  void invokeLogDepthLevel();
 
   // This begins as "multiply" and becomes "reveal" once multiplication is done
   enum PrefixState {
     awaitingFirstBatchedUnboundedFaninOr,
     awaitingFirstBatchedMultiply,
     awaitingSecondBatchedUnboundedFaninOr,
-    awaitingSecondBatchedMultiply
+    awaitingSecondBatchedMultiply,
+    awaitingLogDepthMultiply
   };
   PrefixState state = awaitingFirstBatchedUnboundedFaninOr;
 
@@ -117,6 +183,10 @@ private:
   std::vector<Number_T> fronctocolResults2;
   std::vector<Number_T> y_values;
   std::vector<Number_T> w_values;
+
+  // Size of the blocks being joined by the current logDepth level.
+  size_t logDepthSpan = 1;
+  std::vector<Number_T> logDepthProducts;
 };
 
 } // namespace mpc
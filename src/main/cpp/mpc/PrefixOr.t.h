@@ -6,12 +6,11 @@ namespace ff {
 namespace mpc {
 
 template<typename Number_T>
-std::vector<std::vector<Number_T>> generateLagrangePolynomialSet(
+LagrangePolynomialSet<Number_T> generateLagrangePolynomialSet(
     size_t bitsPerPrime,
     size_t sqrtEll,
     Number_T const & smallModulus) {
-  std::vector<std::vector<Number_T>> lagrangePolynomialSet =
-      std::vector<std::vector<Number_T>>();
+  LagrangePolynomialSet<Number_T> lagrangePolynomialSet;
   lagrangePolynomialSet.reserve(bitsPerPrime / sqrtEll + sqrtEll + 1);
 
   size_t block_size = sqrtEll;
@@ -32,6 +31,47 @@ std::vector<std::vector<Number_T>> generateLagrangePolynomialSet(
   return lagrangePolynomialSet;
 }
 
+inline size_t numLogDepthPrefixOrMultiplies(size_t const ell) {
+  size_t n = 0;
+  for (size_t span = 1; span < ell; span *= 2) {
+    // Each block of 2 * span bits joins its upper half to its lower.
+    n += (ell / (2 * span)) * span;
+    if (ell % (2 * span) > span) {
+      n += ell % (2 * span) - span;
+    }
+  }
+  return n;
+}
+
+template<typename Number_T>
+std::shared_ptr<LagrangePolynomialSet<Number_T> const>
+cachedLagrangePolynomialSet(
+    size_t bitsPerPrime,
+    size_t sqrtEll,
+    Number_T const & smallModulus) {
+  using Key_T = std::tuple<Number_T, size_t, size_t>;
+  static std::mutex cacheMutex;
+  static std::map<
+      Key_T,
+      std::shared_ptr<LagrangePolynomialSet<Number_T> const>>
+      cache;
+
+  std::lock_guard<std::mutex> lock(cacheMutex);
+
+  Key_T key(smallModulus, bitsPerPrime, sqrtEll);
+  auto found = cache.find(key);
+  if (found != cache.end()) {
+    return found->second;
+  }
+
+  std::shared_ptr<LagrangePolynomialSet<Number_T> const> set =
+      std::make_shared<LagrangePolynomialSet<Number_T> const>(
+          generateLagrangePolynomialSet(
+              bitsPerPrime, sqrtEll, smallModulus));
+  cache.emplace(std::move(key), set);
+  return set;
+}
+
 template<typename Identity_T, typename Number_T>
 PrefixOrInfo<Identity_T, Number_T>::PrefixOrInfo(
     const Number_T s,
@@ -39,23 +79,51 @@ PrefixOrInfo<Identity_T, Number_T>::PrefixOrInfo(
     const size_t ell,
     const std::vector<std::vector<Number_T>> & lagrangePolynomialSet,
     const Identity_T * rev) :
+    PrefixOrInfo(
+        s,
+        lambda,
+        ell,
+        std::make_shared<LagrangePolynomialSet<Number_T> const>(
+            lagrangePolynomialSet),
+        rev) {
+}
+
+template<typename Identity_T, typename Number_T>
+PrefixOrInfo<Identity_T, Number_T>::PrefixOrInfo(
+    const Number_T s,
+    const size_t lambda, // such that lambda^2 > inputVals.size()
+    const size_t ell,
+    std::shared_ptr<LagrangePolynomialSet<Number_T> const> const &
+        lagrangePolynomialSet,
+    const Identity_T * rev,
+    const PrefixOrStrategy strategy) :
     s(s),
     lambda(lambda),
     ell(ell),
-    lagrangePolynomialSet(lagrangePolynomialSet),
-    rev(rev) {
+    lagrangePolynomialStorage(lagrangePolynomialSet),
+    lagrangePolynomialSet(*this->lagrangePolynomialStorage),
+    rev(rev),
+    strategy(strategy) {
 }
 
 template<typename Identity_T, typename Number_T>
 PrefixOrInfo<Identity_T, Number_T>::PrefixOrInfo(
-    const Number_T s, const size_t ell, const Identity_T * revealer) :
+    const Number_T s,
+    const size_t ell,
+    const Identity_T * revealer,
+    const PrefixOrStrategy strategy) :
     s(s),
     lambda(static_cast<size_t>(
         std::ceil(std::sqrt(static_cast<double>(ell + 1))))),
     ell(ell),
-    lagrangePolynomialSet(generateLagrangePolynomialSet(
-        this->ell, this->lambda, this->s)),
-    rev(revealer) {
+    lagrangePolynomialStorage(
+        strategy == PrefixOrStrategy::logDepth ?
+            std::make_shared<LagrangePolynomialSet<Number_T> const>() :
+            cachedLagrangePolynomialSet(
+                this->ell, this->lambda, this->s)),
+    lagrangePolynomialSet(*this->lagrangePolynomialStorage),
+    rev(revealer),
+    strategy(strategy) {
 }
 
 template<FF_TYPENAMES, typename Number_T>
@@ -84,6 +152,13 @@ PrefixOr<FF_TYPES, Number_T>::PrefixOr(
 template<FF_TYPENAMES, typename Number_T>
 void PrefixOr<FF_TYPES, Number_T>::init() {
   log_debug("Calling init on prefixor");
+  if (this->info->strategy == PrefixOrStrategy::logDepth) {
+    log_assert(this->inputVals.size() <= this->info->ell);
+    this->orResults = this->inputVals;
+    this->invokeLogDepthLevel();
+    return;
+  }
+
   this->fronctocolResults = std::vector<Number_T>(
       ((this->inputVals.size() - 1) / this->info->lambda) + 1);
 
@@ -104,23 +179,20 @@ void PrefixOr<FF_TYPES, Number_T>::initAfterRandomness() {
       this->inputVals.size(),
       this->info->lambda);
 
-  ::std::unique_ptr<Batch<FF_TYPES>> batch(new Batch<FF_TYPES>());
+  ::std::unique_ptr<BatchedUnboundedFaninOr<FF_TYPES, Number_T>> fanin(
+      new BatchedUnboundedFaninOr<FF_TYPES, Number_T>(
+          &this->fronctocolResults, &this->unboundedFaninOrInfo));
   Number_T current_A = 0;
 
-  size_t place = 0;
   for (size_t i = 0; i < this->inputVals.size(); i++) {
     current_A = modAdd(current_A, this->inputVals[i], this->info->s);
     if ((i + 1) % this->info->lambda == 0) {
-      batch->children.emplace_back(
-          new UnboundedFaninOr<FF_TYPES, Number_T>(
-              current_A,
-              i + 1,
-              &this->fronctocolResults[place++],
-              std::move(
-                  this->randomness.exponentSeries[exponentSeriesIndex]),
-              this->randomness.multiplyDispenser->get(),
-              this->info->lagrangePolynomialSet[exponentSeriesIndex],
-              &this->unboundedFaninOrInfo));
+      fanin->addGroup(
+          current_A,
+          std::move(
+              this->randomness.exponentSeries[exponentSeriesIndex]),
+          this->randomness.multiplyDispenser->get(),
+          this->info->lagrangePolynomialSet[exponentSeriesIndex]);
 
       exponentSeriesIndex++;
       log_debug("exponentSeriesIndex: %zu", this->exponentSeriesIndex);
@@ -128,27 +200,56 @@ void PrefixOr<FF_TYPES, Number_T>::initAfterRandomness() {
   }
 
   if ((this->inputVals.size()) % this->info->lambda != 0) {
-    batch->children.emplace_back(
-        new UnboundedFaninOr<FF_TYPES, Number_T>(
-            current_A,
-            this->inputVals.size(),
-            &this->fronctocolResults[place++],
-            std::move(
-                this->randomness.exponentSeries[exponentSeriesIndex]),
-            this->randomness.multiplyDispenser->get(),
-            this->info->lagrangePolynomialSet[exponentSeriesIndex],
-            &this->unboundedFaninOrInfo));
+    fanin->addGroup(
+        current_A,
+        std::move(this->randomness.exponentSeries[exponentSeriesIndex]),
+        this->randomness.multiplyDispenser->get(),
+        this->info->lagrangePolynomialSet[exponentSeriesIndex]);
     exponentSeriesIndex++;
   }
 
-  log_assert(this->fronctocolResults.size() == batch->children.size());
-  log_assert(this->fronctocolResults.size() == place);
+  log_assert(this->fronctocolResults.size() == fanin->size());
   log_debug("exponentSeriesIndex: %zu", this->exponentSeriesIndex);
   log_debug(
       "input length: %zu Output length: %zu",
-      batch->children.size(),
+      fanin->size(),
       this->fronctocolResults.size());
-  this->invoke(std::move(batch), this->getPeers());
+  this->invoke(std::move(fanin), this->getPeers());
+}
+
+/**
+ * Joins each block of 2 * logDepthSpan bits by or-ing the last bit of
+ * its lower half into every bit of its upper half.
+ */
+template<FF_TYPENAMES, typename Number_T>
+void PrefixOr<FF_TYPES, Number_T>::invokeLogDepthLevel() {
+  size_t const span = this->logDepthSpan;
+  if (span >= this->orResults.size()) {
+    this->complete();
+    return;
+  }
+
+  std::vector<Number_T> xs;
+  std::vector<Number_T> ys;
+  std::vector<BeaverTriple<Number_T>> beavers;
+  for (size_t i = 0; i < this->orResults.size(); i++) {
+    if ((i & span) != 0) {
+      xs.push_back(this->orResults[i]);
+      ys.push_back(this->orResults[(i & ~(2 * span - 1)) + span - 1]);
+      beavers.emplace_back(this->randomness.multiplyDispenser->get());
+    }
+  }
+
+  this->invoke(
+      std::unique_ptr<Fronctocol<FF_TYPES>>(
+          new BatchedMultiply<FF_TYPES, Number_T, BeaverInfo<Number_T>>(
+              std::move(xs),
+              std::move(ys),
+              &this->logDepthProducts,
+              std::move(beavers),
+              &this->multiplyInfo)),
+      this->getPeers());
+  this->state = awaitingLogDepthMultiply;
 }
 
 template<FF_TYPENAMES, typename Number_T>
@@ -226,29 +327,27 @@ void PrefixOr<FF_TYPES, Number_T>::handleComplete(
           this->w_values.size(),
           this->randomness.exponentSeries.size());
 
-      ::std::unique_ptr<Batch<FF_TYPES>> batch(new Batch<FF_TYPES>());
+      ::std::unique_ptr<BatchedUnboundedFaninOr<FF_TYPES, Number_T>>
+          fanin(new BatchedUnboundedFaninOr<FF_TYPES, Number_T>(
+              &this->fronctocolResults, &this->unboundedFaninOrInfo));
       Number_T current_A = 0;
 
       for (size_t i = 0; i < this->w_values.size(); i++) {
         current_A = modAdd(current_A, this->w_values[i], this->info->s);
 
-        batch->children.emplace_back(
-            new UnboundedFaninOr<FF_TYPES, Number_T>(
-                current_A,
-                i + 1,
-                &this->fronctocolResults[i],
-                std::move(this->randomness
-                              .exponentSeries[exponentSeriesIndex]),
-                this->randomness.multiplyDispenser->get(),
-                this->info->lagrangePolynomialSet[exponentSeriesIndex],
-                &this->unboundedFaninOrInfo));
+        fanin->addGroup(
+            current_A,
+            std::move(
+                this->randomness.exponentSeries[exponentSeriesIndex]),
+            this->randomness.multiplyDispenser->get(),
+            this->info->lagrangePolynomialSet[exponentSeriesIndex]);
         this->exponentSeriesIndex++;
         log_debug(
             "exponentSeriesIndex is %zu", this->exponentSeriesIndex);
       }
 
       log_debug("About to invoke UFIOs");
-      this->invoke(std::move(batch), this->getPeers());
+      this->invoke(std::move(fanin), this->getPeers());
       this->state = awaitingSecondBatchedUnboundedFaninOr;
 
     } break;
@@ -304,6 +403,23 @@ void PrefixOr<FF_TYPES, Number_T>::handleComplete(
       }
       this->complete();
     } break;
+    case awaitingLogDepthMultiply: {
+      log_debug("Case awaitingLogDepthMultiply");
+      size_t const span = this->logDepthSpan;
+      size_t k = 0;
+      for (size_t i = 0; i < this->orResults.size(); i++) {
+        if ((i & span) != 0) {
+          Number_T const & lower =
+              this->orResults[(i & ~(2 * span - 1)) + span - 1];
+          this->orResults[i] = modSub(
+              modAdd(this->orResults[i], lower, this->info->s),
+              this->logDepthProducts[k++],
+              this->info->s);
+        }
+      }
+      this->logDepthSpan *= 2;
+      this->invokeLogDepthLevel();
+    } break;
     default:
       log_error("PrefixOr state machine in unexpected state");
   }
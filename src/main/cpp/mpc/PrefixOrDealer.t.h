@@ -22,6 +22,16 @@ void PrefixOrRandomnessHouse<FF_TYPES, Number_T>::init() {
   log_debug("PrefixOrRandomnessHouse init");
 
   std::vector<size_t> UnboundedFaninOrRandomnessNeeds;
+  if (this->info->strategy == PrefixOrStrategy::logDepth) {
+    this->numDealersRemaining = 1;
+    std::unique_ptr<ff::Fronctocol<FF_TYPES>> rd(
+        new RandomnessHouse<
+            FF_TYPES,
+            BeaverTriple<Number_T>,
+            BeaverInfo<Number_T>>());
+    this->invoke(std::move(rd), this->getPeers());
+    return;
+  }
 
   size_t block_size = this->info->lambda;
   size_t numElements = this->info->ell;
@@ -110,6 +120,28 @@ template<FF_TYPENAMES, typename Number_T>
 void PrefixOrRandomnessPatron<FF_TYPES, Number_T>::init() {
   log_debug("PrefixOrPatron init");
 
+  if (this->info->strategy == PrefixOrStrategy::logDepth) {
+    this->BeaverTriplesNeeded =
+        numLogDepthPrefixOrMultiplies(this->info->ell);
+    this->numPromisesRemaining = 0;
+    std::unique_ptr<PromiseFronctocol<
+        FF_TYPES,
+        RandomnessDispenser<
+            BeaverTriple<Number_T>,
+            BeaverInfo<Number_T>>>>
+        beaver_drg(new RandomnessPatron<
+                   FF_TYPES,
+                   BeaverTriple<Number_T>,
+                   BeaverInfo<Number_T>>(
+            *dealerIdentity,
+            this->BeaverTriplesNeeded * this->dispenserSize,
+            BeaverInfo<Number_T>(this->info->s)));
+    fullMultiplyPromiseDispenser =
+        this->promise(std::move(beaver_drg), this->getPeers());
+    this->await(*fullMultiplyPromiseDispenser);
+    return;
+  }
+
   size_t block_size = this->info->lambda;
   size_t numElements = this->info->ell;
   while (block_size < numElements) {
@@ -87,16 +87,11 @@ private:
     awaitingBatchedMultiply,
     awaitingBatchedCompare
   };
-  enum QuickSortPromiseState {
-    awaitingExponentSeries,
-    awaitingMultiply,
-    awaitingXORMultiply,
-    awaitingTct,
-    awaitingDbs
-  };
   size_t numMultiplies;
   QuickSortState state = awaitingBatchedCompare;
-  QuickSortPromiseState promiseState = awaitingExponentSeries;
+
+  /* Every randomness type is requested from the dealer at once. */
+  PromiseJoin<FF_TYPES> join;
 
   // for each element of the list
   std::vector<size_t> pivots;
@@ -135,37 +130,6 @@ private:
       DoNotGenerateInfo>>
       compareDispenser;
 
-  std::unique_ptr<Promise<
-      FF_TYPES,
-      RandomnessDispenser<
-          ExponentSeries<Small_T>,
-          ExponentSeriesInfo<Small_T>>>>
-      exponentPromiseDispenser;
-
-  std::unique_ptr<Promise<
-      FF_TYPES,
-      RandomnessDispenser<BeaverTriple<Small_T>, BeaverInfo<Small_T>>>>
-      fullMultiplyPromiseDispenser;
-
-  std::unique_ptr<Promise<
-      FF_TYPES,
-      RandomnessDispenser<BeaverTriple<Boolean_t>, BooleanBeaverInfo>>>
-      XORMultiplyPromiseDispenser;
-
-  std::unique_ptr<Promise<
-      FF_TYPES,
-      RandomnessDispenser<
-          TypeCastTriple<Small_T>,
-          TypeCastInfo<Small_T>>>>
-      fullTctPromiseDispenser;
-
-  std::unique_ptr<Promise<
-      FF_TYPES,
-      RandomnessDispenser<
-          DecomposedBitSet<Large_T, Small_T>,
-          DecomposedBitSetInfo<Large_T, Small_T>>>>
-      fullDbsPromiseDispenser;
-
   std::vector<std::unique_ptr<RandomnessDispenser<
       ExponentSeries<Small_T>,
       ExponentSeriesInfo<Small_T>>>>
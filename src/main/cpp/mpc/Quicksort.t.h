@@ -44,19 +44,8 @@ void QuickSortFronctocol<FF_TYPES, Large_T, Small_T>::init() {
     this->pivots[i] = (inputList->elements.size() - 1) / 2;
   }
 
-  size_t block_size = this->compareInfo.lambda;
-  while (block_size < this->compareInfo.ell) {
-    this->UnboundedFaninOrRandomnessNeeds.emplace_back(block_size);
-    block_size += this->compareInfo.lambda;
-  }
-  this->UnboundedFaninOrRandomnessNeeds.emplace_back(
-      this->compareInfo.ell);
-
-  block_size = 1;
-  while ((block_size - 1) < this->compareInfo.lambda) {
-    this->UnboundedFaninOrRandomnessNeeds.emplace_back(block_size);
-    block_size++;
-  }
+  this->UnboundedFaninOrRandomnessNeeds =
+      this->compareInfo.exponentSeriesNeeds();
 
   this->maxNumberCompares = this->inputList->elements.size() *
       this->inputList->numKeyCols *
@@ -64,8 +53,7 @@ void QuickSortFronctocol<FF_TYPES, Large_T, Small_T>::init() {
                               std::log2(static_cast<double>(
                                   this->inputList->elements.size())) +
                           1);
-  this->BeaverTriplesNeeded = 2 * this->compareInfo.ell +
-      UnboundedFaninOrRandomnessNeeds.size() + 2;
+  this->BeaverTriplesNeeded = this->compareInfo.beaverTriplesNeeded();
 
   this->XORBeaverTriplesNeeded =
       (this->maxNumberCompares * (this->inputList->numKeyCols - 1)) /
@@ -76,23 +64,101 @@ void QuickSortFronctocol<FF_TYPES, Large_T, Small_T>::init() {
   this->dbsInfo = DecomposedBitSetInfo<Large_T, Small_T>(
       this->compareInfo.p, this->compareInfo.s, this->compareInfo.ell);
 
-  std::unique_ptr<PromiseFronctocol<
-      FF_TYPES,
-      RandomnessDispenser<
-          ExponentSeries<Small_T>,
-          ExponentSeriesInfo<Small_T>>>>
-      exponentPromiseDispenserGadget(new RandomnessPatron<
+  /* The dealer invokes its houses in this same order. */
+  this->fullExponentDispensers.resize(
+      this->UnboundedFaninOrRandomnessNeeds.size());
+  for (size_t k = 0; k < this->UnboundedFaninOrRandomnessNeeds.size();
+       k++) {
+    this->join.add(
+        *this,
+        std::unique_ptr<PromiseFronctocol<
+            FF_TYPES,
+            RandomnessDispenser<
+                ExponentSeries<Small_T>,
+                ExponentSeriesInfo<Small_T>>>>(
+            new RandomnessPatron<
+                FF_TYPES,
+                ExponentSeries<Small_T>,
+                ExponentSeriesInfo<Small_T>>(
+                *this->dealerIdentity,
+                this->maxNumberCompares,
+                ExponentSeriesInfo<Small_T>(
+                    this->compareInfo.s,
+                    this->UnboundedFaninOrRandomnessNeeds[k]))),
+        this->getPeers(),
+        &this->fullExponentDispensers[k]);
+  }
+
+  log_debug(
+      "requesting %zu beaver triples",
+      this->maxNumberCompares * this->BeaverTriplesNeeded);
+  this->join.add(
+      *this,
+      std::unique_ptr<PromiseFronctocol<
+          FF_TYPES,
+          RandomnessDispenser<
+              BeaverTriple<Small_T>,
+              BeaverInfo<Small_T>>>>(new RandomnessPatron<
                                      FF_TYPES,
-                                     ExponentSeries<Small_T>,
-                                     ExponentSeriesInfo<Small_T>>(
+                                     BeaverTriple<Small_T>,
+                                     BeaverInfo<Small_T>>(
           *this->dealerIdentity,
-          this->maxNumberCompares,
-          ExponentSeriesInfo<Small_T>(
-              this->compareInfo.s,
-              UnboundedFaninOrRandomnessNeeds[0])));
-  this->exponentPromiseDispenser = this->promise(
-      std::move(exponentPromiseDispenserGadget), this->getPeers());
-  this->await(*this->exponentPromiseDispenser);
+          this->maxNumberCompares * this->BeaverTriplesNeeded,
+          this->beaverInfo)),
+      this->getPeers(),
+      &this->fullMultiplyDispenser);
+
+  log_debug(
+      "requesting %zu XOR beaver triples",
+      this->XORBeaverTriplesNeeded);
+  this->join.add(
+      *this,
+      std::unique_ptr<PromiseFronctocol<
+          FF_TYPES,
+          RandomnessDispenser<
+              BeaverTriple<Boolean_t>,
+              BooleanBeaverInfo>>>(new RandomnessPatron<
+                                   FF_TYPES,
+                                   BeaverTriple<Boolean_t>,
+                                   BooleanBeaverInfo>(
+          *this->dealerIdentity,
+          this->XORBeaverTriplesNeeded,
+          BooleanBeaverInfo())),
+      this->getPeers(),
+      &this->XORMultiplyDispenser);
+
+  this->join.add(
+      *this,
+      std::unique_ptr<PromiseFronctocol<
+          FF_TYPES,
+          RandomnessDispenser<
+              TypeCastTriple<Small_T>,
+              TypeCastInfo<Small_T>>>>(new RandomnessPatron<
+                                       FF_TYPES,
+                                       TypeCastTriple<Small_T>,
+                                       TypeCastInfo<Small_T>>(
+          *this->dealerIdentity,
+          2 * this->maxNumberCompares,
+          TypeCastInfo<Small_T>(this->compareInfo.s))),
+      this->getPeers(),
+      &this->fullTctDispenser);
+
+  this->join.add(
+      *this,
+      std::unique_ptr<PromiseFronctocol<
+          FF_TYPES,
+          RandomnessDispenser<
+              DecomposedBitSet<Large_T, Small_T>,
+              DecomposedBitSetInfo<Large_T, Small_T>>>>(
+          new RandomnessPatron<
+              FF_TYPES,
+              DecomposedBitSet<Large_T, Small_T>,
+              DecomposedBitSetInfo<Large_T, Small_T>>(
+              *this->dealerIdentity,
+              this->maxNumberCompares,
+              this->dbsInfo)),
+      this->getPeers(),
+      &this->fullDbsDispenser);
 
   this->littleExponentDispensers =
       std::vector<std::unique_ptr<RandomnessDispenser<
@@ -400,143 +466,14 @@ void QuickSortFronctocol<FF_TYPES, Large_T, Small_T>::handlePromise(
   log_debug("Quicksort Fronctocol received "
             "handle promise");
 
-  switch (this->promiseState) {
-    case (awaitingExponentSeries): {
-      log_debug("quicksort promise awaiting exponent series");
-      this->fullExponentDispensers.emplace_back(
-          std::move(this->exponentPromiseDispenser->getResult(f)));
-      log_assert(
-          this->fullExponentDispensers
-              [this->fullExponentDispensers.size() - 1] != nullptr);
-      if (this->fullExponentDispensers.size() ==
-          this->UnboundedFaninOrRandomnessNeeds.size()) {
-        std::unique_ptr<PromiseFronctocol<
-            FF_TYPES,
-            RandomnessDispenser<
-                BeaverTriple<Small_T>,
-                BeaverInfo<Small_T>>>>
-            multiplyPromiseDispenserGadget(new RandomnessPatron<
-                                           FF_TYPES,
-                                           BeaverTriple<Small_T>,
-                                           BeaverInfo<Small_T>>(
-                *dealerIdentity,
-                this->maxNumberCompares * this->BeaverTriplesNeeded,
-                this->beaverInfo));
-        this->fullMultiplyPromiseDispenser = this->promise(
-            std::move(multiplyPromiseDispenserGadget),
-            this->getPeers());
-        this->await(*this->fullMultiplyPromiseDispenser);
-        this->promiseState = awaitingMultiply;
-        log_debug(
-            "changing to multiply, to get %zu beaver triples",
-            this->maxNumberCompares * this->BeaverTriplesNeeded);
-      } else {
-        std::unique_ptr<PromiseFronctocol<
-            FF_TYPES,
-            RandomnessDispenser<
-                ExponentSeries<Small_T>,
-                ExponentSeriesInfo<Small_T>>>>
-            exponentPromiseDispenserGadget(new RandomnessPatron<
-                                           FF_TYPES,
-                                           ExponentSeries<Small_T>,
-                                           ExponentSeriesInfo<Small_T>>(
-                *dealerIdentity,
-                this->maxNumberCompares,
-                ExponentSeriesInfo<Small_T>(
-                    this->compareInfo.s,
-                    UnboundedFaninOrRandomnessNeeds
-                        [this->fullExponentDispensers.size()])));
-        this->exponentPromiseDispenser = this->promise(
-            std::move(exponentPromiseDispenserGadget),
-            this->getPeers());
-        this->await(*this->exponentPromiseDispenser);
-      }
-
-    } break;
-    case (awaitingMultiply): {
-      log_debug("quicksort promise awaiting multiply");
-      this->fullMultiplyDispenser =
-          this->fullMultiplyPromiseDispenser->getResult(f);
-      log_assert(this->fullMultiplyDispenser != nullptr);
-
-      std::unique_ptr<PromiseFronctocol<
-          FF_TYPES,
-          RandomnessDispenser<
-              BeaverTriple<Boolean_t>,
-              BooleanBeaverInfo>>>
-          XORMultiplyPromiseDispenserGadget(new RandomnessPatron<
-                                            FF_TYPES,
-                                            BeaverTriple<Boolean_t>,
-                                            BooleanBeaverInfo>(
-              *dealerIdentity,
-              this->XORBeaverTriplesNeeded,
-              BooleanBeaverInfo()));
-      this->XORMultiplyPromiseDispenser = this->promise(
-          std::move(XORMultiplyPromiseDispenserGadget),
-          this->getPeers());
-      this->await(*this->XORMultiplyPromiseDispenser);
-      this->promiseState = awaitingXORMultiply;
-      log_debug(
-          "changing to get XOR multiplies. %zu beaver triples",
-          this->XORBeaverTriplesNeeded);
-    } break;
-    case (awaitingXORMultiply): {
-      log_debug("quicksort promise awaiting XOR multiply");
-      this->XORMultiplyDispenser =
-          this->XORMultiplyPromiseDispenser->getResult(f);
-      log_assert(this->XORMultiplyDispenser != nullptr);
-
-      std::unique_ptr<PromiseFronctocol<
-          FF_TYPES,
-          RandomnessDispenser<
-              TypeCastTriple<Small_T>,
-              TypeCastInfo<Small_T>>>>
-          tctPromiseDispenserGadget(new RandomnessPatron<
-                                    FF_TYPES,
-                                    TypeCastTriple<Small_T>,
-                                    TypeCastInfo<Small_T>>(
-              *dealerIdentity,
-              2 * this->maxNumberCompares,
-              TypeCastInfo<Small_T>(this->compareInfo.s)));
-      this->fullTctPromiseDispenser = this->promise(
-          std::move(tctPromiseDispenserGadget), this->getPeers());
-      this->await(*this->fullTctPromiseDispenser);
-      this->promiseState = awaitingTct;
-    } break;
-    case (awaitingTct): {
-      log_debug("quicksort promise awaiting TCT");
-      this->fullTctDispenser =
-          this->fullTctPromiseDispenser->getResult(f);
-      log_assert(this->fullTctDispenser != nullptr);
+  if (!this->join.collect(f)) {
+    log_error("Quicksort received an unexpected promise");
+    this->abort();
+    return;
+  }
 
-      std::unique_ptr<PromiseFronctocol<
-          FF_TYPES,
-          RandomnessDispenser<
-              DecomposedBitSet<Large_T, Small_T>,
-              DecomposedBitSetInfo<Large_T, Small_T>>>>
-          dbsPromiseDispenserGadget(
-              new RandomnessPatron<
-                  FF_TYPES,
-                  DecomposedBitSet<Large_T, Small_T>,
-                  DecomposedBitSetInfo<Large_T, Small_T>>(
-                  *dealerIdentity,
-                  this->maxNumberCompares,
-                  this->dbsInfo));
-      this->fullDbsPromiseDispenser = this->promise(
-          std::move(dbsPromiseDispenserGadget), this->getPeers());
-      this->await(*this->fullDbsPromiseDispenser);
-      this->promiseState = awaitingDbs;
-    } break;
-    case (awaitingDbs): {
-      log_debug("quicksort promise awaiting DBS");
-      this->fullDbsDispenser =
-          this->fullDbsPromiseDispenser->getResult(f);
-      log_assert(this->fullDbsDispenser != nullptr);
-      this->buildCompareDispenser();
-    } break;
-    default:
-      log_error("Compare promise state machine in unexpected state");
-      this->abort();
+  if (this->join.done()) {
+    this->buildCompareDispenser();
   }
 }
 
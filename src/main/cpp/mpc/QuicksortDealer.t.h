@@ -23,23 +23,8 @@ QuicksortRandomnessHouse<FF_TYPES, Large_T, Small_T>::
 
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
 void QuicksortRandomnessHouse<FF_TYPES, Large_T, Small_T>::init() {
-  std::vector<size_t> UnboundedFaninOrRandomnessNeeds;
-
-  size_t block_size = this->compareInfo.lambda;
-  while (block_size < this->compareInfo.ell) {
-    UnboundedFaninOrRandomnessNeeds.emplace_back(block_size);
-    log_debug("block_size: %zu", block_size);
-    block_size += this->compareInfo.lambda;
-  }
-  log_debug("block_size: %zu", this->compareInfo.ell);
-  UnboundedFaninOrRandomnessNeeds.emplace_back(this->compareInfo.ell);
-
-  block_size = 1;
-  while ((block_size - 1) < this->compareInfo.lambda) {
-    log_debug("block_size: %lu", block_size);
-    UnboundedFaninOrRandomnessNeeds.emplace_back(block_size);
-    block_size++;
-  }
+  std::vector<size_t> const UnboundedFaninOrRandomnessNeeds =
+      this->compareInfo.exponentSeriesNeeds();
   log_debug("Total size: %lu", UnboundedFaninOrRandomnessNeeds.size());
 
   this->numDealersRemaining =
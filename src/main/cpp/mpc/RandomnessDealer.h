@@ -8,6 +8,7 @@
 /* C and POSIX Headers */
 
 /* C++ Headers */
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -17,6 +18,8 @@
 
 /* Fortissimo Headers */
 #include <ff/Fronctocol.h>
+#include <ff/Promise.h>
+#include <mpc/PackedRandomness.h>
 #include <mpc/Randomness.h>
 #include <mpc/templates.h>
 
@@ -55,7 +58,32 @@ class RandomnessHouse : public Fronctocol<FF_TYPES> {
   size_t numParties = 0;
   size_t numReceived = 0;
 
+  /**
+   * Messages of each batch of instances to the patrons, which are
+   * dealt by compute tasks and then sent in order.
+   */
+  ::std::vector<Identity_T> patrons;
+  ::std::vector<::std::vector<::std::unique_ptr<OutgoingMessage_T>>>
+      batches;
+  ::std::vector<bool> batchDealt;
+  size_t numBatchesSent = 0;
+
+  void dealBatch(
+      size_t const batch,
+      size_t const begin,
+      size_t const end,
+      size_t const numBatches,
+      size_t const numPerBatch);
+  void sendDealtBatches();
+
 public:
+  /**
+   * Number of instances dealt to each patron.
+   */
+  size_t getNumDealt() const {
+    return this->numDesired;
+  }
+
   void init() override;
   void handleReceive(IncomingMessage_T & msg) override;
   void handleComplete(Fronctocol<FF_TYPES> & f) override;
@@ -92,6 +120,71 @@ private:
   size_t batchesReceived = 0;
 };
 
+/**
+ * The ShardedRandomnessHouse is one of several dealers which share
+ * the work of a ShardedRandomnessPatron. Its peers are the patrons and
+ * every dealer, but it deals only to the patrons, through a
+ * RandomnessHouse.
+ */
+template<FF_TYPENAMES, typename Rand_T, typename Info_T>
+class ShardedRandomnessHouse : public Fronctocol<FF_TYPES> {
+public:
+  std::string name() override;
+
+  ::std::vector<Identity_T> const dealers;
+
+  /**
+   * Number of instances this shard dealt to each patron, set once it
+   * completes.
+   */
+  size_t numDealt = 0;
+
+  ShardedRandomnessHouse(::std::vector<Identity_T> const & dealers) :
+      dealers(dealers) {
+  }
+
+  void init() override;
+  void handleReceive(IncomingMessage_T & msg) override;
+  void handleComplete(Fronctocol<FF_TYPES> & f) override;
+  void handlePromise(Fronctocol<FF_TYPES> & f) override;
+};
+
+/**
+ * The ShardedRandomnessPatron requests randomness from several dealers
+ * at once, so that generating it scales with the number of dealers.
+ *
+ * The i'th dealer deals the i'th of the contiguous, near equal ranges
+ * of instances, and the ranges are merged in dealer order. The patron's
+ * peers must include every dealer, each running a
+ * ShardedRandomnessHouse with the same list of dealers.
+ */
+template<FF_TYPENAMES, typename Rand_T, typename Info_T>
+class ShardedRandomnessPatron
+    : public RandomnessGenerator<FF_TYPES, Rand_T, Info_T> {
+public:
+  std::string name() override;
+
+  ::std::vector<Identity_T> const dealers;
+
+  ShardedRandomnessPatron(
+      ::std::vector<Identity_T> const & dealers,
+      size_t n,
+      Info_T const & i) :
+      RandomnessGenerator<FF_TYPES, Rand_T, Info_T>(n, i),
+      dealers(dealers) {
+  }
+
+  void init() override;
+  void handleReceive(IncomingMessage_T & im) override;
+  void handleComplete(Fronctocol<FF_TYPES> & f) override;
+  void handlePromise(Fronctocol<FF_TYPES> & f) override;
+
+private:
+  PromiseJoin<FF_TYPES> join;
+  ::std::vector<::std::unique_ptr<RandomnessDispenser<Rand_T, Info_T>>>
+      shards;
+};
+
 #include <mpc/RandomnessDealer.t.h>
 
 } // namespace mpc
@@ -58,7 +58,10 @@ void RandomnessHouse<FF_TYPES, Randomness_T, Info_T>::handleReceive(
     log_debug(
         "randomness house beginning to send randomness instances");
 
-    size_t const single_instance_size = this->info.instanceSize();
+    using Packing = PackedRandomness<Randomness_T, Info_T>;
+    size_t const single_instance_size = Packing::packed ?
+        ::std::max<size_t>(1, (Packing::bits(this->info) + 7) / 8) :
+        this->info.instanceSize();
     size_t const batch_size =
         (single_instance_size > DEFAULT_BATCH_SIZE) ?
         single_instance_size :
@@ -67,53 +70,97 @@ void RandomnessHouse<FF_TYPES, Randomness_T, Info_T>::handleReceive(
     size_t const num_batches = (this->numDesired % num_per_batch == 0) ?
         this->numDesired / num_per_batch :
         1 + (this->numDesired / num_per_batch);
-    size_t total_sent = 0;
-    size_t i = 0;
-    size_t j = 0;
 
     log_debug(
         "rands per batch: %zu, num batches: %zu",
         num_per_batch,
         num_batches);
 
-    for (i = 0; i < num_batches; i++) {
-      log_debug("i: %lu", i);
-
-      std::vector<std::unique_ptr<OutgoingMessage_T>> omsgs;
-      this->getPeers().forEach([&](Identity_T const & peer) {
-        if (this->getSelf() == peer) {
-          return;
-        }
-
-        omsgs.emplace_back(new OutgoingMessage_T(peer));
-
-        if (i == 0) {
-          omsgs[omsgs.size() - 1]->template write<uint64_t>(
-              (uint64_t)num_batches);
-          omsgs[omsgs.size() - 1]->template write<uint64_t>(
-              (uint64_t)num_per_batch);
-        }
-      });
-
-      for (j = 0; j < num_per_batch && total_sent < this->numDesired;
-           j++) {
-        ::std::vector<Randomness_T> vals;
-        log_debug("Calling generate");
-        this->info.generate(omsgs.size(), total_sent, vals);
-        log_assert(vals.size() == omsgs.size());
-        for (size_t k = 0; k < omsgs.size(); k++) {
-          omsgs[k]->template write<Randomness_T>(vals[k]);
-        }
-        total_sent++;
+    this->getPeers().forEach([this](Identity_T const & peer) {
+      if (this->getSelf() != peer) {
+        this->patrons.push_back(peer);
       }
-      log_assert(j == num_per_batch || total_sent == this->numDesired);
+    });
 
-      for (std::unique_ptr<OutgoingMessage_T> & omsg : omsgs) {
-        log_debug("sending randomness");
-        this->send(std::move(omsg));
+    // Each batch is dealt by its own compute task, so that they may be
+    // generated in parallel, but they are sent in order.
+    this->batches.resize(num_batches);
+    this->batchDealt.resize(num_batches, false);
+    for (size_t i = 0; i < num_batches; i++) {
+      size_t const begin = i * num_per_batch;
+      size_t const end =
+          ::std::min(this->numDesired, begin + num_per_batch);
+      this->compute(
+          [this, i, begin, end, num_batches, num_per_batch]() {
+            this->dealBatch(i, begin, end, num_batches, num_per_batch);
+          },
+          [this, i]() {
+            this->batchDealt[i] = true;
+            this->sendDealtBatches();
+          });
+    }
+    if (num_batches == 0) {
+      this->sendDealtBatches();
+    }
+  }
+}
+
+template<FF_TYPENAMES, typename Randomness_T, typename Info_T>
+void RandomnessHouse<FF_TYPES, Randomness_T, Info_T>::dealBatch(
+    size_t const batch,
+    size_t const begin,
+    size_t const end,
+    size_t const numBatches,
+    size_t const numPerBatch) {
+  using Packing = PackedRandomness<Randomness_T, Info_T>;
+
+  std::vector<std::unique_ptr<OutgoingMessage_T>> & omsgs =
+      this->batches[batch];
+  for (Identity_T const & patron : this->patrons) {
+    omsgs.emplace_back(new OutgoingMessage_T(patron));
+
+    if (batch == 0) {
+      omsgs.back()->template write<uint64_t>((uint64_t)numBatches);
+      omsgs.back()->template write<uint64_t>((uint64_t)numPerBatch);
+    }
+  }
+
+  ::std::vector<BitWriter> writers(Packing::packed ? omsgs.size() : 0);
+  for (size_t j = begin; j < end; j++) {
+    ::std::vector<Randomness_T> vals;
+    this->info.generate(omsgs.size(), j, vals);
+    log_assert(vals.size() == omsgs.size());
+    for (size_t k = 0; k < omsgs.size(); k++) {
+      if (Packing::packed) {
+        Packing::pack(writers[k], this->info, vals[k]);
+      } else {
+        omsgs[k]->template write<Randomness_T>(vals[k]);
       }
     }
-    log_assert(i == num_batches);
+  }
+
+  // Packed batches lead with their count, then the bit string.
+  for (size_t k = 0; k < writers.size(); k++) {
+    omsgs[k]->template write<uint64_t>((uint64_t)(end - begin));
+    writers[k].flush(*omsgs[k]);
+  }
+}
+
+template<FF_TYPENAMES, typename Randomness_T, typename Info_T>
+void RandomnessHouse<FF_TYPES, Randomness_T, Info_T>::
+    sendDealtBatches() {
+  while (this->numBatchesSent < this->batches.size() &&
+         this->batchDealt[this->numBatchesSent]) {
+    for (std::unique_ptr<OutgoingMessage_T> & omsg :
+         this->batches[this->numBatchesSent]) {
+      log_debug("sending randomness");
+      this->send(std::move(omsg));
+    }
+    this->batches[this->numBatchesSent].clear();
+    this->numBatchesSent++;
+  }
+
+  if (this->numBatchesSent == this->batches.size()) {
     this->complete();
     log_debug("done sending randomness instances");
   }
@@ -174,10 +221,27 @@ void RandomnessPatron<FF_TYPES, Randomness_T, Info_T>::handleReceive(
     this->batchSize = (size_t)batchSize64;
   }
 
-  for (size_t i = 0; i < batchSize && im.length() > 0; i++) {
-    Randomness_T val(this->info);
-    im.template read<Randomness_T>(val);
-    this->result->insert(val);
+  using Packing = PackedRandomness<Randomness_T, Info_T>;
+  if (Packing::packed) {
+    uint64_t count = 0;
+    im.template read<uint64_t>(count);
+    BitReader reader(im, (size_t)count * Packing::bits(this->info));
+    for (size_t i = 0; i < (size_t)count; i++) {
+      Randomness_T val(this->info);
+      Packing::unpack(reader, this->info, val);
+      this->result->insert(::std::move(val));
+    }
+    if (!reader.ok()) {
+      log_error("Randomness Patron received a short packed batch");
+      this->abort();
+      return;
+    }
+  } else {
+    for (size_t i = 0; i < batchSize && im.length() > 0; i++) {
+      Randomness_T val(this->info);
+      im.template read<Randomness_T>(val);
+      this->result->insert(val);
+    }
   }
 
   log_assert(im.length() == 0);
@@ -204,3 +268,137 @@ void RandomnessPatron<FF_TYPES, Randomness_T, Info_T>::handlePromise(
         OutgoingMessage_T> &) {
   log_fatal("Unexpected handle complete on Randomness Patron");
 }
+
+/**
+ * Peers of a sharded house or patron, less every dealer but one.
+ */
+template<typename Identity_T, typename PeerSet_T>
+PeerSet_T shardPeers(
+    PeerSet_T const & peers,
+    ::std::vector<Identity_T> const & dealers,
+    Identity_T const & dealer) {
+  PeerSet_T shard_peers(peers);
+  for (Identity_T const & other : dealers) {
+    if (other != dealer) {
+      shard_peers.remove(other);
+    }
+  }
+  return shard_peers;
+}
+
+template<FF_TYPENAMES, typename Randomness_T, typename Info_T>
+std::string
+ShardedRandomnessHouse<FF_TYPES, Randomness_T, Info_T>::name() {
+  return std::string("Sharded Randomness House ") +
+      Randomness_T::name();
+}
+
+template<FF_TYPENAMES, typename Randomness_T, typename Info_T>
+void ShardedRandomnessHouse<FF_TYPES, Randomness_T, Info_T>::init() {
+  std::unique_ptr<Fronctocol<FF_TYPES>> house(
+      new RandomnessHouse<FF_TYPES, Randomness_T, Info_T>());
+  this->invoke(
+      std::move(house),
+      shardPeers(this->getPeers(), this->dealers, this->getSelf()));
+}
+
+template<FF_TYPENAMES, typename Randomness_T, typename Info_T>
+void ShardedRandomnessHouse<FF_TYPES, Randomness_T, Info_T>::
+    handleReceive(IncomingMessage_T &) {
+  log_error("Sharded Randomness House received unexpected "
+            "handle receive");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Randomness_T, typename Info_T>
+void ShardedRandomnessHouse<FF_TYPES, Randomness_T, Info_T>::
+    handleComplete(Fronctocol<FF_TYPES> & f) {
+  this->numDealt =
+      static_cast<RandomnessHouse<FF_TYPES, Randomness_T, Info_T> &>(f)
+          .getNumDealt();
+  this->complete();
+}
+
+template<FF_TYPENAMES, typename Randomness_T, typename Info_T>
+void ShardedRandomnessHouse<FF_TYPES, Randomness_T, Info_T>::
+    handlePromise(Fronctocol<FF_TYPES> &) {
+  log_error("Sharded Randomness House received unexpected "
+            "handle promise");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Randomness_T, typename Info_T>
+std::string
+ShardedRandomnessPatron<FF_TYPES, Randomness_T, Info_T>::name() {
+  return std::string("Sharded Randomness Patron ") +
+      Randomness_T::name();
+}
+
+template<FF_TYPENAMES, typename Randomness_T, typename Info_T>
+void ShardedRandomnessPatron<FF_TYPES, Randomness_T, Info_T>::init() {
+  size_t const num_shards = this->dealers.size();
+  if (num_shards == 0) {
+    log_error("Sharded Randomness Patron has no dealers");
+    this->abort();
+    return;
+  }
+
+  this->shards.resize(num_shards);
+  for (size_t i = 0; i < num_shards; i++) {
+    size_t const begin = i * this->numDesired / num_shards;
+    size_t const end = (i + 1) * this->numDesired / num_shards;
+
+    this->join.add(
+        *this,
+        std::unique_ptr<PromiseFronctocol<
+            FF_TYPES,
+            RandomnessDispenser<Randomness_T, Info_T>>>(
+            new RandomnessPatron<FF_TYPES, Randomness_T, Info_T>(
+                this->dealers[i], end - begin, this->info)),
+        shardPeers(this->getPeers(), this->dealers, this->dealers[i]),
+        &this->shards[i]);
+  }
+}
+
+template<FF_TYPENAMES, typename Randomness_T, typename Info_T>
+void ShardedRandomnessPatron<FF_TYPES, Randomness_T, Info_T>::
+    handleReceive(IncomingMessage_T &) {
+  log_error("Sharded Randomness Patron received unexpected "
+            "handle receive");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Randomness_T, typename Info_T>
+void ShardedRandomnessPatron<FF_TYPES, Randomness_T, Info_T>::
+    handleComplete(Fronctocol<FF_TYPES> &) {
+  log_error("Sharded Randomness Patron received unexpected "
+            "handle complete");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Randomness_T, typename Info_T>
+void ShardedRandomnessPatron<FF_TYPES, Randomness_T, Info_T>::
+    handlePromise(Fronctocol<FF_TYPES> & f) {
+  if (!this->join.collect(f)) {
+    log_error("Sharded Randomness Patron received an unexpected "
+              "promise");
+    this->abort();
+    return;
+  }
+  if (!this->join.done()) {
+    return;
+  }
+
+  this->result =
+      ::std::unique_ptr<RandomnessDispenser<Randomness_T, Info_T>>(
+          new RandomnessDispenser<Randomness_T, Info_T>(this->info));
+  for (::std::unique_ptr<RandomnessDispenser<Randomness_T, Info_T>> &
+           shard : this->shards) {
+    while (shard->size() > 0) {
+      this->result->insert(shard->get());
+    }
+    shard.reset();
+  }
+
+  this->complete();
+}
@@ -0,0 +1,130 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+#ifndef FF_MPC_RANDOMNESS_STREAM_H_
+#define FF_MPC_RANDOMNESS_STREAM_H_
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+
+/* Fortissimo Headers */
+#include <ff/Fronctocol.h>
+#include <ff/Promise.h>
+#include <mpc/Randomness.h>
+#include <mpc/RandomnessDealer.h>
+#include <mpc/templates.h>
+
+/* logging Configuration */
+#include <ff/logging.h>
+
+namespace ff {
+namespace mpc {
+
+/**
+ * A RandomnessStream requests randomness from a dealer in several
+ * chunks, each dealt by its own RandomnessHouse, and makes each chunk
+ * available as soon as it and the chunks before it have arrived. This
+ * lets a consumer start on the first instances while the rest are
+ * still being dealt, and wait only when it runs ahead of the dealer.
+ *
+ * Like a PromiseJoin, the stream is held by the consuming fronctocol,
+ * which passes each of its ``handlePromise`` calls to ``collect``. The
+ * dealer runs a RandomnessStreamHouse with the same number of chunks in
+ * the consumer's place.
+ */
+template<FF_TYPENAMES, typename Rand_T, typename Info_T>
+class RandomnessStream {
+public:
+  RandomnessStream(Info_T const & info);
+
+  /**
+   * Promises every chunk of ``numDesired`` instances from ``consumer``
+   * and awaits them.
+   */
+  void request(
+      Fronctocol<FF_TYPES> & consumer,
+      Identity_T const & dealer,
+      size_t numDesired,
+      size_t numChunks,
+      PeerSet_T const & peers);
+
+  /**
+   * Takes the chunk promised by ``f``, and makes available every chunk
+   * which has arrived in order. Returns false if ``f`` is not a chunk
+   * of this stream.
+   */
+  bool collect(Fronctocol<FF_TYPES> & f);
+
+  /**
+   * Instances which have arrived and not been dispensed yet.
+   */
+  size_t available() {
+    return this->ready->size();
+  }
+
+  /**
+   * True once every chunk has arrived.
+   */
+  bool done() const {
+    return this->join.done();
+  }
+
+  /**
+   * The instances available so far, which may be taken with ``get()``
+   * or ``littleDispenser()``.
+   */
+  RandomnessDispenser<Rand_T, Info_T> & dispenser() {
+    return *this->ready;
+  }
+
+private:
+  PromiseJoin<FF_TYPES> join;
+
+  ::std::vector<::std::unique_ptr<RandomnessDispenser<Rand_T, Info_T>>>
+      chunks;
+  size_t nextChunk = 0;
+
+  ::std::unique_ptr<RandomnessDispenser<Rand_T, Info_T>> ready;
+};
+
+/**
+ * The dealer's side of a RandomnessStream, dealing each chunk with a
+ * RandomnessHouse. It is invoked as the counterpart of the fronctocol
+ * which consumes the stream.
+ */
+template<FF_TYPENAMES, typename Rand_T, typename Info_T>
+class RandomnessStreamHouse : public Fronctocol<FF_TYPES> {
+public:
+  std::string name() override;
+
+  RandomnessStreamHouse(size_t numChunks) : numChunks(numChunks) {
+  }
+
+  void init() override;
+  void handleReceive(IncomingMessage_T & msg) override;
+  void handleComplete(Fronctocol<FF_TYPES> & f) override;
+  void handlePromise(Fronctocol<FF_TYPES> & f) override;
+
+private:
+  size_t const numChunks;
+  size_t numChunksDealt = 0;
+};
+
+} // namespace mpc
+} // namespace ff
+
+#include <mpc/RandomnessStream.t.h>
+
+#define LOG_UNCLUDE
+#include <ff/logging.h>
+
+#endif // FF_MPC_RANDOMNESS_STREAM_H_
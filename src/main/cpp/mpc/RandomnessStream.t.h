@@ -0,0 +1,102 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+namespace ff {
+namespace mpc {
+
+template<FF_TYPENAMES, typename Rand_T, typename Info_T>
+RandomnessStream<FF_TYPES, Rand_T, Info_T>::RandomnessStream(
+    Info_T const & info) :
+    ready(new RandomnessDispenser<Rand_T, Info_T>(info)) {
+}
+
+template<FF_TYPENAMES, typename Rand_T, typename Info_T>
+void RandomnessStream<FF_TYPES, Rand_T, Info_T>::request(
+    Fronctocol<FF_TYPES> & consumer,
+    Identity_T const & dealer,
+    size_t numDesired,
+    size_t numChunks,
+    PeerSet_T const & peers) {
+  log_assert(numChunks > 0);
+
+  this->chunks.resize(numChunks);
+  for (size_t i = 0; i < numChunks; i++) {
+    size_t const begin = i * numDesired / numChunks;
+    size_t const end = (i + 1) * numDesired / numChunks;
+
+    this->join.add(
+        consumer,
+        ::std::unique_ptr<PromiseFronctocol<
+            FF_TYPES,
+            RandomnessDispenser<Rand_T, Info_T>>>(
+            new RandomnessPatron<FF_TYPES, Rand_T, Info_T>(
+                dealer, end - begin, this->ready->info)),
+        peers,
+        &this->chunks[i]);
+  }
+}
+
+template<FF_TYPENAMES, typename Rand_T, typename Info_T>
+bool RandomnessStream<FF_TYPES, Rand_T, Info_T>::collect(
+    Fronctocol<FF_TYPES> & f) {
+  if (!this->join.collect(f)) {
+    return false;
+  }
+
+  // Chunks may complete out of order, but are dispensed in order.
+  while (this->nextChunk < this->chunks.size() &&
+         this->chunks[this->nextChunk] != nullptr) {
+    RandomnessDispenser<Rand_T, Info_T> & chunk =
+        *this->chunks[this->nextChunk];
+    while (chunk.size() > 0) {
+      this->ready->insert(chunk.get());
+    }
+    this->chunks[this->nextChunk].reset();
+    this->nextChunk++;
+  }
+
+  return true;
+}
+
+template<FF_TYPENAMES, typename Rand_T, typename Info_T>
+std::string RandomnessStreamHouse<FF_TYPES, Rand_T, Info_T>::name() {
+  return std::string("Randomness Stream House ") + Rand_T::name();
+}
+
+template<FF_TYPENAMES, typename Rand_T, typename Info_T>
+void RandomnessStreamHouse<FF_TYPES, Rand_T, Info_T>::init() {
+  for (size_t i = 0; i < this->numChunks; i++) {
+    std::unique_ptr<Fronctocol<FF_TYPES>> house(
+        new RandomnessHouse<FF_TYPES, Rand_T, Info_T>());
+    this->invoke(std::move(house), this->getPeers());
+  }
+}
+
+template<FF_TYPENAMES, typename Rand_T, typename Info_T>
+void RandomnessStreamHouse<FF_TYPES, Rand_T, Info_T>::handleReceive(
+    IncomingMessage_T &) {
+  log_error("Randomness Stream House received unexpected "
+            "handle receive");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Rand_T, typename Info_T>
+void RandomnessStreamHouse<FF_TYPES, Rand_T, Info_T>::handleComplete(
+    Fronctocol<FF_TYPES> &) {
+  this->numChunksDealt++;
+  if (this->numChunksDealt == this->numChunks) {
+    this->complete();
+  }
+}
+
+template<FF_TYPENAMES, typename Rand_T, typename Info_T>
+void RandomnessStreamHouse<FF_TYPES, Rand_T, Info_T>::handlePromise(
+    Fronctocol<FF_TYPES> &) {
+  log_error("Randomness Stream House received unexpected "
+            "handle promise");
+  this->abort();
+}
+
+} // namespace mpc
+} // namespace ff
@@ -13,12 +13,15 @@
 
 /* C++ Headers */
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 /* 3rd Party Headers */
 
 /* Fortissimo Headers */
 #include <ff/Fronctocol.h>
+#include <mpc/Opening.h>
 #include <mpc/templates.h>
 
 /* logging configuration */
@@ -27,8 +30,12 @@
 namespace ff {
 namespace mpc {
 
+/**
+ * Opens a shared value. The revealer is the root of king and tree
+ * openings.
+ */
 template<FF_TYPENAMES, typename Number_T>
-class Reveal : public Fronctocol<FF_TYPES> {
+class Reveal : public OpeningFronctocol<FF_TYPES> {
 public:
   std::string name() override;
 
@@ -37,8 +44,11 @@ public:
   Reveal(
       Number_T const & share,
       Number_T const & mod,
-      const Identity_T * rev) :
-      openedValue(share), modulus(mod), revealer(rev) {
+      const Identity_T * rev,
+      Opening const & o = Opening()) :
+      OpeningFronctocol<FF_TYPES>(o, rev),
+      openedValue(share),
+      modulus(mod) {
   }
 
   void init() override;
@@ -46,11 +56,50 @@ public:
   void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
   void handlePromise(ff::Fronctocol<FF_TYPES> & f) override;
 
+protected:
+  void writeShares(OutgoingMessage_T & omsg) override;
+  void combineShares(IncomingMessage_T & imsg) override;
+  void readOpened(IncomingMessage_T & imsg) override;
+  void opened() override;
+
+private:
+  Number_T modulus;
+};
+
+/**
+ * Reconstructs many values in lock-step, exchanging a single message with
+ * each peer for all of the values.
+ */
+template<FF_TYPENAMES, typename Number_T>
+class BatchedReveal : public OpeningFronctocol<FF_TYPES> {
+public:
+  std::string name() override;
+
+  ::std::vector<Number_T> openedValues;
+
+  BatchedReveal(
+      ::std::vector<Number_T> && shares,
+      Number_T const & mod,
+      const Identity_T * rev,
+      Opening const & o = Opening()) :
+      OpeningFronctocol<FF_TYPES>(o, rev),
+      openedValues(::std::move(shares)),
+      modulus(mod) {
+  }
+
+  void init() override;
+  void handleReceive(IncomingMessage_T & imsg) override;
+  void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
+  void handlePromise(ff::Fronctocol<FF_TYPES> & f) override;
+
+protected:
+  void writeShares(OutgoingMessage_T & omsg) override;
+  void combineShares(IncomingMessage_T & imsg) override;
+  void readOpened(IncomingMessage_T & imsg) override;
+  void opened() override;
+
 private:
   Number_T modulus;
-  const Identity_T * revealer;
-  size_t numOutstandingMessages =
-      0; // used for tracking "state machine" behavior
 };
 
 } // namespace mpc
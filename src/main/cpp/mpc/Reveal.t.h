@@ -11,19 +11,26 @@ std::string Reveal<FF_TYPES, Number_T>::name() {
 }
 
 template<FF_TYPENAMES>
-class Reveal<FF_TYPES, Boolean_t> : public Fronctocol<FF_TYPES> {
+class Reveal<FF_TYPES, Boolean_t> : public OpeningFronctocol<FF_TYPES> {
 public:
   std::string name() override {
     return std::string("Reveal Boolean");
   }
   Boolean_t openedValue;
 
-  Reveal(Boolean_t share, const Boolean_t &, const Identity_T * rev) :
-      openedValue(share), revealer(rev) {
+  Reveal(
+      Boolean_t share,
+      const Boolean_t &,
+      const Identity_T * rev,
+      Opening const & o = Opening()) :
+      OpeningFronctocol<FF_TYPES>(o, rev), openedValue(share) {
   }
 
-  Reveal(Boolean_t share, const Identity_T * rev) :
-      openedValue(share), revealer(rev) {
+  Reveal(
+      Boolean_t share,
+      const Identity_T * rev,
+      Opening const & o = Opening()) :
+      OpeningFronctocol<FF_TYPES>(o, rev), openedValue(share) {
   }
 
   void init() override;
@@ -31,10 +38,11 @@ public:
   void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
   void handlePromise(ff::Fronctocol<FF_TYPES> & f) override;
 
-private:
-  const Identity_T * revealer;
-  size_t numOutstandingMessages =
-      0; // used for tracking "state machine" behavior
+protected:
+  void writeShares(OutgoingMessage_T & omsg) override;
+  void combineShares(IncomingMessage_T & imsg) override;
+  void readOpened(IncomingMessage_T & imsg) override;
+  void opened() override;
 };
 
 template<FF_TYPENAMES, typename Number_T>
@@ -76,40 +84,37 @@ void Reveal<FF_TYPES, Boolean_t>::handlePromise(
 
 template<FF_TYPENAMES, typename Number_T>
 void Reveal<FF_TYPES, Number_T>::init() {
-  this->numOutstandingMessages = 0;
-  this->getPeers().forEach([this](Identity_T const & other) {
-    if (this->getSelf() != other) {
-      std::unique_ptr<OutgoingMessage_T> omsg(
-          new OutgoingMessage_T(other));
+  this->open();
+}
 
-      if_debug {
-        omsg->template write<Number_T>(this->modulus);
-      }
+template<FF_TYPENAMES>
+void Reveal<FF_TYPES, Boolean_t>::init() {
+  this->open();
+}
 
-      omsg->template write<Number_T>(this->openedValue);
-      this->send(std::move(omsg));
-      this->numOutstandingMessages++;
-    }
-  });
+template<FF_TYPENAMES, typename Number_T>
+void Reveal<FF_TYPES, Number_T>::handleReceive(
+    IncomingMessage_T & imsg) {
+  this->receiveOpening(imsg);
 }
 
 template<FF_TYPENAMES>
-void Reveal<FF_TYPES, Boolean_t>::init() {
-  this->numOutstandingMessages = 0;
-  this->getPeers().forEach([this](Identity_T const & other) {
-    if (this->getSelf() != other) {
-      std::unique_ptr<OutgoingMessage_T> omsg(
-          new OutgoingMessage_T(other));
+void Reveal<FF_TYPES, Boolean_t>::handleReceive(
+    IncomingMessage_T & imsg) {
+  this->receiveOpening(imsg);
+}
 
-      omsg->template write<Boolean_t>(this->openedValue);
-      this->send(std::move(omsg));
-      this->numOutstandingMessages++;
-    }
-  });
+template<FF_TYPENAMES, typename Number_T>
+void Reveal<FF_TYPES, Number_T>::writeShares(OutgoingMessage_T & omsg) {
+  if_debug {
+    omsg.template write<Number_T>(this->modulus);
+  }
+
+  omsg.template write<Number_T>(this->openedValue);
 }
 
 template<FF_TYPENAMES, typename Number_T>
-void Reveal<FF_TYPES, Number_T>::handleReceive(
+void Reveal<FF_TYPES, Number_T>::combineShares(
     IncomingMessage_T & imsg) {
   if_debug {
     Number_T other_mod = 0;
@@ -121,24 +126,134 @@ void Reveal<FF_TYPES, Number_T>::handleReceive(
   imsg.template read<Number_T>(temp_val);
   this->openedValue =
       modAdd(this->openedValue, temp_val, this->modulus);
-  this->numOutstandingMessages--;
+}
 
-  if (this->numOutstandingMessages == 0) {
-    this->complete();
+template<FF_TYPENAMES, typename Number_T>
+void Reveal<FF_TYPES, Number_T>::readOpened(IncomingMessage_T & imsg) {
+  if_debug {
+    Number_T other_mod = 0;
+    imsg.template read<Number_T>(other_mod);
+    log_assert(this->modulus == other_mod);
   }
+
+  imsg.template read<Number_T>(this->openedValue);
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void Reveal<FF_TYPES, Number_T>::opened() {
+  this->complete();
 }
 
 template<FF_TYPENAMES>
-void Reveal<FF_TYPES, Boolean_t>::handleReceive(
+void Reveal<FF_TYPES, Boolean_t>::writeShares(
+    OutgoingMessage_T & omsg) {
+  omsg.template write<Boolean_t>(this->openedValue);
+}
+
+template<FF_TYPENAMES>
+void Reveal<FF_TYPES, Boolean_t>::combineShares(
     IncomingMessage_T & imsg) {
   Boolean_t temp_val = 0;
   imsg.template read<Boolean_t>(temp_val);
   this->openedValue = this->openedValue ^ temp_val;
-  this->numOutstandingMessages--;
+}
+
+template<FF_TYPENAMES>
+void Reveal<FF_TYPES, Boolean_t>::readOpened(IncomingMessage_T & imsg) {
+  imsg.template read<Boolean_t>(this->openedValue);
+}
 
-  if (this->numOutstandingMessages == 0) {
-    this->complete();
+template<FF_TYPENAMES>
+void Reveal<FF_TYPES, Boolean_t>::opened() {
+  this->complete();
+}
+
+template<FF_TYPENAMES, typename Number_T>
+std::string BatchedReveal<FF_TYPES, Number_T>::name() {
+  return std::string("Batched Reveal size: ") +
+      std::to_string(this->openedValues.size()) +
+      " modulus: " + dec(this->modulus);
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedReveal<FF_TYPES, Number_T>::handleComplete(
+    ff::Fronctocol<FF_TYPES> &) {
+  log_error("Batched Reveal Fronctocol received unexpected "
+            "handle complete");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedReveal<FF_TYPES, Number_T>::handlePromise(
+    ff::Fronctocol<FF_TYPES> &) {
+  log_error("Batched Reveal Fronctocol received unexpected "
+            "handlePromise");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedReveal<FF_TYPES, Number_T>::init() {
+  this->open();
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedReveal<FF_TYPES, Number_T>::handleReceive(
+    IncomingMessage_T & imsg) {
+  this->receiveOpening(imsg);
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedReveal<FF_TYPES, Number_T>::writeShares(
+    OutgoingMessage_T & omsg) {
+  if_debug {
+    omsg.template write<Number_T>(this->modulus);
+    omsg.template write<uint64_t>((uint64_t)this->openedValues.size());
+  }
+
+  for (Number_T const & value : this->openedValues) {
+    omsg.template write<Number_T>(value);
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedReveal<FF_TYPES, Number_T>::combineShares(
+    IncomingMessage_T & imsg) {
+  if_debug {
+    Number_T other_mod = 0;
+    imsg.template read<Number_T>(other_mod);
+    log_assert(this->modulus == other_mod);
+    uint64_t other_size = 0;
+    imsg.template read<uint64_t>(other_size);
+    log_assert((size_t)other_size == this->openedValues.size());
+  }
+
+  Number_T temp_val = 0;
+  for (Number_T & value : this->openedValues) {
+    imsg.template read<Number_T>(temp_val);
+    value = modAdd(value, temp_val, this->modulus);
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedReveal<FF_TYPES, Number_T>::readOpened(
+    IncomingMessage_T & imsg) {
+  if_debug {
+    Number_T other_mod = 0;
+    imsg.template read<Number_T>(other_mod);
+    log_assert(this->modulus == other_mod);
+    uint64_t other_size = 0;
+    imsg.template read<uint64_t>(other_size);
+    log_assert((size_t)other_size == this->openedValues.size());
   }
+
+  for (Number_T & value : this->openedValues) {
+    imsg.template read<Number_T>(value);
+  }
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedReveal<FF_TYPES, Number_T>::opened() {
+  this->complete();
 }
 
 } // namespace mpc
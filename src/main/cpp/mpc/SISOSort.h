@@ -65,14 +65,18 @@ public:
       ObservationList<Large_T> & sharedList,
       Large_T modulus,
       const Identity_T * revealer,
-      const Identity_T * dealerIdentity);
+      const Identity_T * dealerIdentity,
+      std::vector<Identity_T> const & dealers =
+          std::vector<Identity_T>());
 
   SISOSort(
       ObservationList<Large_T> & sharedList,
       Large_T modulus,
       Large_T keyModulus,
       const Identity_T * revealer,
-      const Identity_T * dealerIdentity);
+      const Identity_T * dealerIdentity,
+      std::vector<Identity_T> const & dealers =
+          std::vector<Identity_T>());
 
   void init() override;
 
@@ -88,7 +92,6 @@ private:
 
   enum SISOSortState { awaitingWaksman, awaitingQuicksort };
   SISOSortState state = awaitingWaksman;
-  size_t numPromisesRemaining = 4;
 
   std::unique_ptr<CompareInfo<Identity_T, Large_T, Small_T>>
       compareInfo;
@@ -96,7 +99,8 @@ private:
   Large_T modulus;
   Large_T keyModulus;
 
-  std::vector<std::vector<Small_T>> lagrangePolynomialSet;
+  std::shared_ptr<LagrangePolynomialSet<Small_T> const>
+      lagrangePolynomialSet;
 
   const Identity_T * revealer;
 
@@ -110,39 +114,30 @@ private:
   BeaverInfo<Large_T> keyBeaverInfo;
   WaksmanInfo<Large_T> waksmanInfo;
 
-  std::unique_ptr<Promise<
-      FF_TYPES,
-      RandomnessDispenser<BeaverTriple<Large_T>, BeaverInfo<Large_T>>>>
-      multiplyPromiseDispenser;
+  /* Every randomness type is requested from the dealers at once. */
+  PromiseJoin<FF_TYPES> join;
 
   std::unique_ptr<
       RandomnessDispenser<BeaverTriple<Large_T>, BeaverInfo<Large_T>>>
       mrd;
 
-  std::unique_ptr<Promise<
-      FF_TYPES,
-      RandomnessDispenser<BeaverTriple<Large_T>, BeaverInfo<Large_T>>>>
-      multiplyKeyPromiseDispenser;
-
   std::unique_ptr<
       RandomnessDispenser<BeaverTriple<Large_T>, BeaverInfo<Large_T>>>
       mrd_key;
 
-  std::unique_ptr<Promise<
-      FF_TYPES,
-      RandomnessDispenser<BeaverTriple<Boolean_t>, BooleanBeaverInfo>>>
-      XORMultiplyPromiseDispenser;
-
   std::unique_ptr<
       RandomnessDispenser<BeaverTriple<Boolean_t>, BooleanBeaverInfo>>
       XORmrd;
 
-  std::unique_ptr<Promise<
-      FF_TYPES,
-      RandomnessDispenser<WaksmanBits<Large_T>, WaksmanInfo<Large_T>>>>
-      waksmanPromiseDispenser;
+  std::unique_ptr<
+      RandomnessDispenser<WaksmanBits<Large_T>, WaksmanInfo<Large_T>>>
+      waksmanDispenser;
 
   const Identity_T * dealerIdentity;
+
+  /* Dealers sharing the Beaver triples and Waksman bits, of which
+   * dealerIdentity also deals the quicksort randomness. */
+  std::vector<Identity_T> dealers;
 };
 
 #include <mpc/SISOSort.t.h>
@@ -18,14 +18,16 @@ SISOSort<FF_TYPES, Large_T, Small_T>::SISOSort(
     ObservationList<Large_T> & sharedList,
     Large_T modulus,
     const Identity_T * revealer,
-    const Identity_T * dealerIdentity) :
+    const Identity_T * dealerIdentity,
+    std::vector<Identity_T> const & dealers) :
     sharedList(sharedList),
     modulus(modulus),
     keyModulus(modulus),
     revealer(revealer),
     beaverInfo(modulus),
     keyBeaverInfo(modulus),
-    dealerIdentity(dealerIdentity) {
+    dealerIdentity(dealerIdentity),
+    dealers(dealers) {
   this->setup();
 }
 
@@ -35,19 +37,25 @@ SISOSort<FF_TYPES, Large_T, Small_T>::SISOSort(
     Large_T modulus,
     Large_T keyModulus,
     const Identity_T * revealer,
-    const Identity_T * dealerIdentity) :
+    const Identity_T * dealerIdentity,
+    std::vector<Identity_T> const & dealers) :
     sharedList(sharedList),
     modulus(modulus),
     keyModulus(keyModulus),
     revealer(revealer),
     beaverInfo(modulus),
     keyBeaverInfo(keyModulus),
-    dealerIdentity(dealerIdentity) {
+    dealerIdentity(dealerIdentity),
+    dealers(dealers) {
   this->setup();
 }
 
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
 void SISOSort<FF_TYPES, Large_T, Small_T>::setup() {
+  if (this->dealers.empty()) {
+    this->dealers.push_back(*this->dealerIdentity);
+  }
+
   size_t list_size = this->sharedList.elements.size();
   this->d = static_cast<size_t>(std::ceil(
       std::log2(list_size))); // still assuming this is a power of 2
@@ -69,32 +77,8 @@ void SISOSort<FF_TYPES, Large_T, Small_T>::setup() {
   this->sqrtEll =
       static_cast<size_t>(std::sqrt(this->bitsPerPrime)) + 1;
 
-  this->lagrangePolynomialSet = std::vector<std::vector<Small_T>>();
-  this->lagrangePolynomialSet.reserve(
-      this->sqrtEll + this->bitsPerPrime / this->sqrtEll);
-
-  size_t block_size = this->sqrtEll;
-  while (block_size < this->bitsPerPrime) {
-    this->lagrangePolynomialSet.emplace_back(
-        computeLagrangeCoeffsForPrefixOr(
-            this->smallModulus, static_cast<Small_T>(block_size)));
-    //log_debug("block_size: %lu", block_size);
-    block_size += this->sqrtEll;
-  }
-  //log_debug("block_size: %lu", this->compareInfo.ell);
-  this->lagrangePolynomialSet.emplace_back(
-      computeLagrangeCoeffsForPrefixOr(
-          this->smallModulus,
-          static_cast<Small_T>(this->bitsPerPrime)));
-
-  block_size = 1;
-  while ((block_size - 1) < this->sqrtEll) {
-    //log_debug("block_size: %lu", block_size);
-    this->lagrangePolynomialSet.emplace_back(
-        computeLagrangeCoeffsForPrefixOr(
-            this->smallModulus, static_cast<Small_T>(block_size)));
-    block_size++;
-  }
+  this->lagrangePolynomialSet = cachedLagrangePolynomialSet(
+      this->bitsPerPrime, this->sqrtEll, this->smallModulus);
   log_debug("SISOSort Constructor successful");
 }
 
@@ -122,129 +106,114 @@ void SISOSort<FF_TYPES, Large_T, Small_T>::init() {
       (this->sharedList.numArithmeticPayloadCols); // for Waksman
   log_debug("BeaverTriplesNeeded: %zu", BeaverTriplesNeeded);
 
-  log_debug("HI");
-  std::unique_ptr<PromiseFronctocol<
-      FF_TYPES,
-      RandomnessDispenser<BeaverTriple<Large_T>, BeaverInfo<Large_T>>>>
-      multiplyPromiseDispenserGadget(new RandomnessPatron<
-                                     FF_TYPES,
-                                     BeaverTriple<Large_T>,
-                                     BeaverInfo<Large_T>>(
-          *dealerIdentity, BeaverTriplesNeeded, this->beaverInfo));
-  log_debug("HI");
-  this->multiplyPromiseDispenser = this->promise(
-      std::move(multiplyPromiseDispenserGadget), this->getPeers());
-  this->await(*this->multiplyPromiseDispenser);
-  log_debug("HI");
-}
-
-template<FF_TYPENAMES, typename Large_T, typename Small_T>
-void SISOSort<FF_TYPES, Large_T, Small_T>::handlePromise(
-    ff::Fronctocol<FF_TYPES> & f) {
-  log_debug("SISOSort handlePromise");
-  this->numPromisesRemaining--;
-  log_debug(
-      "numPromisesRemaining in SISOSort: %lu",
-      this->numPromisesRemaining);
-  switch (this->numPromisesRemaining) {
-    case (3): {
-      this->mrd = this->multiplyPromiseDispenser->getResult(f);
+  size_t BeaverTriplesKeyNeeded =
+      ((this->d - 1) * this->expandedListSize + 1) *
+      (this->sharedList.numKeyCols); // for Waksman
+  log_debug("BeaverTriplesKeyNeeded: %zu", BeaverTriplesKeyNeeded);
 
-      log_assert(this->mrd != nullptr);
+  size_t XORBeaverTriplesNeeded =
+      ((this->d - 1) * this->expandedListSize + 1) *
+      (this->sharedList.numXORPayloadCols + 1);
+  log_debug("XOR BeaverTriplesNeeded: %lu", XORBeaverTriplesNeeded);
 
-      size_t BeaverTriplesKeyNeeded =
-          ((this->d - 1) * this->expandedListSize + 1) *
-          (this->sharedList.numKeyCols); // for Waksman
-      log_debug("BeaverTriplesKeyNeeded: %zu", BeaverTriplesKeyNeeded);
+  /* The dealer invokes its houses in this same order. */
+  this->join.add(
+      *this,
+      std::unique_ptr<PromiseFronctocol<
+          FF_TYPES,
+          RandomnessDispenser<
+              BeaverTriple<Large_T>,
+              BeaverInfo<Large_T>>>>(
+          new ShardedRandomnessPatron<
+              FF_TYPES,
+              BeaverTriple<Large_T>,
+              BeaverInfo<Large_T>>(
+              this->dealers, BeaverTriplesNeeded, this->beaverInfo)),
+      this->getPeers(),
+      &this->mrd);
 
+  this->join.add(
+      *this,
       std::unique_ptr<PromiseFronctocol<
           FF_TYPES,
           RandomnessDispenser<
               BeaverTriple<Large_T>,
-              BeaverInfo<Large_T>>>>
-          multiplyPromiseDispenserGadget(new RandomnessPatron<
-                                         FF_TYPES,
-                                         BeaverTriple<Large_T>,
-                                         BeaverInfo<Large_T>>(
-              *dealerIdentity,
+              BeaverInfo<Large_T>>>>(
+          new ShardedRandomnessPatron<
+              FF_TYPES,
+              BeaverTriple<Large_T>,
+              BeaverInfo<Large_T>>(
+              this->dealers,
               BeaverTriplesKeyNeeded,
-              this->keyBeaverInfo));
-
-      this->multiplyKeyPromiseDispenser = this->promise(
-          std::move(multiplyPromiseDispenserGadget), this->getPeers());
-      this->await(*this->multiplyKeyPromiseDispenser);
-
-    } break;
-    case (2): {
-
-      this->mrd_key = this->multiplyKeyPromiseDispenser->getResult(f);
-
-      log_assert(this->mrd_key != nullptr);
-
-      size_t XORBeaverTriplesNeeded =
-          ((this->d - 1) * this->expandedListSize + 1) *
-          (this->sharedList.numXORPayloadCols + 1);
-      log_debug("XOR BeaverTriplesNeeded: %lu", XORBeaverTriplesNeeded);
+              this->keyBeaverInfo)),
+      this->getPeers(),
+      &this->mrd_key);
 
+  this->join.add(
+      *this,
       std::unique_ptr<PromiseFronctocol<
           FF_TYPES,
           RandomnessDispenser<
               BeaverTriple<Boolean_t>,
-              BooleanBeaverInfo>>>
-          multiplyPromiseDispenserGadget(new RandomnessPatron<
-                                         FF_TYPES,
-                                         BeaverTriple<Boolean_t>,
-                                         BooleanBeaverInfo>(
-              *dealerIdentity,
+              BooleanBeaverInfo>>>(
+          new ShardedRandomnessPatron<
+              FF_TYPES,
+              BeaverTriple<Boolean_t>,
+              BooleanBeaverInfo>(
+              this->dealers,
               XORBeaverTriplesNeeded,
-              BooleanBeaverInfo()));
-
-      this->XORMultiplyPromiseDispenser = this->promise(
-          std::move(multiplyPromiseDispenserGadget), this->getPeers());
-      this->await(*XORMultiplyPromiseDispenser);
-    } break;
-    case (1): {
-      this->XORmrd = this->XORMultiplyPromiseDispenser->getResult(f);
-      log_assert(this->XORmrd != nullptr);
+              BooleanBeaverInfo())),
+      this->getPeers(),
+      &this->XORmrd);
 
+  this->join.add(
+      *this,
       std::unique_ptr<PromiseFronctocol<
           FF_TYPES,
           RandomnessDispenser<
               WaksmanBits<Large_T>,
-              WaksmanInfo<Large_T>>>>
-          waksman_drg(new RandomnessPatron<
-                      FF_TYPES,
-                      WaksmanBits<Large_T>,
-                      WaksmanInfo<Large_T>>(
-              *dealerIdentity, 1, waksmanInfo));
-      this->waksmanPromiseDispenser =
-          this->promise(std::move(waksman_drg), this->getPeers());
-      this->await(*waksmanPromiseDispenser);
-    } break;
-    case (0): {
-      auto a = this->waksmanPromiseDispenser->getResult(f);
-      log_assert(a != nullptr);
-      auto b = a->get();
+              WaksmanInfo<Large_T>>>>(
+          new ShardedRandomnessPatron<
+              FF_TYPES,
+              WaksmanBits<Large_T>,
+              WaksmanInfo<Large_T>>(
+              this->dealers, 1, this->waksmanInfo)),
+      this->getPeers(),
+      &this->waksmanDispenser);
+}
 
-      std::unique_ptr<WaksmanShuffle<FF_TYPES, Large_T>> waksman(
-          new WaksmanShuffle<FF_TYPES, Large_T>(
-              this->sharedList,
-              this->modulus,
-              this->keyModulus,
-              b,
-              this->d,
-              std::move(this->mrd),
-              std::move(this->mrd_key),
-              std::move(this->XORmrd),
-              this->revealer));
-      PeerSet_T ps(this->getPeers());
-      ps.remove(*dealerIdentity);
-      this->invoke(std::move(waksman), ps);
-    } break;
-    default: {
-      log_error("unexpected num promises remaining");
-    }
+template<FF_TYPENAMES, typename Large_T, typename Small_T>
+void SISOSort<FF_TYPES, Large_T, Small_T>::handlePromise(
+    ff::Fronctocol<FF_TYPES> & f) {
+  log_debug("SISOSort handlePromise");
+  if (!this->join.collect(f)) {
+    log_error("SISOSort received an unexpected promise");
+    this->abort();
+    return;
+  }
+  log_debug(
+      "numPromisesRemaining in SISOSort: %lu", this->join.remaining());
+  if (!this->join.done()) {
+    return;
+  }
+
+  WaksmanBits<Large_T> swapBits = this->waksmanDispenser->get();
+  std::unique_ptr<WaksmanShuffle<FF_TYPES, Large_T>> waksman(
+      new WaksmanShuffle<FF_TYPES, Large_T>(
+          this->sharedList,
+          this->modulus,
+          this->keyModulus,
+          swapBits,
+          this->d,
+          std::move(this->mrd),
+          std::move(this->mrd_key),
+          std::move(this->XORmrd),
+          this->revealer));
+  PeerSet_T ps(this->getPeers());
+  for (Identity_T const & dealer : this->dealers) {
+    ps.remove(dealer);
   }
+  this->invoke(std::move(waksman), ps);
 }
 
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
@@ -277,7 +246,10 @@ void SISOSort<FF_TYPES, Large_T, Small_T>::handleComplete(
               revealer,
               dealerIdentity));
       log_debug("invoking");
-      this->invoke(std::move(quicksort), this->getPeers());
+      this->invoke(
+          std::move(quicksort),
+          shardPeers(
+              this->getPeers(), this->dealers, *this->dealerIdentity));
       this->state = awaitingQuicksort;
     } break;
     case (awaitingQuicksort): {
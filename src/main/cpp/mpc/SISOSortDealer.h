@@ -31,6 +31,13 @@
 namespace ff {
 namespace mpc {
 
+/**
+ * The SISOSortRandomnessHouse deals every type of randomness which
+ * SISOSort needs. Given a list of dealers, each of which runs a
+ * SISOSortRandomnessHouse with the same list, the Beaver triples and
+ * Waksman bits are sharded amongst them, while the dealerIdentity,
+ * which must be one of them, deals the quicksort randomness alone.
+ */
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
 class SISOSortRandomnessHouse : public Fronctocol<FF_TYPES> {
 public:
@@ -45,14 +52,18 @@ public:
       const size_t listSize,
       const Large_T modulus,
       const Identity_T * revealer,
-      const Identity_T * dealerIdentity);
+      const Identity_T * dealerIdentity,
+      std::vector<Identity_T> const & dealers =
+          std::vector<Identity_T>());
 
   SISOSortRandomnessHouse(
       const size_t listSize,
       const Large_T modulus,
       const Large_T keyModulus,
       const Identity_T * revealer,
-      const Identity_T * dealerIdentity);
+      const Identity_T * dealerIdentity,
+      std::vector<Identity_T> const & dealers =
+          std::vector<Identity_T>());
 
 private:
   const size_t listSize;
@@ -60,6 +71,7 @@ private:
   const Large_T keyModulus;
   const Identity_T * revealer;
   const Identity_T * dealerIdentity;
+  std::vector<Identity_T> dealers;
 
   size_t d;
   Small_T small_modulus;
@@ -69,7 +81,7 @@ private:
   std::vector<std::vector<Small_T>>
       emptyLagrangePolynomialSet; // dummy input to QuicksortHouse
 
-  size_t numSubDealers = 5;
+  size_t numSubDealers = 0;
 
   const size_t NULL_KEY_COUNT = 0; // dummy input to QuicksortHouse
 };
@@ -14,12 +14,14 @@ SISOSortRandomnessHouse<FF_TYPES, Large_T, Small_T>::
         const size_t listSize,
         const Large_T modulus,
         const Identity_T * revealer,
-        const Identity_T * dealerIdentity) :
+        const Identity_T * dealerIdentity,
+        std::vector<Identity_T> const & dealers) :
     listSize(listSize),
     modulus(modulus),
     keyModulus(modulus),
     revealer(revealer),
-    dealerIdentity(dealerIdentity) {
+    dealerIdentity(dealerIdentity),
+    dealers(dealers) {
 
   this->d = static_cast<size_t>(approxLog2(
       this->listSize)); // still assuming this is a power of 2
@@ -37,12 +39,14 @@ SISOSortRandomnessHouse<FF_TYPES, Large_T, Small_T>::
         const Large_T modulus,
         const Large_T keyModulus,
         const Identity_T * revealer,
-        const Identity_T * dealerIdentity) :
+        const Identity_T * dealerIdentity,
+        std::vector<Identity_T> const & dealers) :
     listSize(listSize),
     modulus(modulus),
     keyModulus(keyModulus),
     revealer(revealer),
-    dealerIdentity(dealerIdentity) {
+    dealerIdentity(dealerIdentity),
+    dealers(dealers) {
 
   this->d = static_cast<size_t>(approxLog2(
       this->listSize)); // still assuming this is a power of 2
@@ -56,35 +60,47 @@ SISOSortRandomnessHouse<FF_TYPES, Large_T, Small_T>::
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
 void SISOSortRandomnessHouse<FF_TYPES, Large_T, Small_T>::init() {
   log_debug("SISOSortRandomnessHouse init");
+  if (this->dealers.empty()) {
+    this->dealers.push_back(this->getSelf());
+  }
+  this->numSubDealers = 4;
 
-  std::unique_ptr<ff::Fronctocol<FF_TYPES>> rd3(new RandomnessHouse<
-                                                FF_TYPES,
-                                                BeaverTriple<Large_T>,
-                                                BeaverInfo<Large_T>>());
+  std::unique_ptr<ff::Fronctocol<FF_TYPES>> rd3(
+      new ShardedRandomnessHouse<
+          FF_TYPES,
+          BeaverTriple<Large_T>,
+          BeaverInfo<Large_T>>(this->dealers));
   this->invoke(std::move(rd3), this->getPeers());
 
   std::unique_ptr<ff::Fronctocol<FF_TYPES>> rd3b(
-      new RandomnessHouse<
+      new ShardedRandomnessHouse<
           FF_TYPES,
           BeaverTriple<Large_T>,
-          BeaverInfo<Large_T>>());
+          BeaverInfo<Large_T>>(this->dealers));
   this->invoke(std::move(rd3b), this->getPeers());
 
-  std::unique_ptr<ff::Fronctocol<FF_TYPES>> rd4(new RandomnessHouse<
-                                                FF_TYPES,
-                                                BeaverTriple<Boolean_t>,
-                                                BooleanBeaverInfo>());
+  std::unique_ptr<ff::Fronctocol<FF_TYPES>> rd4(
+      new ShardedRandomnessHouse<
+          FF_TYPES,
+          BeaverTriple<Boolean_t>,
+          BooleanBeaverInfo>(this->dealers));
 
   this->invoke(std::move(rd4), this->getPeers());
 
   std::unique_ptr<ff::Fronctocol<FF_TYPES>> rd2(
-      new RandomnessHouse<
+      new ShardedRandomnessHouse<
           FF_TYPES,
           WaksmanBits<Large_T>,
-          WaksmanInfo<Large_T>>());
+          WaksmanInfo<Large_T>>(this->dealers));
 
   this->invoke(std::move(rd2), this->getPeers());
 
+  if (this->dealers.size() > 1 &&
+      this->getSelf() != *this->dealerIdentity) {
+    return;
+  }
+  this->numSubDealers++;
+
   std::unique_ptr<Fronctocol<FF_TYPES>> rd(
       new QuicksortRandomnessHouse<FF_TYPES, Large_T, Small_T>(
           CompareInfo<Identity_T, Large_T, Small_T>(
@@ -96,7 +112,9 @@ void SISOSortRandomnessHouse<FF_TYPES, Large_T, Small_T>::init() {
               this->revealer),
           this->listSize,
           this->NULL_KEY_COUNT));
-  this->invoke(std::move(rd), this->getPeers());
+  this->invoke(
+      std::move(rd),
+      shardPeers(this->getPeers(), this->dealers, this->getSelf()));
 }
 
 template<FF_TYPENAMES, typename Large_T, typename Small_T>
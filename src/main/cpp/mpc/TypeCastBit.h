@@ -10,6 +10,7 @@
 /* C++ Headers */
 #include <cstdint>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -19,6 +20,7 @@
 #include <ff/Fronctocol.h>
 #include <ff/Message.h>
 #include <mpc/Multiply.h>
+#include <mpc/PackedRandomness.h>
 #include <mpc/Randomness.h>
 #include <mpc/Reveal.h>
 #include <mpc/templates.h>
@@ -86,6 +88,48 @@ struct TypeCastInfo {
   TypeCastInfo<Number_T>() = default;
 };
 
+/**
+ * Packs a TypeCastTriple of an integral modulus, for either kind of
+ * info, to two fields of packedWidth(modulus) bits and the bit r_2.
+ */
+template<typename Number_T, typename Info_T>
+struct PackedTypeCastTriple {
+  static constexpr bool packed = true;
+
+  static size_t bits(Info_T const & info) {
+    return 2 * packedWidth(info.modulus) + 1;
+  }
+
+  static void pack(
+      BitWriter & writer,
+      Info_T const & info,
+      TypeCastTriple<Number_T> const & triple) {
+    size_t const width = packedWidth(info.modulus);
+    writer.write((uint64_t)triple.r_0, width);
+    writer.write((uint64_t)triple.r_1, width);
+    writer.write((uint64_t)triple.r_2, 1);
+  }
+
+  static void unpack(
+      BitReader & reader,
+      Info_T const & info,
+      TypeCastTriple<Number_T> & triple) {
+    size_t const width = packedWidth(info.modulus);
+    triple.r_0 = (Number_T)reader.read(width);
+    triple.r_1 = (Number_T)reader.read(width);
+    triple.r_2 = (Boolean_t)reader.read(1);
+  }
+};
+
+template<typename Number_T>
+struct PackedRandomness<
+    TypeCastTriple<Number_T>,
+    TypeCastInfo<Number_T>,
+    typename ::std::enable_if<
+        ::std::is_integral<Number_T>::value>::type>
+    : public PackedTypeCastTriple<Number_T, TypeCastInfo<Number_T>> {
+};
+
 template<FF_TYPENAMES, typename Number_T>
 class TypeCast : public Fronctocol<FF_TYPES> {
 public:
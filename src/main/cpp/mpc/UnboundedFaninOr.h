@@ -15,6 +15,8 @@
 /* C++ Headers */
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -24,6 +26,8 @@
 #include <ff/Fronctocol.h>
 #include <ff/Message.h>
 #include <mpc/Multiply.h>
+#include <mpc/Opening.h>
+#include <mpc/PackedRandomness.h>
 #include <mpc/Randomness.h>
 #include <mpc/Reveal.h>
 #include <mpc/templates.h>
@@ -77,13 +81,56 @@ struct ExponentSeriesInfo {
   ExponentSeriesInfo() = default;
 };
 
+/**
+ * The ell + 1 elements of an exponent series of an integral modulus
+ * pack to packedWidth(p) bits each, without the series' length.
+ */
+template<typename Number_T>
+struct PackedRandomness<
+    ExponentSeries<Number_T>,
+    ExponentSeriesInfo<Number_T>,
+    typename ::std::enable_if<
+        ::std::is_integral<Number_T>::value>::type> {
+  static constexpr bool packed = true;
+
+  static size_t bits(ExponentSeriesInfo<Number_T> const & info) {
+    return (info.ell + 1) * packedWidth(info.p);
+  }
+
+  static void pack(
+      BitWriter & writer,
+      ExponentSeriesInfo<Number_T> const & info,
+      ExponentSeries<Number_T> const & series) {
+    log_assert(series.size() == info.ell + 1);
+    size_t const width = packedWidth(info.p);
+    for (Number_T const & element : series) {
+      writer.write((uint64_t)element, width);
+    }
+  }
+
+  static void unpack(
+      BitReader & reader,
+      ExponentSeriesInfo<Number_T> const & info,
+      ExponentSeries<Number_T> & series) {
+    size_t const width = packedWidth(info.p);
+    series.resize(info.ell + 1);
+    for (Number_T & element : series) {
+      element = (Number_T)reader.read(width);
+    }
+  }
+};
+
 template<typename Identity_T, typename Number_T>
 struct UnboundedFaninOrInfo {
   Number_T const s;
   Identity_T const * const revealer;
+  Opening const opening;
 
-  UnboundedFaninOrInfo(Number_T const & s, Identity_T const * const r) :
-      s(s), revealer(r) {
+  UnboundedFaninOrInfo(
+      Number_T const & s,
+      Identity_T const * const r,
+      Opening const & o = Opening()) :
+      s(s), revealer(r), opening(o) {
   }
 };
 
@@ -139,6 +186,72 @@ private:
   MultiplyInfo<Identity_T, BeaverInfo<Number_T>> multInfo;
 };
 
+/**
+ * Computes many independent unbounded-fanin-ors in lock-step. The masked
+ * sums of all groups are multiplied and opened together, so the batch
+ * exchanges one message per peer per round regardless of the number of
+ * groups.
+ *
+ * The groups' ExponentSeries are copied into one contiguous buffer, and
+ * each group's Lagrange polynomial is evaluated against it with a Horner
+ * kernel.
+ */
+template<FF_TYPENAMES, typename Number_T>
+class BatchedUnboundedFaninOr : public Fronctocol<FF_TYPES> {
+public:
+  std::string name() override;
+
+  /* One result share per group, in the order groups were added. */
+  ::std::vector<Number_T> * const outputs;
+
+  UnboundedFaninOrInfo<Identity_T, Number_T> const * const info;
+
+  BatchedUnboundedFaninOr(
+      ::std::vector<Number_T> * const outs,
+      UnboundedFaninOrInfo<Identity_T, Number_T> const * const i);
+
+  /**
+   * Adds one group, the equivalent of one UnboundedFaninOr fronctocol.
+   * The lagrange polynomial is not copied, and must outlive this
+   * fronctocol.
+   */
+  void addGroup(
+      Number_T const & sumOfValues,
+      ExponentSeries<Number_T> && e,
+      BeaverTriple<Number_T> && b,
+      ::std::vector<Number_T> const & lgp);
+
+  size_t size() const {
+    return this->sumsOfValues.size();
+  }
+
+  void init() override;
+
+  void handleReceive(IncomingMessage_T & imsg) override;
+
+  void handleComplete(ff::Fronctocol<FF_TYPES> & f) override;
+
+  void handlePromise(ff::Fronctocol<FF_TYPES> & fronctocol) override;
+
+private:
+  enum FaninState { multiply, reveal };
+  FaninState completedState = multiply;
+
+  ::std::vector<Number_T> sumsOfValues;
+  ::std::vector<BeaverTriple<Number_T>> beavers;
+  ::std::vector<::std::vector<Number_T> const *> lagrangePolynomials;
+
+  /* Group k's series is randomSeries[seriesOffsets[k]] up to, but not
+   * including, randomSeries[seriesOffsets[k + 1]]. The last element of
+   * each group's series is r^-1. */
+  ::std::vector<Number_T> randomSeries;
+  ::std::vector<size_t> seriesOffsets;
+
+  ::std::vector<Number_T> ATimesRinvShares;
+
+  MultiplyInfo<Identity_T, BeaverInfo<Number_T>> multInfo;
+};
+
 } // namespace mpc
 } // namespace ff
 
@@ -155,7 +155,7 @@ UnboundedFaninOr<FF_TYPES, Number_T>::UnboundedFaninOr(
     beaver(::std::move(b)),
     lagrangePolynomial(lgp),
     info(i),
-    multInfo(i->revealer, BeaverInfo<Number_T>(i->s)) {
+    multInfo(i->revealer, BeaverInfo<Number_T>(i->s), i->opening) {
 }
 
 template<FF_TYPENAMES, typename Number_T>
@@ -211,7 +211,8 @@ void UnboundedFaninOr<FF_TYPES, Number_T>::handleComplete(
           new Reveal<FF_TYPES, Number_T>(
               this->ATimesRinvShare,
               this->info->s,
-              this->info->revealer));
+              this->info->revealer,
+              this->info->opening));
 
       this->invoke(std::move(rf), this->getPeers());
       this->completedState = reveal;
@@ -261,5 +262,140 @@ void UnboundedFaninOr<FF_TYPES, Number_T>::handleComplete(
   }
 }
 
+template<FF_TYPENAMES, typename Number_T>
+std::string BatchedUnboundedFaninOr<FF_TYPES, Number_T>::name() {
+  return std::string("Batched Unbounded Fanin Or size: ") +
+      std::to_string(this->size()) + " small mod: " + dec(this->info->s);
+}
+
+template<FF_TYPENAMES, typename Number_T>
+BatchedUnboundedFaninOr<FF_TYPES, Number_T>::BatchedUnboundedFaninOr(
+    ::std::vector<Number_T> * const outs,
+    UnboundedFaninOrInfo<Identity_T, Number_T> const * const i) :
+    outputs(outs),
+    info(i),
+    seriesOffsets(1, 0),
+    multInfo(i->revealer, BeaverInfo<Number_T>(i->s), i->opening) {
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedUnboundedFaninOr<FF_TYPES, Number_T>::addGroup(
+    Number_T const & sumOfValues,
+    ExponentSeries<Number_T> && e,
+    BeaverTriple<Number_T> && b,
+    ::std::vector<Number_T> const & lgp) {
+  log_assert(e.size() >= lgp.size());
+
+  this->sumsOfValues.emplace_back(sumOfValues);
+  this->beavers.emplace_back(::std::move(b));
+  this->lagrangePolynomials.emplace_back(&lgp);
+
+  for (Number_T & r_pow : e) {
+    this->randomSeries.emplace_back(::std::move(r_pow));
+  }
+  this->seriesOffsets.emplace_back(this->randomSeries.size());
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedUnboundedFaninOr<FF_TYPES, Number_T>::init() {
+  log_debug("BatchedUnboundedFaninOr init, size %zu", this->size());
+
+  ::std::vector<Number_T> as(this->sumsOfValues.size());
+  ::std::vector<Number_T> rinvs(this->sumsOfValues.size());
+  bool const is_revealer = *this->info->revealer == this->getSelf();
+  for (size_t k = 0; k < this->sumsOfValues.size(); k++) {
+    as[k] = this->sumsOfValues[k];
+    if (is_revealer) {
+      as[k] = modAdd(as[k], Number_T(1), this->info->s);
+    }
+    rinvs[k] = this->randomSeries[this->seriesOffsets[k + 1] - 1];
+  }
+
+  std::unique_ptr<
+      BatchedMultiply<FF_TYPES, Number_T, BeaverInfo<Number_T>>>
+      mf(new BatchedMultiply<FF_TYPES, Number_T, BeaverInfo<Number_T>>(
+          ::std::move(as),
+          ::std::move(rinvs),
+          &this->ATimesRinvShares,
+          ::std::move(this->beavers),
+          &this->multInfo));
+
+  this->invoke(::std::move(mf), this->getPeers());
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedUnboundedFaninOr<FF_TYPES, Number_T>::handleReceive(
+    IncomingMessage_T &) {
+  log_error("Unexpected handleReceive in BatchedUnboundedFaninOr");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedUnboundedFaninOr<FF_TYPES, Number_T>::handlePromise(
+    ff::Fronctocol<FF_TYPES> &) {
+  log_error("Unexpected handlePromise in BatchedUnboundedFaninOr");
+  this->abort();
+}
+
+template<FF_TYPENAMES, typename Number_T>
+void BatchedUnboundedFaninOr<FF_TYPES, Number_T>::handleComplete(
+    ff::Fronctocol<FF_TYPES> & f) {
+  switch (this->completedState) {
+    case multiply: {
+      log_debug("Case multiply");
+      std::unique_ptr<BatchedReveal<FF_TYPES, Number_T>> rf(
+          new BatchedReveal<FF_TYPES, Number_T>(
+              ::std::move(this->ATimesRinvShares),
+              this->info->s,
+              this->info->revealer,
+              this->info->opening));
+
+      this->invoke(std::move(rf), this->getPeers());
+      this->completedState = reveal;
+    } break;
+    case reveal: {
+      log_debug("Case reveal");
+      ::std::vector<Number_T> const & A_times_rinvs =
+          static_cast<BatchedReveal<FF_TYPES, Number_T> &>(f)
+              .openedValues;
+
+      Number_T const & s = this->info->s;
+      bool const is_revealer = *this->info->revealer == this->getSelf();
+
+      this->outputs->resize(this->size());
+      for (size_t k = 0; k < this->size(); k++) {
+        ::std::vector<Number_T> const & lgp =
+            *this->lagrangePolynomials[k];
+        Number_T const * const r_pows =
+            this->randomSeries.data() + this->seriesOffsets[k];
+        Number_T const & x = A_times_rinvs[k];
+
+        /*
+         * The share of f(A) is the sum over i of lgp[i] * x^i * [r^i],
+         * which is a polynomial in the public x with local coefficients
+         * lgp[i] * [r^i]. The constant term lgp[0] is held only by the
+         * revealer.
+         */
+        Number_T eval = 0;
+        for (size_t i = lgp.size() - 1; i > 0; i--) {
+          eval = modAdd(
+              modMul(eval, x, s), modMul(lgp[i], r_pows[i - 1], s), s);
+        }
+        eval = modMul(eval, x, s);
+        if (is_revealer) {
+          eval = modAdd(eval, lgp[0], s);
+        }
+
+        (*this->outputs)[k] = eval;
+      }
+
+      this->complete();
+    } break;
+    default:
+      log_error(
+          "BatchedUnboundedFaninOr state machine in unexpected state");
+  }
+}
+
 } // namespace mpc
 } // namespace ff
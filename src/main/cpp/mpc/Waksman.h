@@ -22,6 +22,7 @@
 #include <mpc/Batch.h>
 #include <mpc/Multiply.h>
 #include <mpc/ObservationList.h>
+#include <mpc/PackedRandomness.h>
 #include <mpc/Randomness.h>
 #include <mpc/Reveal.h>
 #include <mpc/templates.h>
@@ -99,6 +100,59 @@ struct WaksmanInfo {
   WaksmanInfo() = default;
 };
 
+/**
+ * Waksman bits pack to packedWidth(p) and packedWidth(keyModulus) bits
+ * for each arithmetic share, and a whole byte for each XOR share, as
+ * those are random bytes. The length of the shares is left out.
+ */
+template<typename Number_T>
+struct PackedRandomness<WaksmanBits<Number_T>, WaksmanInfo<Number_T>> {
+  static constexpr bool packed = true;
+
+  static size_t bits(WaksmanInfo<Number_T> const & info) {
+    return info.w_of_n *
+        (packedWidth(info.p) + packedWidth(info.keyModulus) + 8);
+  }
+
+  static void pack(
+      BitWriter & writer,
+      WaksmanInfo<Number_T> const & info,
+      WaksmanBits<Number_T> const & bits) {
+    log_assert(bits.arithmeticBitShares.size() == info.w_of_n);
+    size_t const width = packedWidth(info.p);
+    for (Number_T const & share : bits.arithmeticBitShares) {
+      packNumber(writer, share, width);
+    }
+    size_t const key_width = packedWidth(info.keyModulus);
+    for (Number_T const & share : bits.keyBitShares) {
+      packNumber(writer, share, key_width);
+    }
+    for (Boolean_t const share : bits.XORBitShares) {
+      writer.write((uint64_t)share, 8);
+    }
+  }
+
+  static void unpack(
+      BitReader & reader,
+      WaksmanInfo<Number_T> const & info,
+      WaksmanBits<Number_T> & bits) {
+    size_t const width = packedWidth(info.p);
+    bits.arithmeticBitShares.resize(info.w_of_n);
+    for (Number_T & share : bits.arithmeticBitShares) {
+      unpackNumber(reader, share, width);
+    }
+    size_t const key_width = packedWidth(info.keyModulus);
+    bits.keyBitShares.resize(info.w_of_n);
+    for (Number_T & share : bits.keyBitShares) {
+      unpackNumber(reader, share, key_width);
+    }
+    bits.XORBitShares.resize(info.w_of_n);
+    for (Boolean_t & share : bits.XORBitShares) {
+      share = (Boolean_t)reader.read(8);
+    }
+  }
+};
+
 template<FF_TYPENAMES, typename Number_T>
 class WaksmanShuffle : public Fronctocol<FF_TYPES> {
 public:
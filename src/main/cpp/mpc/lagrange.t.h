@@ -10,18 +10,6 @@
 namespace ff {
 namespace mpc {
 
-template<typename Number_T>
-void divideByDegreeOnePolynomial(
-    std::vector<Number_T> & coeffs,
-    std::vector<Number_T> & overwritten_output,
-    Number_T const & s,
-    Number_T const & a,
-    Number_T const & ell); // divides by (x-a) mod s
-
-template<typename Number_T>
-Number_T multiplyDifferentXValues(
-    Number_T const & s, Number_T const & ell, Number_T const & i);
-
 template<typename Number_T>
 std::vector<Number_T> computeLagrangeCoeffsForPrefixOr(
     Number_T const & s, Number_T const & ell) {
@@ -30,28 +18,48 @@ std::vector<Number_T> computeLagrangeCoeffsForPrefixOr(
   return ret;
 }
 
+/*
+ * Since f(2) = f(3) = ... = f(ell+1) = 1 and f(1) = 0,
+ *
+ *   f(x) = 1 - prod_{i=2}^{ell+1} (x - i) / prod_{i=2}^{ell+1} (1 - i)
+ *
+ * so the coefficients are those of a single product polynomial, scaled
+ * once. This needs one modular inversion instead of one per point.
+ */
 template<typename Number_T>
 void computeLagrangeCoeffsForPrefixOr(
     Number_T const & s,
     Number_T const & ell,
     std::vector<Number_T> & coeffs_to_return) {
-  coeffs_to_return = std::vector<Number_T>((size_t)ell + 1, 0);
+  size_t const degree = static_cast<size_t>(ell);
+  coeffs_to_return = std::vector<Number_T>(degree + 1, 0);
+  coeffs_to_return[0] = 1;
+
+  Number_T denominator = 1;
+  Number_T i = 2;
+  for (size_t k = 0; k < degree; k++, i++) {
+    Number_T const minus_i = modSub(Number_T(0), i % s, s);
+
+    // multiply the degree k product by (x - i)
+    coeffs_to_return[k + 1] = coeffs_to_return[k];
+    for (size_t j = k; j > 0; j--) {
+      coeffs_to_return[j] = modAdd(
+          coeffs_to_return[j - 1],
+          modMul(coeffs_to_return[j], minus_i, s),
+          s);
+    }
+    coeffs_to_return[0] = modMul(coeffs_to_return[0], minus_i, s);
 
-  std::vector<Number_T> coeffs_of_product;
-  computeProductOneToEllPlusOne(s, ell, coeffs_of_product);
-  std::vector<Number_T> intermediate_term(
-      static_cast<size_t>(ell + 1), 0);
+    denominator =
+        modMul(denominator, modSub(Number_T(1), i % s, s), s);
+  }
 
-  for (Number_T i = 2; i < ell + 2; i++) {
-    divideByDegreeOnePolynomial(
-        coeffs_of_product, intermediate_term, s, i, ell);
-    polyMultByScalar(
-        intermediate_term,
-        modInvert(multiplyDifferentXValues(s, ell, i), s),
-        s,
-        ell);
-    polyAdd(coeffs_to_return, intermediate_term, s, ell);
+  Number_T const scale =
+      modSub(Number_T(0), modInvert(denominator, s), s);
+  for (size_t j = 0; j < degree + 1; j++) {
+    coeffs_to_return[j] = modMul(coeffs_to_return[j], scale, s);
   }
+  coeffs_to_return[0] = modAdd(coeffs_to_return[0], Number_T(1), s);
 }
 
 template<typename Number_T>
@@ -76,23 +84,6 @@ void computeProductOneToEllPlusOne(
   }
 }
 
-/*
-Divides by (x-a)
-*/
-template<typename Number_T>
-void divideByDegreeOnePolynomial(
-    std::vector<Number_T> & coeffs,
-    std::vector<Number_T> & output,
-    Number_T const & s,
-    Number_T const & a,
-    Number_T const & ell) {
-  output[static_cast<size_t>(ell)] = 1;
-  for (size_t i = static_cast<size_t>(ell - 1); i + 1 != 0; i--) {
-    output[i] = coeffs[i + 1] + a * output[i + 1];
-    output[i] %= s;
-  }
-}
-
 template<typename Number_T>
 void polyAdd(
     std::vector<Number_T> & left_term,
@@ -115,19 +106,5 @@ void polyMultByScalar(
   }
 }
 
-template<typename Number_T>
-Number_T multiplyDifferentXValues(
-    Number_T const & s, Number_T const & ell, Number_T const & a) {
-  Number_T product = 1;
-
-  for (Number_T i = 1; i < ell + 2; i++) {
-    if (i != a) {
-      product = (product * ((s + a - i) % s)) % s;
-    }
-  }
-
-  return product;
-}
-
 } // namespace mpc
 } // namespace ff
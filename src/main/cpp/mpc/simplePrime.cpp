@@ -2,10 +2,15 @@
  * Copyright Stealth Software Technologies, Inc.
  */
 
+#include <cstdint>
+#include <vector>
+
+#include <mpc/ModUtils.h>
 #include <mpc/simplePrime.h>
 #include <mpc/templates.h>
 
 #include <openssl/bn.h>
+#include <openssl/opensslv.h>
 #include <sst/catalog/bignum.hpp>
 
 #include <ff/logging.h>
@@ -13,13 +18,123 @@
 namespace ff {
 namespace mpc {
 
+namespace {
+
+uint64_t powMod(uint64_t base, uint64_t exp, uint64_t const mod) {
+  uint64_t result = 1;
+  base %= mod;
+  while (exp > 0) {
+    if (exp & 1) {
+      result = modMul<uint64_t>(result, base, mod);
+    }
+    base = modMul<uint64_t>(base, base, mod);
+    exp >>= 1;
+  }
+  return result;
+}
+
+/**
+ * Miller-Rabin, which is deterministic for the given bases when value
+ * is below the bound associated with those bases.
+ */
+bool millerRabin(
+    uint64_t const value, std::vector<uint64_t> const & bases) {
+  if (value < 2) {
+    return false;
+  }
+  for (uint64_t const p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37}) {
+    if (value % p == 0) {
+      return value == p;
+    }
+  }
+
+  uint64_t d = value - 1;
+  size_t r = 0;
+  while ((d & 1) == 0) {
+    d >>= 1;
+    r++;
+  }
+
+  for (uint64_t const base : bases) {
+    uint64_t a = base % value;
+    if (a == 0) {
+      continue;
+    }
+
+    uint64_t x = powMod(a, d, value);
+    if (x == 1 || x == value - 1) {
+      continue;
+    }
+
+    bool witness = true;
+    for (size_t i = 1; i < r; i++) {
+      x = modMul<uint64_t>(x, x, value);
+      if (x == value - 1) {
+        witness = false;
+        break;
+      }
+    }
+    if (witness) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // namespace
+
+template<>
+bool isPrime<uint32_t>(uint32_t value) {
+  // deterministic below 4,759,123,141
+  static std::vector<uint64_t> const bases = {2, 7, 61};
+  return millerRabin(value, bases);
+}
+
+template<>
+bool isPrime<uint64_t>(uint64_t value) {
+  // deterministic below 2^64
+  static std::vector<uint64_t> const bases = {
+      2, 325, 9375, 28178, 450775, 9780504, 1795265022};
+  return millerRabin(value, bases);
+}
+
 template<>
 bool isPrime<LargeNum>(LargeNum value) {
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  return (
+      BN_check_prime(value.peek(), sst::bignum::ctx(), nullptr) == 1);
+#else
   return (
       BN_is_prime_ex(
           value.peek(), BN_prime_checks, sst::bignum::ctx(), nullptr) ==
       1);
+#endif
+}
+
+template<>
+uint32_t smallResidue<LargeNum>(LargeNum const & value, uint32_t modulus) {
+  return static_cast<uint32_t>(
+      BN_mod_word(value.peek(), static_cast<BN_ULONG>(modulus)));
+}
+
+std::vector<uint32_t> const & smallSievingPrimes() {
+  static std::vector<uint32_t> const primes = []() {
+    uint32_t const limit = 4096;
+    std::vector<bool> sieve(limit, true);
+    std::vector<uint32_t> ret;
+    for (uint32_t i = 3; i < limit; i += 2) {
+      if (sieve[i]) {
+        ret.push_back(i);
+        for (uint32_t j = i * i; j < limit; j += 2 * i) {
+          sieve[j] = false;
+        }
+      }
+    }
+    return ret;
+  }();
+  return primes;
 }
 
 } // namespace mpc
-} // namespace ff
\ No newline at end of file
+} // namespace ff
@@ -8,6 +8,9 @@
 /* C and POSIX Headers */
 
 /* C++ Headers */
+#include <algorithm>
+#include <cstdint>
+#include <vector>
 
 /* 3rd Party Headers */
 
@@ -21,15 +24,46 @@
 namespace ff {
 namespace mpc {
 
+/**
+ * Primality test. The generic version uses trial division, while
+ * uint32_t and uint64_t use deterministic Miller-Rabin and LargeNum
+ * uses OpenSSL.
+ */
 template<typename Number_T>
 bool isPrime(Number_T value);
 
+/**
+ * Finds the smallest odd prime greater than or equal to value, so
+ * values up to 3 give 3. Candidates are sieved in windows by the small
+ * primes, and only the survivors are tested with isPrime.
+ */
 template<typename Number_T>
 Number_T nextPrime(Number_T value);
 
+template<>
+bool isPrime(uint32_t value);
+
+template<>
+bool isPrime(uint64_t value);
+
 template<>
 bool isPrime(LargeNum value);
 
+/**
+ * Returns value mod a small modulus, for sieving in nextPrime.
+ */
+template<typename Number_T>
+uint32_t smallResidue(Number_T const & value, uint32_t modulus);
+
+template<>
+uint32_t smallResidue(LargeNum const & value, uint32_t modulus);
+
+/**
+ * The odd primes used by nextPrime to sieve candidates, in increasing
+ * order. Computed once.
+ */
+std::vector<uint32_t> const & smallSievingPrimes();
+
 } // namespace mpc
 } // namespace ff
 
@@ -7,6 +7,9 @@ namespace mpc {
 
 template<typename Number_T>
 bool isPrime(Number_T value) {
+  if (value < Number_T(2)) {
+    return false;
+  }
   if (value % Number_T(2) == Number_T(0) && value != Number_T(2)) {
     return false;
   } else if (
@@ -26,16 +29,58 @@ bool isPrime(Number_T value) {
   return true;
 }
 
+template<typename Number_T>
+uint32_t smallResidue(Number_T const & value, uint32_t modulus) {
+  return static_cast<uint32_t>(value % Number_T(modulus));
+}
+
 template<typename Number_T>
 Number_T nextPrime(Number_T value) {
+  if (value <= Number_T(3)) {
+    return Number_T(3);
+  }
   if (value % Number_T(2) == Number_T(0)) {
-    return (nextPrime<Number_T>(value + Number_T(1)));
+    value += Number_T(1);
+  }
+
+  std::vector<uint32_t> const & primes = smallSievingPrimes();
+
+  // The sieve would discard the sieving primes themselves.
+  if (value <= Number_T(primes.back())) {
+    while (!isPrime<Number_T>(value)) {
+      value += Number_T(2);
+    }
+    return value;
   }
-  while (!isPrime<Number_T>(value)) {
-    log_debug("Testing value %s", dec(value).c_str());
-    value += Number_T(2);
+
+  // composite[k] refers to the candidate value + 2k.
+  size_t const window = 1024;
+  std::vector<bool> composite(window);
+  while (true) {
+    std::fill(composite.begin(), composite.end(), false);
+
+    for (uint32_t const p : primes) {
+      // smallest k such that value + 2k = 0 (mod p)
+      uint64_t const r = smallResidue<Number_T>(value, p);
+      size_t k = static_cast<size_t>(
+          ((p - r) % p) * (uint64_t)((p + 1) / 2) % p);
+      for (; k < window; k += p) {
+        composite[k] = true;
+      }
+    }
+
+    for (size_t k = 0; k < window; k++) {
+      if (!composite[k]) {
+        Number_T candidate = value + Number_T(2 * k);
+        log_debug("Testing value %s", dec(candidate).c_str());
+        if (isPrime<Number_T>(candidate)) {
+          return candidate;
+        }
+      }
+    }
+
+    value += Number_T(2 * window);
   }
-  return value;
 }
 
 } // namespace mpc
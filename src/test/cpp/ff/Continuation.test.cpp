@@ -0,0 +1,220 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+/* 3rd Party Headers */
+#include <gtest/gtest.h>
+
+/* Fortissimo Headers */
+#include <mock.h>
+
+#include <ff/Continuation.h>
+
+/* Logging config */
+#include <ff/logging.h>
+
+namespace continuation {
+
+/**
+ * Sends a value to the other party and reads theirs back.
+ */
+class Echo : public ContinuationFronctocol {
+public:
+  uint32_t const myVal;
+  uint32_t peerVal = 0;
+
+  Echo(uint32_t myVal) : myVal(myVal) {
+  }
+
+  std::string name() override {
+    return std::string("Echo");
+  }
+
+  void init() override {
+    this->getPeers().forEach([this](std::string const & peer) {
+      if (peer == this->getSelf()) {
+        return;
+      }
+
+      std::unique_ptr<OutgoingMessage> omsg(new OutgoingMessage(peer));
+      omsg->write<uint32_t>(this->myVal);
+      this->send(std::move(omsg));
+
+      this->receiveThen(peer, [this](Message_T & msg) {
+        msg.read<uint32_t>(this->peerVal);
+        this->complete();
+      });
+    });
+  }
+};
+
+class Square : public PromiseFronctocol<uint32_t> {
+public:
+  uint32_t const x;
+
+  Square(uint32_t x) : x(x) {
+  }
+
+  std::string name() override {
+    return std::string("Square");
+  }
+
+  void init() override {
+    this->result.reset(new uint32_t(this->x * this->x));
+    this->complete();
+  }
+
+  void handleReceive(IncomingMessage &) override {
+    log_error("Square received an unexpected message");
+  }
+  void handleComplete(Fronctocol &) override {
+    log_error("Square received an unexpected complete");
+  }
+  void handlePromise(Fronctocol &) override {
+    log_error("Square received an unexpected promise");
+  }
+};
+
+/**
+ * Sends two values up front, but only reads them after a child and a
+ * promise have finished, so that both wait in the buffer.
+ */
+class Chain : public ContinuationFronctocol {
+public:
+  uint32_t const myVal;
+  std::string peer;
+
+  uint32_t echoed = 0;
+  uint32_t first = 0;
+  uint32_t second = 0;
+  uint32_t squared = 0;
+  size_t waitingAtEnd = 1;
+
+  Chain(uint32_t myVal) : myVal(myVal) {
+  }
+
+  std::string name() override {
+    return std::string("Chain");
+  }
+
+  void init() override {
+    this->getPeers().forEach([this](std::string const & p) {
+      if (p != this->getSelf()) {
+        this->peer = p;
+      }
+    });
+
+    for (uint32_t v : {this->myVal, 10 * this->myVal}) {
+      std::unique_ptr<OutgoingMessage> omsg(
+          new OutgoingMessage(this->peer));
+      omsg->write<uint32_t>(v);
+      this->send(std::move(omsg));
+    }
+
+    std::unique_ptr<Echo> echo(new Echo(this->myVal + 1));
+    this->invokeThen(
+        std::move(echo), this->getPeers(), [this](Echo & e) {
+          this->echoed = e.peerVal;
+
+          std::unique_ptr<PromiseFronctocol<uint32_t>> square(
+              new Square(this->echoed));
+          this->awaitThen(
+              this->promise(std::move(square), this->getPeers()),
+              [this](std::unique_ptr<uint32_t> result) {
+                this->squared = *result;
+                this->receiveBoth();
+              });
+        });
+  }
+
+private:
+  void receiveBoth() {
+    this->receiveThen(this->peer, [this](Message_T & msg) {
+      msg.read<uint32_t>(this->first);
+    });
+    this->receiveThen(this->peer, [this](Message_T & msg) {
+      msg.read<uint32_t>(this->second);
+      this->waitingAtEnd = this->numWaiting();
+      this->complete();
+    });
+  }
+};
+
+/**
+ * Sends a value to the other party, but completes without reading
+ * theirs, which is left in the buffer.
+ */
+class Unread : public ContinuationFronctocol {
+public:
+  std::string name() override {
+    return std::string("Unread");
+  }
+
+  void init() override {
+    this->getPeers().forEach([this](std::string const & peer) {
+      if (peer == this->getSelf()) {
+        return;
+      }
+
+      std::unique_ptr<OutgoingMessage> omsg(new OutgoingMessage(peer));
+      omsg->write<uint32_t>(1);
+      this->send(std::move(omsg));
+
+      std::unique_ptr<Echo> echo(new Echo(2));
+      this->invokeThen(
+          std::move(echo), this->getPeers(), [this](Echo &) {
+            this->complete();
+          });
+    });
+  }
+};
+
+} // namespace continuation
+
+using continuation::Chain;
+using continuation::Unread;
+
+TEST(Continuation, chain) {
+  std::map<std::string, uint32_t> const values = {
+      {"alice", 3}, {"bob", 5}};
+
+  std::map<std::string, std::unique_ptr<Fronctocol>> tests;
+  std::map<std::string, Chain *> chains;
+  for (auto const & value : values) {
+    chains[value.first] = new Chain(value.second);
+    tests[value.first] =
+        std::unique_ptr<Fronctocol>(chains[value.first]);
+  }
+
+  EXPECT_TRUE(runTests(tests));
+
+  for (auto const & value : values) {
+    uint32_t const peerVal = values.at(
+        value.first == "alice" ? std::string("bob") :
+                                 std::string("alice"));
+    Chain const & chain = *chains[value.first];
+    EXPECT_EQ(peerVal + 1, chain.echoed);
+    EXPECT_EQ((peerVal + 1) * (peerVal + 1), chain.squared);
+    EXPECT_EQ(peerVal, chain.first);
+    EXPECT_EQ(10 * peerVal, chain.second);
+    EXPECT_EQ(0U, chain.waitingAtEnd);
+  }
+}
+
+TEST(Continuation, unreceivedMessageAborts) {
+  std::map<std::string, std::unique_ptr<Fronctocol>> tests;
+  for (char const * party : {"alice", "bob"}) {
+    tests[party] = std::unique_ptr<Fronctocol>(new Unread());
+  }
+
+  EXPECT_FALSE(runTests(tests));
+}
@@ -0,0 +1,75 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/* 3rd Party Headers */
+#include <gtest/gtest.h>
+
+/* Fortissimo Headers */
+#include <ff/Executor.h>
+
+TEST(Executor, post) {
+  std::atomic<size_t> count(0);
+  {
+    ff::Executor executor(4);
+    EXPECT_EQ(4, executor.numThreads());
+
+    // Tasks which post more tasks exercise the workers' own queues.
+    for (size_t i = 0; i < 100; i++) {
+      executor.post([&]() {
+        for (size_t j = 0; j < 10; j++) {
+          executor.post([&]() { count++; });
+        }
+        count++;
+      });
+    }
+  }
+  EXPECT_EQ(1100, count.load());
+}
+
+TEST(Executor, strand) {
+  size_t const num_strands = 8;
+  size_t const num_tasks = 1000;
+
+  std::vector<std::vector<size_t>> orders(num_strands);
+  std::atomic<size_t> running(0);
+  std::atomic<bool> overlapped(false);
+  {
+    ff::Executor executor(4);
+    std::vector<std::unique_ptr<ff::Executor::Strand>> strands;
+    for (size_t i = 0; i < num_strands; i++) {
+      strands.emplace_back(new ff::Executor::Strand(executor));
+    }
+
+    for (size_t j = 0; j < num_tasks; j++) {
+      for (size_t i = 0; i < num_strands; i++) {
+        std::vector<size_t> & order = orders[i];
+        strands[i]->post([&order, j]() { order.push_back(j); });
+      }
+      // Tasks of one strand never run at once.
+      strands[0]->post([&]() {
+        if (running++ != 0) {
+          overlapped = true;
+        }
+        running--;
+      });
+    }
+  }
+
+  EXPECT_FALSE(overlapped.load());
+  for (size_t i = 0; i < num_strands; i++) {
+    ASSERT_EQ(num_tasks, orders[i].size());
+    for (size_t j = 0; j < num_tasks; j++) {
+      EXPECT_EQ(j, orders[i][j]);
+    }
+  }
+}
@@ -0,0 +1,90 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+/* 3rd Party Headers */
+#include <gtest/gtest.h>
+
+/* Fortissimo Headers */
+#include <mock.h>
+
+#include <ff/Pool.h>
+
+using ff::Pool;
+using ff::Pools;
+
+TEST(Pool, takeAndGive) {
+  Pool<size_t> pool;
+  EXPECT_EQ(0, pool.size());
+
+  // An empty pool constructs new objects.
+  std::unique_ptr<size_t> a = pool.take(1);
+  std::unique_ptr<size_t> b = pool.take(2);
+  EXPECT_EQ(1, *a);
+  EXPECT_EQ(2, *b);
+
+  // Given objects are recycled as-is, most recent first.
+  size_t * b_addr = b.get();
+  pool.give(std::move(a));
+  pool.give(std::move(b));
+  pool.give(nullptr);
+  EXPECT_EQ(2, pool.size());
+
+  std::unique_ptr<size_t> c = pool.take(3);
+  EXPECT_EQ(b_addr, c.get());
+  EXPECT_EQ(2, *c);
+  EXPECT_EQ(1, pool.size());
+}
+
+TEST(Pool, poolsByType) {
+  Pools pools;
+
+  // Each type has its own Pool, which persists between calls.
+  pools.get<size_t>().give(std::unique_ptr<size_t>(new size_t(1)));
+  EXPECT_EQ(1, pools.get<size_t>().size());
+  EXPECT_EQ(0, pools.get<std::string>().size());
+  EXPECT_EQ(&pools.get<size_t>(), &pools.get<size_t>());
+}
+
+TEST(Pool, sharedByFronctocols) {
+  std::map<std::string, size_t *> given;
+  std::map<std::string, size_t *> taken;
+
+  std::map<std::string, std::unique_ptr<Fronctocol>> tests;
+  for (std::string const name : {"alice", "bob"}) {
+    tests[name] = std::unique_ptr<Fronctocol>(new Tester(
+        [&, name](Fronctocol * self) {
+          std::unique_ptr<size_t> obj(new size_t(7));
+          given[name] = obj.get();
+          self->getPool<size_t>().give(std::move(obj));
+
+          // The child takes what its parent gave.
+          std::unique_ptr<Fronctocol> child(new Tester(
+              [&, name](Fronctocol * child_self) {
+                taken[name] =
+                    child_self->getPool<size_t>().take(0).release();
+                child_self->complete();
+              },
+              failTestOnComplete));
+          self->invoke(std::move(child), self->getPeers());
+        },
+        [](Fronctocol &, Fronctocol * self) { self->complete(); }));
+  }
+
+  EXPECT_TRUE(runTests(tests));
+
+  EXPECT_EQ(2, given.size());
+  for (std::pair<std::string const, size_t *> const & g : given) {
+    EXPECT_EQ(g.second, taken[g.first]);
+    EXPECT_EQ(7, *taken[g.first]);
+    delete taken[g.first];
+  }
+}
@@ -0,0 +1,166 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+#include <cstdio>
+
+/* C++ Headers */
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* 3rd Party Headers */
+#include <gtest/gtest.h>
+
+/* Fortissimo Headers */
+#include <mock.h>
+
+#include <ff/Fronctocol.h>
+#include <ff/Profiler.h>
+
+/* Logging configuration */
+#include <ff/logging.h>
+
+class Echo : public Fronctocol {
+public:
+  std::string name() override {
+    return std::string("Echo");
+  }
+
+  void init() override {
+    this->getPeers().forEach([this](std::string const & peer) {
+      if (peer == this->getSelf()) {
+        return;
+      }
+
+      std::unique_ptr<OutgoingMessage> omsg(new OutgoingMessage(peer));
+      omsg->write<uint64_t>(1);
+      this->send(std::move(omsg));
+    });
+  }
+
+  void handleReceive(IncomingMessage & imsg) override {
+    uint64_t one;
+    imsg.read<uint64_t>(one);
+    this->complete();
+  }
+
+  void handleComplete(Fronctocol &) override {
+    log_error("Echo shouldn't have a complete");
+  }
+
+  void handlePromise(Fronctocol &) override {
+    log_error("Echo shouldn't have a promise");
+  }
+};
+
+class TwoEchoes : public Fronctocol {
+public:
+  std::string name() override {
+    return std::string("Two Echoes");
+  }
+
+  size_t remaining = 2;
+
+  void init() override {
+    for (size_t i = 0; i < this->remaining; i++) {
+      this->invoke(
+          std::unique_ptr<Fronctocol>(new Echo()), this->getPeers());
+    }
+  }
+
+  void handleReceive(IncomingMessage &) override {
+    log_error("Two Echoes shouldn't receive");
+  }
+
+  void handleComplete(Fronctocol &) override {
+    this->remaining--;
+    if (this->remaining == 0) {
+      this->complete();
+    }
+  }
+
+  void handlePromise(Fronctocol &) override {
+    log_error("Two Echoes shouldn't have a promise");
+  }
+};
+
+TEST(Profiler, runTests) {
+  std::map<std::string, std::unique_ptr<Fronctocol>> tests;
+  tests["alice"] = std::unique_ptr<Fronctocol>(new TwoEchoes());
+  tests["bob"] = std::unique_ptr<Fronctocol>(new TwoEchoes());
+
+  ff::tester::RunStats<std::string> stats;
+  stats.profile = true;
+  EXPECT_TRUE(runTests(tests, 1, &stats));
+  ASSERT_EQ(2, stats.profilers.size());
+
+  ff::Profiler const & alice = stats.profilers.find("alice")->second;
+  EXPECT_EQ(std::string("alice"), alice.getParticipant());
+
+  std::vector<ff::Profiler::Instance> const & instances =
+      alice.getInstances();
+  ASSERT_EQ(3, instances.size());
+  EXPECT_EQ(std::string("Two Echoes"), instances[0].name);
+  EXPECT_EQ(ff::Profiler::NONE, instances[0].parent);
+  EXPECT_EQ(0, instances[1].parent);
+  EXPECT_EQ(0, instances[2].parent);
+
+  std::map<std::string, ff::Profiler::Totals> const totals =
+      alice.byName();
+  ASSERT_EQ(1, totals.count("Echo"));
+  EXPECT_EQ(2, totals.at("Echo").instances);
+  // init and handleReceive of each echo.
+  EXPECT_EQ(4, totals.at("Echo").spans);
+  // init and a handleComplete for each echo.
+  EXPECT_EQ(3, totals.at("Two Echoes").spans);
+
+  // Every message alice sent belongs to some fronctocol.
+  ff::Profiler::Totals const all = alice.subtree(0);
+  EXPECT_EQ(3, all.instances);
+  EXPECT_EQ(7, all.spans);
+  EXPECT_EQ(stats.bytesBySender["alice"], all.bytes);
+  EXPECT_EQ(
+      totals.at("Echo").bytes + totals.at("Two Echoes").bytes,
+      all.bytes);
+
+  ff::Profiler::Totals const echo = alice.subtree(1);
+  EXPECT_EQ(1, echo.instances);
+  EXPECT_EQ(2, echo.spans);
+}
+
+TEST(Profiler, writeChromeTrace) {
+  ff::Profiler profiler("alice");
+  size_t const main = profiler.addInstance("Main", ff::Profiler::NONE);
+  size_t const child = profiler.addInstance("Child \"1\"", main);
+  {
+    ff::Profiler::Scope scope(
+        &profiler, child, ff::Profiler::SpanKind::receive);
+  }
+  {
+    ff::Profiler::Scope scope(
+        nullptr, main, ff::Profiler::SpanKind::init);
+  }
+  EXPECT_EQ(1, profiler.getSpans().size());
+
+  FILE * out = tmpfile();
+  ASSERT_NE(nullptr, out);
+  EXPECT_TRUE(ff::Profiler::writeChromeTrace(out, {&profiler}));
+
+  rewind(out);
+  std::string trace;
+  char buf[256];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), out)) > 0) {
+    trace.append(buf, n);
+  }
+  fclose(out);
+
+  EXPECT_EQ(0, trace.find("{\"traceEvents\": ["));
+  EXPECT_NE(std::string::npos, trace.find("\"Child \\\"1\\\"\""));
+  EXPECT_NE(std::string::npos, trace.find("\"cat\": \"receive\""));
+  EXPECT_NE(std::string::npos, trace.find("\"parent\": 0"));
+}
@@ -6,6 +6,7 @@
 
 /* C++ Headers */
 #include <cstdint>
+#include <vector>
 
 /* 3rd Party Headers */
 #include <gtest/gtest.h>
@@ -208,3 +209,44 @@ TEST(VectorPeerSet, findThings) {
     EXPECT_EQ((i % 2) == 0, vps.findCompletionStatus(i));
   }
 }
+
+TEST(VectorPeerSet, unorderedAddAndVisit) {
+  // Peers added out of order are still found, and visited in order.
+  VectorPeerSet<size_t> vps;
+  vps.add(5);
+  vps.add(1);
+  vps.add(3);
+  vps.add(0);
+
+  for (size_t i : std::vector<size_t>({0, 1, 3, 5})) {
+    EXPECT_TRUE(vps.hasPeer(i));
+  }
+  EXPECT_FALSE(vps.hasPeer(2));
+
+  std::vector<size_t> order;
+  vps.visitIdentities([&](size_t const & peer) { order.push_back(peer); });
+  EXPECT_EQ(std::vector<size_t>({0, 1, 3, 5}), order);
+
+  // Changes made through a visitor are reflected in the O(1) checks.
+  vps.visit([](size_t const &, fronctocolId_t & fid, bool & cs) {
+    fid = 7;
+    cs = true;
+  });
+  EXPECT_TRUE(vps.hasAllPeerIds());
+  EXPECT_TRUE(vps.checkAllComplete());
+
+  vps.add(2);
+  EXPECT_FALSE(vps.hasAllPeerIds());
+  EXPECT_FALSE(vps.checkAllComplete());
+
+  vps.remove(2);
+  EXPECT_TRUE(vps.hasAllPeerIds());
+  EXPECT_TRUE(vps.checkAllComplete());
+
+  // Assignment resets fronctocol IDs and completion status.
+  VectorPeerSet<size_t> vps2;
+  vps2 = vps;
+  EXPECT_TRUE(vps == vps2);
+  EXPECT_FALSE(vps2.hasAllPeerIds());
+  EXPECT_FALSE(vps2.checkAllComplete());
+}
@@ -1,9 +1,14 @@
 
 /* C and POSIX Headers */
+#include <cstdio>
 
 /* C++ Headers */
 #include <cerrno>
+#include <cstdint>
 #include <functional>
+#include <string>
+#include <thread>
+#include <vector>
 
 /* 3rd Party Headers */
 #include <gtest/gtest.h>
@@ -13,11 +18,134 @@
 #include <ff/logging.h>
 
 TEST(logging, logging) {
+  LogLevel const level = log_get_level();
+  log_set_level(LOG_LEVEL_TRACE);
   log_trace("trace logs are blue");
   log_debug("debug logs are magenta");
   log_info("info logs are cyan");
   log_warn("warn logs are orange");
   log_error("error logs are red");
+  log_set_level(level);
+}
+
+/* Reads everything written to a temporary LOG_FILE. */
+static std::string readLog(FILE * file) {
+  fflush(file);
+  rewind(file);
+  std::string contents;
+  char buf[256];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), file)) > 0) {
+    contents.append(buf, n);
+  }
+  return contents;
+}
+
+TEST(logging, runtimeLevel) {
+  FILE * const stderr_file = LOG_FILE;
+  LogLevel const level = log_get_level();
+  LOG_FILE = tmpfile();
+  ASSERT_NE(nullptr, LOG_FILE);
+
+  int evaluated = 0;
+  EXPECT_TRUE(log_set_level_name("WARN"));
+  EXPECT_EQ(LOG_LEVEL_WARN, log_get_level());
+  log_info("hidden %d", ++evaluated);
+  log_warn("shown %d", ++evaluated);
+  EXPECT_FALSE(log_set_level_name("verbose"));
+  EXPECT_EQ(LOG_LEVEL_WARN, log_get_level());
+
+  std::string const contents = readLog(LOG_FILE);
+  EXPECT_EQ(1, evaluated);
+  EXPECT_EQ(std::string::npos, contents.find("hidden"));
+  EXPECT_NE(std::string::npos, contents.find("shown 1"));
+
+  fclose(LOG_FILE);
+  LOG_FILE = stderr_file;
+  log_set_level(level);
+}
+
+TEST(logging, fileLevel) {
+  FILE * const stderr_file = LOG_FILE;
+  LogLevel const level = log_get_level();
+  LOG_FILE = tmpfile();
+  ASSERT_NE(nullptr, LOG_FILE);
+
+  // This file enables trace and debug, which print by default.
+  log_set_level(LOG_LEVEL_FILE);
+  log_trace("trace %d", 1);
+  log_debug("debug %d", 2);
+  log_set_level(LOG_LEVEL_INFO);
+  log_debug("hidden %d", 3);
+
+  std::string const contents = readLog(LOG_FILE);
+  EXPECT_NE(std::string::npos, contents.find("trace 1"));
+  EXPECT_NE(std::string::npos, contents.find("debug 2"));
+  EXPECT_EQ(std::string::npos, contents.find("hidden"));
+
+  fclose(LOG_FILE);
+  LOG_FILE = stderr_file;
+  log_set_level(level);
+}
+
+TEST(logging, async) {
+  FILE * const stderr_file = LOG_FILE;
+  LOG_FILE = tmpfile();
+  ASSERT_NE(nullptr, LOG_FILE);
+
+  log_async_start(4096);
+  std::string const temporary("copied");
+  int value = 7;
+  log_info(
+      "int=%d neg=%i size=%zu hex=%02hhx pct=%% dbl=%.2f str=%s "
+      "width=[%*d] ptr=%p",
+      -3,
+      -4,
+      (size_t)42,
+      (uint8_t)0xab,
+      1.5,
+      temporary.c_str(),
+      4,
+      9,
+      (void *)&value);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([t]() {
+      LOG_ORGANIZATION = "thread" + std::to_string(t);
+      for (int i = 0; i < 200; i++) {
+        log_info("line %d of %d", i, t);
+      }
+    });
+  }
+  for (std::thread & thread : threads) {
+    thread.join();
+  }
+  log_async_stop();
+
+  std::string const contents = readLog(LOG_FILE);
+  char ptr[32];
+  snprintf(ptr, sizeof(ptr), "%p", (void *)&value);
+  EXPECT_NE(
+      std::string::npos,
+      contents.find(
+          std::string("int=-3 neg=-4 size=42 hex=ab pct=% dbl=1.50 "
+                      "str=copied width=[   9] ptr=") +
+          ptr + "\n"));
+  EXPECT_NE(std::string::npos, contents.find("(thread2): "));
+  for (int t = 0; t < 4; t++) {
+    EXPECT_NE(
+        std::string::npos,
+        contents.find("line 199 of " + std::to_string(t) + "\n"));
+  }
+  size_t lines = 0;
+  for (char const c : contents) {
+    lines += c == '\n' ? 1 : 0;
+  }
+  EXPECT_EQ(801, lines);
+
+  fclose(LOG_FILE);
+  LOG_FILE = stderr_file;
 }
 
 TEST(logging, perror) {
@@ -0,0 +1,323 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+
+/* C++ Headers */
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/* 3rd Party Headers */
+#include <gtest/gtest.h>
+
+/* Fortissimo Headers */
+#include <mock.h>
+
+#include <ff/Executor.h>
+#include <ff/Fronctocol.h>
+#include <ff/posixnet/posixnet.h>
+
+/* Logging configuration */
+#include <ff/logging.h>
+
+class Hello : public Fronctocol {
+public:
+  std::string name() override {
+    return std::string("Hello");
+  }
+
+  void init() override {
+    this->getPeers().forEach([this](std::string const & peer) {
+      if (peer == this->getSelf()) {
+        return;
+      }
+
+      std::unique_ptr<OutgoingMessage> omsg(new OutgoingMessage(peer));
+      omsg->write<uint64_t>(1);
+      this->send(std::move(omsg));
+    });
+  }
+
+  void handleReceive(IncomingMessage & imsg) override {
+    uint64_t one;
+    imsg.read<uint64_t>(one);
+    this->complete();
+  }
+
+  void handleComplete(Fronctocol &) override {
+    log_error("Hello shouldn't have a complete");
+  }
+
+  void handlePromise(Fronctocol &) override {
+    log_error("Hello shouldn't have a promise");
+  }
+};
+
+/**
+ * Runs two compute tasks, each of which waits for the other to start,
+ * so that both see the other only if they run in parallel.
+ */
+class Overlap : public Fronctocol {
+public:
+  bool * const overlapped;
+
+  Overlap(bool * overlapped) : overlapped(overlapped) {
+  }
+
+  std::string name() override {
+    return std::string("Overlap");
+  }
+
+  void init() override {
+    for (size_t i = 0; i < 2; i++) {
+      this->compute(
+          [this, i]() {
+            this->running++;
+            std::chrono::steady_clock::time_point const deadline =
+                std::chrono::steady_clock::now() +
+                std::chrono::seconds(10);
+            while (this->running.load() < 2 &&
+                   std::chrono::steady_clock::now() < deadline) {
+              std::this_thread::yield();
+            }
+            this->sawOther[i] = this->running.load() == 2;
+          },
+          [this]() {
+            this->numComputed++;
+            if (this->numComputed == 2) {
+              *this->overlapped =
+                  this->sawOther[0] && this->sawOther[1];
+              this->complete();
+            }
+          });
+    }
+  }
+
+  void handleReceive(IncomingMessage &) override {
+    log_error("Overlap shouldn't have a message");
+  }
+
+  void handleComplete(Fronctocol &) override {
+    log_error("Overlap shouldn't have a complete");
+  }
+
+  void handlePromise(Fronctocol &) override {
+    log_error("Overlap shouldn't have a promise");
+  }
+
+private:
+  std::atomic<size_t> running{0};
+  bool sawOther[2] = {false, false};
+  size_t numComputed = 0;
+};
+
+static std::string readFile(std::string const & path) {
+  std::string contents;
+  FILE * file = fopen(path.c_str(), "r");
+  if (file == nullptr) {
+    return contents;
+  }
+  char buf[256];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), file)) > 0) {
+    contents.append(buf, n);
+  }
+  fclose(file);
+  return contents;
+}
+
+static std::vector<std::string> const identities = {"alice", "bob"};
+
+/**
+ * Finds a free port by binding to port 0.
+ */
+static uint16_t freePort() {
+  int const fd = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t length = sizeof(address);
+  uint16_t port = 0;
+  if (fd >= 0 &&
+      0 == bind(fd, (sockaddr *)&address, sizeof(address)) &&
+      0 == getsockname(fd, (sockaddr *)&address, &length)) {
+    port = ntohs(address.sin_port);
+  }
+  close(fd);
+  return port;
+}
+
+/**
+ * Peers on localhost, on free ports.
+ */
+static std::vector<ff::posixnet::PeerInfo<std::string>> localPeers() {
+  std::vector<ff::posixnet::PeerInfo<std::string>> peers(2);
+  for (size_t i = 0; i < peers.size(); i++) {
+    peers[i].identity = identities[i];
+    peers[i].address.ss_family = AF_INET;
+    sockaddr_in * address = (sockaddr_in *)&peers[i].address;
+    address->sin_port = htons(freePort());
+    inet_pton(AF_INET, "127.0.0.1", &address->sin_addr);
+  }
+  return peers;
+}
+
+TEST(posixnet, metrics) {
+  std::vector<ff::posixnet::PeerInfo<std::string>> const peers =
+      localPeers();
+
+  ff::posixnet::MetricsDump dump;
+  dump.path = ::testing::TempDir() + "posixnet_metrics_" +
+      std::to_string(getpid()) + ".prom";
+
+  ff::posixnet::Metrics<std::string> metrics[2];
+  bool success[2] = {false, false};
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < peers.size(); i++) {
+    threads.emplace_back([&, i]() {
+      success[i] = ff::posixnet::runFortissimoPosixNet<
+          std::string,
+          PeerSet>(
+          std::unique_ptr<Fronctocol>(new Hello()),
+          peers,
+          identities[i],
+          &metrics[i],
+          i == 0 ? &dump : nullptr);
+    });
+  }
+  for (std::thread & thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < 2; i++) {
+    EXPECT_TRUE(success[i]);
+    ASSERT_EQ(1, metrics[i].peers.size());
+    ff::posixnet::Metrics<std::string>::Peer const & peer =
+        metrics[i].peers.begin()->second;
+    EXPECT_EQ(identities[1 - i], metrics[i].peers.begin()->first);
+
+    // The payload and the complete message, but not the handshake.
+    EXPECT_EQ(2, peer.messagesReceived);
+    EXPECT_LE(2, peer.messagesSent);
+    EXPECT_LT(0, peer.bytesSent);
+    EXPECT_LE(1, peer.maxQueueDepth);
+    EXPECT_EQ(0, peer.queueDepth);
+    EXPECT_EQ(0, peer.queuedBytes);
+
+    EXPECT_LT(0, metrics[i].pollIterations);
+    EXPECT_EQ(1, metrics[i].fronctocols);
+    EXPECT_EQ(0, metrics[i].liveFronctocols);
+  }
+  // What one party receives, the other sent, aside from the identity
+  // handshake of bob, who connects to alice: a length, then "bob".
+  uint64_t const handshake = 8 + 4 + 3;
+  EXPECT_EQ(
+      metrics[0].peers["bob"].bytesSent,
+      metrics[1].peers["alice"].bytesReceived);
+  EXPECT_EQ(
+      metrics[1].peers["alice"].bytesSent,
+      metrics[0].peers["bob"].bytesReceived + handshake);
+
+  std::string const text = readFile(dump.path);
+  unlink(dump.path.c_str());
+  EXPECT_NE(
+      std::string::npos,
+      text.find("# TYPE ff_posixnet_sent_bytes_total counter\n"));
+  EXPECT_NE(
+      std::string::npos,
+      text.find("ff_posixnet_received_messages_total{self=\"alice\","
+                "peer=\"bob\"} 2\n"));
+  EXPECT_NE(
+      std::string::npos,
+      text.find("ff_fronctocols_live{self=\"alice\"} 0\n"));
+}
+
+static void runSessions(ff::Executor * const executor) {
+  std::vector<ff::posixnet::PeerInfo<std::string>> const peers =
+      localPeers();
+  size_t const num_sessions = 5;
+
+  std::map<ff::posixnet::sessionId_t, bool> results[2];
+  bool success[2] = {false, false};
+  size_t fronctocols[2] = {0, 0};
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < peers.size(); i++) {
+    threads.emplace_back([&, i]() {
+      ff::posixnet::SessionRunner<std::string, PeerSet> runner(
+          peers, identities[i], executor);
+
+      // Bob starts the sessions in the opposite order, so that some of
+      // alice's messages arrive before their session starts.
+      for (size_t j = 0; j < num_sessions; j++) {
+        ff::posixnet::sessionId_t const id =
+            i == 0 ? j : num_sessions - 1 - j;
+        runner.start(id, std::unique_ptr<Fronctocol>(new Hello()));
+      }
+      success[i] = runner.run();
+      results[i] = runner.takeResults();
+      fronctocols[i] = runner.getMetrics().fronctocols;
+      EXPECT_EQ(0, runner.numActive());
+    });
+  }
+  for (std::thread & thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < 2; i++) {
+    EXPECT_TRUE(success[i]);
+    EXPECT_EQ(num_sessions, results[i].size());
+    for (std::pair<ff::posixnet::sessionId_t const, bool> const &
+             result : results[i]) {
+      EXPECT_TRUE(result.second);
+    }
+    EXPECT_EQ(num_sessions, fronctocols[i]);
+  }
+}
+
+TEST(posixnet, sessions) {
+  runSessions(nullptr);
+}
+
+TEST(posixnet, sessionsOnExecutor) {
+  ff::Executor executor(4);
+  runSessions(&executor);
+}
+
+TEST(posixnet, computeOnExecutor) {
+  std::vector<ff::posixnet::PeerInfo<std::string>> const peers =
+      localPeers();
+
+  bool success[2] = {false, false};
+  bool overlapped[2] = {false, false};
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < peers.size(); i++) {
+    threads.emplace_back([&, i]() {
+      ff::Executor executor(2);
+      ff::posixnet::SessionRunner<std::string, PeerSet> runner(
+          peers, identities[i], &executor);
+      runner.start(
+          0, std::unique_ptr<Fronctocol>(new Overlap(&overlapped[i])));
+      success[i] = runner.run();
+    });
+  }
+  for (std::thread & thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < 2; i++) {
+    EXPECT_TRUE(success[i]);
+    EXPECT_TRUE(overlapped[i]);
+  }
+}
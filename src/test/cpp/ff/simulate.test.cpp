@@ -0,0 +1,149 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+/* 3rd Party Headers */
+#include <gtest/gtest.h>
+
+/* Fortissimo Headers */
+#include <mock.h>
+
+#include <ff/Fronctocol.h>
+#include <ff/tester/simulate.h>
+
+/* Logging configuration */
+#include <ff/logging.h>
+
+/**
+ * Bounces a message between the leader and the other peer until the
+ * leader has received it n times.
+ */
+class PingPong : public Fronctocol {
+public:
+  std::string name() override {
+    return std::string("Ping Pong");
+  }
+
+  std::string const other;
+  bool const leader;
+  size_t const n;
+  size_t received = 0;
+
+  PingPong(std::string const & o, bool const l, size_t const n) :
+      other(o), leader(l), n(n) {
+  }
+
+  void ping() {
+    std::unique_ptr<OutgoingMessage> omsg(
+        new OutgoingMessage(this->other));
+    omsg->write<uint64_t>(this->received);
+    this->send(std::move(omsg));
+  }
+
+  void init() override {
+    if (this->leader) {
+      this->ping();
+    }
+  }
+
+  void handleReceive(IncomingMessage & imsg) override {
+    uint64_t count;
+    imsg.read<uint64_t>(count);
+    this->received++;
+
+    if (!this->leader) {
+      this->ping();
+    }
+    if (this->received == this->n) {
+      this->complete();
+    } else if (this->leader) {
+      this->ping();
+    }
+  }
+
+  void handleComplete(Fronctocol &) override {
+    log_error("Ping Pong shouldn't have a complete");
+  }
+
+  void handlePromise(Fronctocol &) override {
+    log_error("Ping Pong shouldn't have a promise");
+  }
+};
+
+static void makePingPong(
+    std::map<std::string, std::unique_ptr<Fronctocol>> & tests,
+    size_t const n) {
+  tests["alice"] =
+      std::unique_ptr<Fronctocol>(new PingPong("bob", true, n));
+  tests["bob"] =
+      std::unique_ptr<Fronctocol>(new PingPong("alice", false, n));
+}
+
+TEST(simulate, latency) {
+  std::map<std::string, std::unique_ptr<Fronctocol>> tests;
+  makePingPong(tests, 5);
+
+  ff::tester::NetworkModel<std::string> model;
+  model.defaultLink.latency = 0.01;
+
+  ff::tester::SimStats<std::string> stats;
+  EXPECT_TRUE(runTests(tests, model, &stats));
+
+  // Every message is on the critical path, so the simulated time is
+  // one latency per round.
+  EXPECT_LE(10, stats.messages);
+  EXPECT_LE(10, stats.rounds);
+  double const rounds = static_cast<double>(stats.rounds);
+  EXPECT_NEAR(0.01 * rounds, stats.wallTime, 1e-9);
+  EXPECT_EQ(0.0, stats.maxUtilization());
+}
+
+TEST(simulate, bandwidth) {
+  std::map<std::string, std::unique_ptr<Fronctocol>> tests;
+  makePingPong(tests, 5);
+
+  ff::tester::NetworkModel<std::string> model;
+  model.defaultLink.latency = 0.01;
+  std::pair<std::string, std::string> const alice_bob("alice", "bob");
+  model.links[alice_bob].bandwidth = 100.0;
+
+  ff::tester::SimStats<std::string> stats;
+  EXPECT_TRUE(runTests(tests, model, &stats));
+
+  // Only alice's messages are slowed by transmission.
+  double const transmit =
+      static_cast<double>(stats.links[alice_bob].bytes) / 100.0;
+  EXPECT_NEAR(transmit, stats.links[alice_bob].busyTime, 1e-9);
+  EXPECT_LT(0.01 * static_cast<double>(stats.rounds), stats.wallTime);
+  EXPECT_NEAR(
+      transmit / stats.wallTime,
+      stats.utilization("alice", "bob"),
+      1e-9);
+  EXPECT_EQ(0.0, stats.utilization("bob", "alice"));
+}
+
+TEST(simulate, jitter) {
+  std::map<std::string, std::unique_ptr<Fronctocol>> tests;
+  makePingPong(tests, 5);
+
+  ff::tester::NetworkModel<std::string> model;
+  model.defaultLink.latency = 0.01;
+  model.defaultLink.jitter = 0.005;
+  model.seed = 7;
+
+  ff::tester::SimStats<std::string> stats;
+  EXPECT_TRUE(runTests(tests, model, &stats));
+
+  double const rounds = static_cast<double>(stats.rounds);
+  EXPECT_LE(0.01 * rounds, stats.wallTime);
+  EXPECT_GE(0.015 * rounds, stats.wallTime);
+}
@@ -34,6 +34,26 @@ bool runTests(
           tests, message_converter);
 }
 
+bool runTests(
+    std::map<std::string, std::unique_ptr<Fronctocol>> & tests,
+    uint64_t seed,
+    ff::tester::RunStats<std::string> * stats) {
+  return ff::tester::
+      runTests<std::string, PeerSet, IncomingMessage, OutgoingMessage>(
+          tests, message_converter, seed, stats);
+}
+
+bool runTests(
+    std::map<std::string, std::unique_ptr<Fronctocol>> & tests,
+    ff::tester::NetworkModel<std::string> const & model,
+    ff::tester::SimStats<std::string> * stats) {
+  return ff::tester::simulateTests<
+      std::string,
+      PeerSet,
+      IncomingMessage,
+      OutgoingMessage>(tests, message_converter, model, stats);
+}
+
 const ::std::function<void(IncomingMessage &, Fronctocol *)>
     failTestOnReceive = ff::tester::failTestOnReceive<
         ::std::string,
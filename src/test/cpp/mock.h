@@ -17,6 +17,7 @@
 /* 3rd Party Headers */
 
 /* Fortissimo Headers */
+#include <ff/Continuation.h>
 #include <ff/Fronctocol.h>
 #include <ff/Message.h>
 #include <ff/PeerSet.h>
@@ -25,6 +26,7 @@
 #include <ff/posixnet/posixnet.h>
 #include <ff/tester/Tester.h>
 #include <ff/tester/runTests.h>
+#include <ff/tester/simulate.h>
 
 using IncomingMessage = ff::posixnet::IncomingMessage<::std::string>;
 using OutgoingMessage = ff::posixnet::OutgoingMessage<::std::string>;
@@ -53,12 +55,32 @@ using PromiseFronctocol = ff::PromiseFronctocol<
     OutgoingMessage,
     Result_T>;
 
+using PromiseJoin = ff::PromiseJoin<
+    ::std::string,
+    PeerSet,
+    IncomingMessage,
+    OutgoingMessage>;
+
+using ContinuationFronctocol = ff::ContinuationFronctocol<
+    ::std::string,
+    PeerSet,
+    IncomingMessage,
+    OutgoingMessage>;
+
 /* Wrappers for the runTests function. */
 bool runTests(
     std::map<std::string, std::unique_ptr<Fronctocol>> & tests,
     uint64_t seed);
 bool runTests(
     std::map<std::string, std::unique_ptr<Fronctocol>> & tests);
+bool runTests(
+    std::map<std::string, std::unique_ptr<Fronctocol>> & tests,
+    uint64_t seed,
+    ff::tester::RunStats<std::string> * stats);
+bool runTests(
+    std::map<std::string, std::unique_ptr<Fronctocol>> & tests,
+    ff::tester::NetworkModel<std::string> const & model,
+    ff::tester::SimStats<std::string> * stats);
 
 using Tester = ff::tester::
     Tester<::std::string, PeerSet, IncomingMessage, OutgoingMessage>;
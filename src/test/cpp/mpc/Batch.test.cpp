@@ -181,3 +181,106 @@ TEST(Batch, Batch) {
     EXPECT_EQ(0, l_ins[i]);
   }
 }
+
+class PromiseInt : public PromiseFronctocol<uint32_t> {
+public:
+  uint32_t in;
+
+  std::string name() override {
+    return std::string("Promise Int");
+  }
+
+  PromiseInt(uint32_t i) : in(i) {
+  }
+
+  void init() override {
+    this->getPeers().forEach([this](std::string const & peer) {
+      if (this->getSelf() != peer) {
+        std::unique_ptr<OutgoingMessage> om(new OutgoingMessage(peer));
+        om->write(this->in);
+        this->send(std::move(om));
+      }
+    });
+  }
+
+  void handleReceive(IncomingMessage & im) override {
+    this->result = std::unique_ptr<uint32_t>(new uint32_t(0));
+    im.read(*this->result);
+    this->complete();
+  }
+
+  void handleComplete(Fronctocol &) override {
+    this->abort();
+  }
+
+  void handlePromise(Fronctocol &) override {
+    this->abort();
+  }
+};
+
+class AwaitInt : public Fronctocol {
+public:
+  uint32_t in;
+  uint32_t * out;
+
+  std::unique_ptr<Promise<uint32_t>> exchange;
+
+  std::string name() override {
+    return std::string("Await Int");
+  }
+
+  AwaitInt(uint32_t i, uint32_t * o) : in(i), out(o) {
+  }
+
+  void init() override {
+    this->exchange = this->promise<uint32_t>(
+        std::unique_ptr<PromiseFronctocol<uint32_t>>(
+            new PromiseInt(this->in)),
+        this->getPeers());
+    this->await(*this->exchange);
+  }
+
+  void handleReceive(IncomingMessage &) override {
+    this->abort();
+  }
+
+  void handleComplete(Fronctocol &) override {
+    this->abort();
+  }
+
+  void handlePromise(Fronctocol & f) override {
+    std::unique_ptr<uint32_t> result = this->exchange->getResult(f);
+    if (result == nullptr) {
+      this->abort();
+      return;
+    }
+    *this->out = *result;
+    this->complete();
+  }
+};
+
+TEST(Batch, BatchPromise) {
+  std::vector<uint32_t> l_outs(10, UINT32_MAX);
+  std::vector<uint32_t> r_outs(10, UINT32_MAX);
+
+  std::map<std::string, std::unique_ptr<Fronctocol>> test;
+
+  test["alice"] = std::unique_ptr<Fronctocol>(new Batch<TEST_TYPES>());
+  for (uint32_t i = 0; i < 10; i++) {
+    static_cast<Batch<TEST_TYPES> &>(*test["alice"])
+        .children.emplace_back(new AwaitInt(i, &l_outs[i]));
+  }
+
+  test["bob"] = std::unique_ptr<Fronctocol>(new Batch<TEST_TYPES>());
+  for (uint32_t i = 0; i < 10; i++) {
+    static_cast<Batch<TEST_TYPES> &>(*test["bob"])
+        .children.emplace_back(new AwaitInt(i + 20, &r_outs[i]));
+  }
+
+  EXPECT_TRUE(runTests(test));
+
+  for (uint32_t i = 0; i < 10; i++) {
+    EXPECT_EQ(i + 20, l_outs[i]);
+    EXPECT_EQ(i, r_outs[i]);
+  }
+}
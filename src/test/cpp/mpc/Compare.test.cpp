@@ -31,27 +31,37 @@ const std::vector<std::string> NAMES = {
     {"alice", "bob", "chelsea", "david", "eve", "farrah"}};
 
 template<typename Large_T, typename Small_T>
-void testCompare(size_t const nparties, Large_T const p) {
+void testCompare(
+    size_t const nparties,
+    Large_T const p,
+    PrefixOrStrategy const strategy = PrefixOrStrategy::sqrtBlocks,
+    size_t const ndealers = 1) {
   log_assert(nparties > 1);
   log_assert(nparties < NAMES.size());
 
-  std::string const dealer("dealer");
+  std::vector<std::string> dealers(1, "dealer");
+  for (size_t i = 1; i < ndealers; i++) {
+    dealers.push_back("dealer" + std::to_string(i));
+  }
   std::string const revealer(NAMES[1]);
 
-  CompareInfo<std::string, Large_T, Small_T> info(p, &revealer);
+  CompareInfo<std::string, Large_T, Small_T> info(
+      p, &revealer, strategy);
 
   std::map<std::string, std::unique_ptr<Fronctocol>> test;
 
-  test[dealer] = std::unique_ptr<Fronctocol>(new Tester(
-      [&](Fronctocol * self) {
-        log_debug("Starting dealer test");
+  for (std::string const & dealer : dealers) {
+    test[dealer] = std::unique_ptr<Fronctocol>(new Tester(
+        [&](Fronctocol * self) {
+          log_debug("Starting dealer test");
 
-        std::unique_ptr<Fronctocol> rd2(
-            new CompareRandomnessHouse<TEST_TYPES, Large_T, Small_T>(
-                &info));
-        self->invoke(std::move(rd2), self->getPeers());
-      },
-      [&](Fronctocol &, Fronctocol * self) { self->complete(); }));
+          std::unique_ptr<Fronctocol> rd2(
+              new CompareRandomnessHouse<TEST_TYPES, Large_T, Small_T>(
+                  &info, dealers));
+          self->invoke(std::move(rd2), self->getPeers());
+        },
+        [&](Fronctocol &, Fronctocol * self) { self->complete(); }));
+  }
 
   Large_T const x = randomModP<Large_T>(p / 2);
   Large_T const y = randomModP<Large_T>(p / 2);
@@ -67,16 +77,16 @@ void testCompare(size_t const nparties, Large_T const p) {
   for (size_t i = 0; i < nparties; i++) {
     size_t * num_remaining = new size_t(2);
     test[NAMES[i]] = std::unique_ptr<Fronctocol>(new Tester(
-        [&info, &dealer](Fronctocol * self) {
+        [&info, &dealers](Fronctocol * self) {
           self->invoke(
               std::unique_ptr<Fronctocol>(
                   new CompareRandomnessPatron<
                       TEST_TYPES,
                       Large_T,
-                      Small_T>(&info, &dealer, 1UL)),
+                      Small_T>(&info, dealers, 1UL)),
               self->getPeers());
         },
-        [i, num_remaining, &info, &dealer, &xs, &ys, &results](
+        [i, num_remaining, &info, &dealers, &xs, &ys, &results](
             Fronctocol & f, Fronctocol * self) {
           (*num_remaining)--;
           if (*num_remaining == 1) {
@@ -88,7 +98,9 @@ void testCompare(size_t const nparties, Large_T const p) {
                     .compareDispenser->get());
 
             PeerSet ps(self->getPeers());
-            ps.remove(dealer);
+            for (std::string const & dealer : dealers) {
+              ps.remove(dealer);
+            }
             self->invoke(
                 std::unique_ptr<Fronctocol>(
                     new Compare<TEST_TYPES, Large_T, Small_T>(
@@ -157,6 +169,27 @@ TEST(Compare, compare_2_to_6_parties_uint64_uint64) {
   }
 }
 
+TEST(Compare, compare_2_to_6_parties_uint64_uint64_log_depth) {
+  for (size_t nparties = 2; nparties < 6; nparties++) {
+    for (size_t i = 0; i < 5; i++) {
+      testCompare<uint64_t, uint64_t>(
+          nparties,
+          ((uint64_t)1 << 61) - 1,
+          PrefixOrStrategy::logDepth);
+    }
+  }
+}
+
+TEST(Compare, compare_sharded_dealers) {
+  for (size_t ndealers = 2; ndealers < 4; ndealers++) {
+    testCompare<LargeNum, uint32_t>(
+        3,
+        (LargeNum(1) << 89) - 1,
+        PrefixOrStrategy::sqrtBlocks,
+        ndealers);
+  }
+}
+
 TEST(Compare, compare_greater_than) {
 
   std::map<std::string, std::unique_ptr<Fronctocol>> test;
@@ -6,13 +6,26 @@
 
 /* C++ Headers */
 #include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 /* 3rd Party Headers */
 #include <gtest/gtest.h>
 
 /* Fortissimo Headers */
+#include <mock.h>
+
 #include <mpc/Matrix.h>
+#include <mpc/MatrixInverse.h>
+#include <mpc/Multiply.h>
 #include <mpc/Randomness.h>
+#include <mpc/templates.h>
+
+/* Logging Configuration */
+#include <ff/logging.h>
 
 void generate_random_matrix(
     uint32_t const prime, ff::mpc::Matrix<uint32_t> * M) {
@@ -117,3 +130,169 @@ TEST(RowReduction, determinant) {
     EXPECT_EQ(ff::mpc::modMul(detM, detMInverse, prime), 1U);
   }
 }
+
+/**
+ * Inverts a matrix spanning several panels of the blocked LU, and big
+ * enough for its trailing updates to be threaded.
+ */
+template<typename Number_T>
+static void
+testBlockedInverse(Number_T const prime, size_t const size) {
+  ff::mpc::Matrix<Number_T> M(size, size);
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = 0; j < size; j++) {
+      M.at(i, j) = ff::mpc::randomModP<Number_T>(prime);
+    }
+  }
+  // Force row swaps while factoring the first panel.
+  M.at(0, 0) = 0;
+  M.at(1, 1) = 0;
+
+  Number_T const det = M.Det(prime);
+  ASSERT_NE(det, 0U);
+
+  ff::mpc::Matrix<Number_T> MInverse(M.Inverse(prime));
+  ff::mpc::Matrix<Number_T> product(size, size);
+  ff::mpc::plainMatrixMult(&M, &MInverse, &product, prime);
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = 0; j < size; j++) {
+      ASSERT_EQ(product.at(i, j), i == j ? 1U : 0U)
+          << "i: " << i << ", j: " << j << std::endl;
+    }
+  }
+  EXPECT_EQ(ff::mpc::modMul(det, MInverse.Det(prime), prime), 1U);
+
+  // det(M * M) = det(M)^2
+  ff::mpc::plainMatrixMult(&M, &M, &product, prime);
+  EXPECT_EQ(product.Det(prime), ff::mpc::modMul(det, det, prime));
+
+  // Repeating a row late in the matrix makes it singular.
+  for (size_t j = 0; j < size; j++) {
+    M.at(size - 1, j) = M.at(size / 2, j);
+  }
+  EXPECT_EQ(M.Det(prime), 0U);
+}
+
+TEST(RowReduction, blocked_inverse_32) {
+  testBlockedInverse<uint32_t>(4294967291U, 200);
+}
+
+TEST(RowReduction, blocked_inverse_64) {
+  testBlockedInverse<uint64_t>(2305843009213693951ULL, 200);
+}
+
+/**
+ * Shares M among alice, bob and carol, and inverts it with
+ * MatrixInverse. Returns whether every party found M invertible, with
+ * the reconstructed inverse in MInverse.
+ */
+static bool cipherInverse(
+    uint32_t const prime,
+    ff::mpc::Matrix<uint32_t> const & M,
+    ff::mpc::Matrix<uint32_t> & MInverse) {
+  using namespace ff::mpc;
+  size_t const n = M.getNumRows();
+  std::vector<std::string> const parties = {"alice", "bob", "carol"};
+
+  std::vector<Matrix<uint32_t>> inputs(
+      parties.size(), Matrix<uint32_t>(n, n));
+  std::vector<Matrix<uint32_t>> outputs(
+      parties.size(), Matrix<uint32_t>(n, n));
+  std::vector<uint32_t> shares;
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      arithmeticSecretShare<uint32_t>(
+          parties.size(), prime, M.at(i, j), shares);
+      for (size_t p = 0; p < parties.size(); p++) {
+        inputs[p].at(i, j) = shares[p];
+      }
+    }
+  }
+
+  using Beavers =
+      RandomnessDispenser<BeaverTriple<uint32_t>, BeaverInfo<uint32_t>>;
+  BeaverInfo<uint32_t> const beaver_info(prime);
+  std::vector<std::unique_ptr<Beavers>> beavers;
+  for (size_t p = 0; p < parties.size(); p++) {
+    beavers.emplace_back(new Beavers(beaver_info));
+  }
+  std::vector<BeaverTriple<uint32_t>> triples;
+  for (size_t i = 0; i < n * n * n; i++) {
+    beaver_info.generate(parties.size(), i, triples);
+    for (size_t p = 0; p < parties.size(); p++) {
+      beavers[p]->insert(triples[p]);
+    }
+  }
+
+  std::vector<RandomInvertibleMatrix<uint32_t>> masks;
+  RandomInvertibleMatrixInfo<uint32_t>(prime, n).generate(
+      parties.size(), 0, masks);
+
+  std::string const revealer("alice");
+  MultiplyInfo<std::string, BeaverInfo<uint32_t>> const mult_info(
+      &revealer, beaver_info);
+
+  std::vector<MatrixInverse<TEST_TYPES, uint32_t> *> inverses;
+  std::map<std::string, std::unique_ptr<Fronctocol>> tests;
+  for (size_t p = 0; p < parties.size(); p++) {
+    inverses.push_back(new MatrixInverse<TEST_TYPES, uint32_t>(
+        &inputs[p],
+        &outputs[p],
+        mult_info,
+        std::move(beavers[p]),
+        std::move(masks[p])));
+    tests[parties[p]] = std::unique_ptr<Fronctocol>(inverses.back());
+  }
+
+  EXPECT_TRUE(runTests(tests));
+
+  bool invertible = true;
+  for (MatrixInverse<TEST_TYPES, uint32_t> * inverse : inverses) {
+    invertible = invertible && inverse->invertible;
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      uint32_t sum = 0;
+      for (Matrix<uint32_t> const & output : outputs) {
+        sum = modAdd(sum, output.at(i, j), prime);
+      }
+      MInverse.at(i, j) = sum;
+    }
+  }
+  return invertible;
+}
+
+TEST(MatrixInverse, cipher_inverse) {
+  uint32_t const prime = 65521;
+  size_t const size = 4;
+  ff::mpc::Matrix<uint32_t> M(size, size);
+  do {
+    generate_random_matrix(prime, &M);
+  } while (M.Det(prime) == 0);
+
+  ff::mpc::Matrix<uint32_t> MInverse(size, size);
+  EXPECT_TRUE(cipherInverse(prime, M, MInverse));
+
+  ff::mpc::Matrix<uint32_t> product(size, size);
+  ff::mpc::plainMatrixMult(&M, &MInverse, &product, prime);
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = 0; j < size; j++) {
+      EXPECT_EQ(product.at(i, j), i == j ? 1U : 0U)
+          << "i: " << i << ", j: " << j << std::endl;
+    }
+  }
+}
+
+TEST(MatrixInverse, cipher_singular) {
+  uint32_t const prime = 65521;
+  size_t const size = 4;
+  ff::mpc::Matrix<uint32_t> M(size, size);
+  generate_random_matrix(prime, &M);
+  for (size_t j = 0; j < size; j++) {
+    M.at(size - 1, j) = M.at(0, j);
+  }
+
+  ff::mpc::Matrix<uint32_t> MInverse(size, size);
+  EXPECT_FALSE(cipherInverse(prime, M, MInverse));
+}
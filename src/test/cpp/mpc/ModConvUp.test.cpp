@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 /* 3rd Party Headers */
 #include <gtest/gtest.h>
@@ -438,3 +439,90 @@ TEST(ModConvUp, mod_conversion_SmallNum_SmallNum_LargeNum) {
             static_cast<uint64_t>(endModulus)));
   }
 };
+
+TEST(ModConvUp, batched_mod_conversion) {
+  std::map<std::string, std::unique_ptr<Fronctocol>> test;
+
+  const SmallNum startModulus = 2707;
+  const SmallNum endModulus = 22073;
+  // Enough for a partly filled byte of packed ANDs, and for both
+  // values of whether t + q_tilde wraps mod p.
+  size_t const n = 37;
+
+  std::vector<std::string> const parties = {"income", "univ1", "univ2"};
+  std::string const dealer{"dealer"};
+
+  ModConvUpInfo<std::string, SmallNum, SmallNum, SmallNum> info(
+      endModulus, startModulus, &parties[0]);
+
+  std::vector<std::vector<SmallNum>> inputs(parties.size());
+  std::vector<std::vector<SmallNum>> outputs(parties.size());
+  for (std::vector<SmallNum> & input : inputs) {
+    for (size_t i = 0; i < n; i++) {
+      input.push_back(randomModP<SmallNum>(startModulus));
+    }
+  }
+
+  using Patron = BatchedModConvUpRandomnessPatron<
+      TEST_TYPES,
+      SmallNum,
+      SmallNum,
+      SmallNum>;
+  using Conversion =
+      BatchedModConvUp<TEST_TYPES, SmallNum, SmallNum, SmallNum>;
+
+  test[dealer] = std::unique_ptr<Fronctocol>(new Tester(
+      [&](Fronctocol * self) {
+        std::unique_ptr<Fronctocol> house(new ModConvUpRandomnessHouse<
+                                          TEST_TYPES,
+                                          SmallNum,
+                                          SmallNum,
+                                          SmallNum>(&info));
+        self->invoke(std::move(house), self->getPeers());
+      },
+      [&](Fronctocol &, Fronctocol * self) { self->complete(); }));
+
+  for (size_t j = 0; j < parties.size(); j++) {
+    test[parties[j]] = std::unique_ptr<Fronctocol>(new Tester(
+        [&, j](Fronctocol * self) {
+          std::unique_ptr<Fronctocol> patron(
+              new Patron(&info, &dealer, n));
+          self->invoke(std::move(patron), self->getPeers());
+        },
+        [&, j](Fronctocol & f, Fronctocol * self) {
+          Patron * patron = dynamic_cast<Patron *>(&f);
+          if (patron != nullptr) {
+            PeerSet ps(self->getPeers());
+            ps.remove(dealer);
+            std::unique_ptr<Fronctocol> c(new Conversion(
+                std::move(inputs[j]),
+                &info,
+                std::move(patron->randomness)));
+            self->invoke(std::move(c), ps);
+          } else {
+            outputs[j] = static_cast<Conversion &>(f).outputShares;
+            self->complete();
+          }
+        },
+        failTestOnReceive,
+        failTestOnPromise));
+  }
+
+  std::vector<SmallNum> expected(n, 0);
+  for (std::vector<SmallNum> const & input : inputs) {
+    for (size_t i = 0; i < n; i++) {
+      expected[i] = modAdd(expected[i], input[i], startModulus);
+    }
+  }
+
+  EXPECT_TRUE(runTests(test));
+
+  for (size_t i = 0; i < n; i++) {
+    SmallNum sum = 0;
+    for (std::vector<SmallNum> const & output : outputs) {
+      ASSERT_EQ(output.size(), n);
+      sum = modAdd(sum, output[i], endModulus);
+    }
+    EXPECT_EQ(expected[i], sum) << "i: " << i;
+  }
+}
@@ -5,6 +5,7 @@
 /* C and POSIX Headers */
 
 /* C++ Headers */
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -19,6 +20,7 @@
 
 #include <ff/Fronctocol.h>
 #include <mpc/Multiply.h>
+#include <mpc/Opening.h>
 #include <mpc/Randomness.h>
 #include <mpc/templates.h>
 
@@ -264,3 +266,62 @@ TEST(Multiply, boolean_multiply) {
   EXPECT_EQ(
       (income_share + univ1_share + univ2_share) % 2, (x * y) % 2);
 };
+
+TEST(Multiply, opening_strategies) {
+  size_t const n_parties = 7;
+  const uint32_t p = (1U << 31) - 1; // mersenne prime
+  std::vector<std::string> parties;
+  for (size_t i = 0; i < n_parties; i++) {
+    parties.push_back(std::string("party") + std::to_string(i));
+  }
+  // Not the least party, so that the tree is rooted mid-order.
+  std::string const revealer = parties[3];
+
+  struct Case {
+    Opening opening;
+    size_t messages;
+    size_t rounds;
+  };
+  std::vector<Case> const cases = {
+      {Opening(OpeningStrategy::allToAll),
+       n_parties * (n_parties - 1),
+       1},
+      {Opening(OpeningStrategy::king), 2 * (n_parties - 1), 2},
+      // Trees of depth 2 for 7 parties.
+      {Opening(OpeningStrategy::tree, 2), 2 * (n_parties - 1), 4},
+      {Opening(OpeningStrategy::tree, 3), 2 * (n_parties - 1), 4}};
+  for (Case const & c : cases) {
+    MultiplyInfo<std::string, BeaverInfo<uint32_t>> mult_info(
+        &revealer, BeaverInfo<uint32_t>(p), c.opening);
+
+    const uint32_t x = randomModP(p);
+    const uint32_t y = randomModP(p);
+    std::vector<uint32_t> xs;
+    arithmeticSecretShare(n_parties, p, x, xs);
+    std::vector<uint32_t> ys;
+    arithmeticSecretShare(n_parties, p, y, ys);
+    std::vector<BeaverTriple<uint32_t>> beavers;
+    mult_info.info.generate(n_parties, 1, beavers);
+
+    std::vector<uint32_t> zs(n_parties, 0);
+    std::map<std::string, std::unique_ptr<Fronctocol>> test;
+    for (size_t i = 0; i < n_parties; i++) {
+      test[parties[i]] = std::unique_ptr<Fronctocol>(
+          new Multiply<TEST_TYPES, uint32_t, BeaverInfo<uint32_t>>(
+              xs[i], ys[i], &zs[i], std::move(beavers[i]), &mult_info));
+    }
+
+    ff::tester::RunStats<std::string> stats;
+    EXPECT_TRUE(runTests(test, 1, &stats));
+    // Every party also tells every other that it has completed, in one
+    // more round.
+    EXPECT_EQ(c.messages + n_parties * (n_parties - 1), stats.messages);
+    EXPECT_EQ(c.rounds + 1, stats.rounds);
+
+    uint32_t z = 0;
+    for (uint32_t const share : zs) {
+      z = modAdd(z, share, p);
+    }
+    EXPECT_EQ(modMul(x, y, p), z);
+  }
+}
@@ -5,6 +5,8 @@
 /* C and POSIX Headers */
 
 /* C++ Headers */
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -67,3 +69,94 @@ TEST(Compare, PosIntCompare_compiles) {
   patron.handleComplete(pos_compare);
   */
 }
+
+TEST(Compare, batched_pos_int_compare) {
+  std::map<std::string, std::unique_ptr<Fronctocol>> test;
+
+  uint32_t const p = 509;
+  std::vector<std::string> const parties = {"alice", "bob", "carol"};
+  std::string const dealer("dealer");
+  CompareInfo<std::string, uint32_t, uint32_t> const info(
+      p, &parties[0]);
+
+  // An odd count, so the last packed multiply byte is half used.
+  std::vector<uint32_t> const xs = {0, 508, 3, 254, 255, 100, 400};
+  std::vector<uint32_t> const ys = {0, 1, 508, 255, 254, 100, 400};
+  size_t const n = xs.size();
+
+  std::vector<std::vector<uint32_t>> x_shares(parties.size());
+  std::vector<std::vector<uint32_t>> y_shares(parties.size());
+  std::vector<uint32_t> shares;
+  for (size_t i = 0; i < n; i++) {
+    arithmeticSecretShare(parties.size(), p, xs[i], shares);
+    for (size_t j = 0; j < parties.size(); j++) {
+      x_shares[j].push_back(shares[j]);
+    }
+    arithmeticSecretShare(parties.size(), p, ys[i], shares);
+    for (size_t j = 0; j < parties.size(); j++) {
+      y_shares[j].push_back(shares[j]);
+    }
+  }
+
+  test[dealer] = std::unique_ptr<Fronctocol>(new Tester(
+      [&](Fronctocol * self) {
+        std::unique_ptr<Fronctocol> house(
+            new PosIntCompareRandomnessHouse<
+                TEST_TYPES,
+                uint32_t,
+                uint32_t>(&info));
+        self->invoke(std::move(house), self->getPeers());
+      },
+      [&](Fronctocol &, Fronctocol * self) { self->complete(); }));
+
+  std::vector<std::vector<Boolean_t>> results(parties.size());
+  for (size_t j = 0; j < parties.size(); j++) {
+    test[parties[j]] = std::unique_ptr<Fronctocol>(new Tester(
+        [&, j](Fronctocol * self) {
+          std::unique_ptr<Fronctocol> patron(
+              new BatchedPosIntCompareRandomnessPatron<
+                  TEST_TYPES,
+                  uint32_t,
+                  uint32_t>(&info, &dealer, n, 1));
+          self->invoke(std::move(patron), self->getPeers());
+        },
+        [&, j](Fronctocol & f, Fronctocol * self) {
+          using Patron = BatchedPosIntCompareRandomnessPatron<
+              TEST_TYPES,
+              uint32_t,
+              uint32_t>;
+          using BatchedCompare =
+              BatchedPosIntCompare<TEST_TYPES, uint32_t, uint32_t>;
+
+          Patron * patron = dynamic_cast<Patron *>(&f);
+          if (patron != nullptr) {
+            PeerSet ps(self->getPeers());
+            ps.remove(dealer);
+            std::unique_ptr<Fronctocol> compare(new BatchedCompare(
+                std::move(x_shares[j]),
+                std::move(y_shares[j]),
+                &info,
+                patron->batchedPosIntCompareDispenser->get()));
+            self->invoke(std::move(compare), ps);
+          } else {
+            results[j] = static_cast<BatchedCompare &>(f).outputShares;
+            self->complete();
+          }
+        },
+        failTestOnReceive,
+        failTestOnPromise));
+  }
+
+  EXPECT_TRUE(runTests(test));
+
+  for (size_t i = 0; i < n; i++) {
+    Boolean_t result = 0;
+    for (std::vector<Boolean_t> const & r : results) {
+      ASSERT_EQ(r.size(), n);
+      result = result ^ r[i];
+    }
+    Boolean_t const expected =
+        xs[i] > ys[i] ? 1 : (xs[i] == ys[i] ? 2 : 0);
+    EXPECT_EQ(expected, result) << "x: " << xs[i] << ", y: " << ys[i];
+  }
+}
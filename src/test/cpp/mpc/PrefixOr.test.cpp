@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 /* 3rd Party Headers */
 #include <gtest/gtest.h>
@@ -182,3 +183,113 @@ TEST(Compare, prefix_or) {
         (results_income[i] + results_univ1[i] + results_univ2[i]) % p);
   }
 };
+
+TEST(Compare, prefix_or_lagrange_cache) {
+  const SmallNum s = 37;
+  const size_t ell = 32;
+  const size_t lambda = 6;
+
+  std::shared_ptr<LagrangePolynomialSet<SmallNum> const> first =
+      cachedLagrangePolynomialSet(ell, lambda, s);
+  std::shared_ptr<LagrangePolynomialSet<SmallNum> const> second =
+      cachedLagrangePolynomialSet(ell, lambda, s);
+
+  EXPECT_EQ(first.get(), second.get());
+  EXPECT_EQ(generateLagrangePolynomialSet(ell, lambda, s), *first);
+  EXPECT_NE(
+      first.get(), cachedLagrangePolynomialSet(ell, lambda + 1, s).get());
+
+  std::string const revealer("income");
+  PrefixOrInfo<std::string, SmallNum> info1(s, ell, &revealer);
+  PrefixOrInfo<std::string, SmallNum> info2(s, ell, &revealer);
+  EXPECT_EQ(&info1.lagrangePolynomialSet, &info2.lagrangePolynomialSet);
+}
+
+TEST(Compare, prefix_or_log_depth) {
+  std::map<std::string, std::unique_ptr<Fronctocol>> test;
+
+  // A 61-bit comparison, where the sqrt construction is costliest.
+  SmallNum const s = 67;
+  size_t const ell = 61;
+
+  std::vector<std::string> const parties = {"income", "univ1", "univ2"};
+  std::string const dealer("dealer");
+
+  PrefixOrInfo<std::string, SmallNum> info(
+      s, ell, &parties[0], PrefixOrStrategy::logDepth);
+  EXPECT_TRUE(info.lagrangePolynomialSet.empty());
+
+  // Leading zeros, then sparse ones, so the or changes part way in.
+  std::vector<SmallNum> bits(ell, 0);
+  for (size_t i = 20; i < ell; i++) {
+    bits[i] = randomModP<SmallNum>(8) == 0 ? 1 : 0;
+  }
+  bits[40] = 1;
+
+  std::vector<std::vector<SmallNum>> inputs(parties.size());
+  std::vector<SmallNum> shares;
+  for (size_t i = 0; i < ell; i++) {
+    arithmeticSecretShare(parties.size(), s, bits[i], shares);
+    for (size_t j = 0; j < parties.size(); j++) {
+      inputs[j].push_back(shares[j]);
+    }
+  }
+  std::vector<std::vector<SmallNum>> outputs(parties.size());
+
+  using Patron = PrefixOrRandomnessPatron<TEST_TYPES, SmallNum>;
+
+  test[dealer] = std::unique_ptr<Fronctocol>(new Tester(
+      [&](Fronctocol * self) {
+        std::unique_ptr<Fronctocol> house(
+            new PrefixOrRandomnessHouse<TEST_TYPES, SmallNum>(&info));
+        self->invoke(std::move(house), self->getPeers());
+      },
+      [&](Fronctocol &, Fronctocol * self) { self->complete(); }));
+
+  for (size_t j = 0; j < parties.size(); j++) {
+    test[parties[j]] = std::unique_ptr<Fronctocol>(new Tester(
+        [&](Fronctocol * self) {
+          std::unique_ptr<Fronctocol> patron(
+              new Patron(&info, &dealer, 1UL));
+          self->invoke(std::move(patron), self->getPeers());
+        },
+        [&, j](Fronctocol & f, Fronctocol * self) {
+          Patron * patron = dynamic_cast<Patron *>(&f);
+          if (patron != nullptr) {
+            PrefixOrRandomness<SmallNum> randomness(
+                patron->prefixOrDispenser->get());
+            EXPECT_TRUE(randomness.exponentSeries.empty());
+            EXPECT_EQ(
+                randomness.multiplyDispenser->size(),
+                numLogDepthPrefixOrMultiplies(ell));
+
+            PeerSet ps(self->getPeers());
+            ps.remove(dealer);
+            std::unique_ptr<Fronctocol> prefix(
+                new PrefixOr<TEST_TYPES, SmallNum>(
+                    inputs[j], &info, std::move(randomness)));
+            self->invoke(std::move(prefix), ps);
+          } else {
+            outputs[j] =
+                static_cast<PrefixOr<TEST_TYPES, SmallNum> &>(f)
+                    .orResults;
+            self->complete();
+          }
+        },
+        failTestOnReceive,
+        failTestOnPromise));
+  }
+
+  EXPECT_TRUE(runTests(test));
+
+  SmallNum expected = 0;
+  for (size_t i = 0; i < ell; i++) {
+    expected = expected | bits[i];
+    SmallNum sum = 0;
+    for (std::vector<SmallNum> const & output : outputs) {
+      ASSERT_EQ(output.size(), ell);
+      sum = modAdd(sum, output[i], s);
+    }
+    EXPECT_EQ(expected, sum) << "i: " << i;
+  }
+}
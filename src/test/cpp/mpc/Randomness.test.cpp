@@ -21,8 +21,14 @@
 #include <ff/Fronctocol.h>
 #include <ff/Message.h>
 #include <ff/Promise.h>
+#include <mpc/Compare.h>
+#include <mpc/ModConvUp.h>
+#include <mpc/Multiply.h>
+#include <mpc/PackedRandomness.h>
 #include <mpc/Randomness.h>
 #include <mpc/RandomnessDealer.h>
+#include <mpc/RandomnessStream.h>
+#include <mpc/Waksman.h>
 
 /* Logging Configuration */
 #include <ff/logging.h>
@@ -116,6 +122,174 @@ TEST(Randomness, xorSecretShare) {
   }
 }
 
+TEST(Randomness, packed_bits_round_trip) {
+  std::vector<size_t> widths;
+  std::vector<uint64_t> values;
+  size_t total_bits = 0;
+  for (size_t i = 0; i < 200; i++) {
+    size_t const width = i % 65;
+    uint64_t value = 0;
+    ff::mpc::randomBytes(&value, sizeof(value));
+    if (width < 64) {
+      value = value & ((UINT64_C(1) << width) - 1);
+    }
+    widths.push_back(width);
+    values.push_back(value);
+    total_bits += width;
+  }
+
+  OutgoingMessage omsg("alice");
+  BitWriter writer;
+  for (size_t i = 0; i < values.size(); i++) {
+    writer.write(values[i], widths[i]);
+  }
+  EXPECT_TRUE(writer.flush(omsg));
+  EXPECT_EQ((total_bits + 7) / 8, omsg.length());
+
+  size_t const len = omsg.length();
+  IncomingMessage imsg(std::string("bob"), omsg.takeBuffer(), len);
+  BitReader reader(imsg, total_bits);
+  EXPECT_TRUE(reader.ok());
+  for (size_t i = 0; i < values.size(); i++) {
+    EXPECT_EQ(values[i], reader.read(widths[i]));
+  }
+  EXPECT_EQ(0, imsg.length());
+}
+
+template<typename Rand_T, typename Info_T>
+static std::vector<Rand_T>
+packRoundTrip(Info_T const & info, std::vector<Rand_T> const & vals) {
+  using Packing = PackedRandomness<Rand_T, Info_T>;
+  static_assert(Packing::packed, "expected a packed specialization");
+
+  OutgoingMessage omsg("alice");
+  BitWriter writer;
+  for (Rand_T const & val : vals) {
+    Packing::pack(writer, info, val);
+  }
+  EXPECT_TRUE(writer.flush(omsg));
+  size_t const num_bits = vals.size() * Packing::bits(info);
+  EXPECT_EQ((num_bits + 7) / 8, omsg.length());
+
+  size_t const len = omsg.length();
+  IncomingMessage imsg(std::string("bob"), omsg.takeBuffer(), len);
+  BitReader reader(imsg, num_bits);
+  EXPECT_TRUE(reader.ok());
+  std::vector<Rand_T> unpacked(vals.size());
+  for (Rand_T & val : unpacked) {
+    Packing::unpack(reader, info, val);
+  }
+  EXPECT_EQ(0, imsg.length());
+  return unpacked;
+}
+
+TEST(Randomness, packed_composite_round_trip) {
+  LargeNum const p = (LargeNum(1) << 89) - 1;
+  DecomposedBitSetInfo<LargeNum, uint32_t> const dbs_info(p, 97, 89);
+  std::vector<DecomposedBitSet<LargeNum, uint32_t>> dbs;
+  dbs_info.generate(3, 8, dbs);
+  std::vector<DecomposedBitSet<LargeNum, uint32_t>> const dbs_out =
+      packRoundTrip(dbs_info, dbs);
+  for (size_t i = 0; i < dbs.size(); i++) {
+    EXPECT_EQ(dbs[i].r, dbs_out[i].r);
+    EXPECT_EQ(dbs[i].r_is, dbs_out[i].r_is);
+    EXPECT_EQ(dbs[i].r_0, dbs_out[i].r_0);
+  }
+
+  using Aux = ModConvUpAux<uint32_t, uint64_t, LargeNum>;
+  ModConvUpAuxInfo<uint32_t, uint64_t, LargeNum> const aux_info(
+      p, UINT64_C(4294967311));
+  std::vector<Aux> aux;
+  aux_info.generate(3, 8, aux);
+  std::vector<Aux> const aux_out = packRoundTrip(aux_info, aux);
+  for (size_t i = 0; i < aux.size(); i++) {
+    EXPECT_EQ(aux[i].r, aux_out[i].r);
+    EXPECT_EQ(aux[i].x, aux_out[i].x);
+    EXPECT_EQ(aux[i].bits_of_x, aux_out[i].bits_of_x);
+    EXPECT_EQ(aux[i].LSB_of_r, aux_out[i].LSB_of_r);
+  }
+
+  WaksmanInfo<uint64_t> const waksman_info(
+      UINT64_C(4294967311), 65537, 8, 3, 17);
+  std::vector<WaksmanBits<uint64_t>> waksman;
+  waksman_info.generate(3, 8, waksman);
+  std::vector<WaksmanBits<uint64_t>> const waksman_out =
+      packRoundTrip(waksman_info, waksman);
+  for (size_t i = 0; i < waksman.size(); i++) {
+    EXPECT_EQ(
+        waksman[i].arithmeticBitShares,
+        waksman_out[i].arithmeticBitShares);
+    EXPECT_EQ(waksman[i].keyBitShares, waksman_out[i].keyBitShares);
+    EXPECT_EQ(waksman[i].XORBitShares, waksman_out[i].XORBitShares);
+  }
+}
+
+TEST(Randomness, packed_beaver_triples) {
+  using Info = BeaverInfo<uint32_t>;
+  using Dispenser = RandomnessDispenser<BeaverTriple<uint32_t>, Info>;
+  std::map<std::string, std::unique_ptr<Fronctocol>> test;
+
+  // A 19 bit prime packs to 57 bits a triple, rather than 96.
+  uint32_t const p = 524287;
+  size_t const num_desired = 100;
+  EXPECT_EQ(57, (PackedRandomness<BeaverTriple<uint32_t>, Info>::bits(
+                    Info(p))));
+
+  std::map<std::string, std::unique_ptr<Promise<Dispenser>>> promises;
+  std::map<std::string, std::unique_ptr<Dispenser>> results;
+
+  test["dealer"] = std::unique_ptr<Fronctocol>(new Tester(
+      [](Fronctocol * self) {
+        std::unique_ptr<Fronctocol> rd(new RandomnessHouse<
+                                       TEST_TYPES,
+                                       BeaverTriple<uint32_t>,
+                                       Info>());
+        self->invoke(std::move(rd), self->getPeers());
+      },
+      finishTestOnComplete));
+
+  for (char const * party : {"alice", "bob"}) {
+    std::unique_ptr<Promise<Dispenser>> & promise = promises[party];
+    std::unique_ptr<Dispenser> & result = results[party];
+
+    test[party] = std::unique_ptr<Fronctocol>(new Tester(
+        [&](Fronctocol * self) {
+          promise = self->promise(
+              std::unique_ptr<PromiseFronctocol<Dispenser>>(
+                  new RandomnessPatron<
+                      TEST_TYPES,
+                      BeaverTriple<uint32_t>,
+                      Info>("dealer", num_desired, Info(p))),
+              self->getPeers());
+          self->await(*promise);
+        },
+        failTestOnComplete,
+        failTestOnReceive,
+        [&](Fronctocol & f, Fronctocol * self) {
+          result = promise->getResult(f);
+          self->complete();
+        }));
+  }
+
+  ff::tester::RunStats<std::string> stats;
+  EXPECT_TRUE(runTests(test, 1, &stats));
+  EXPECT_LT(
+      stats.bytesBySender["dealer"],
+      2 * num_desired * 3 * sizeof(uint32_t));
+
+  ASSERT_NE(nullptr, results["alice"]);
+  ASSERT_NE(nullptr, results["bob"]);
+  ASSERT_EQ(num_desired, results["alice"]->size());
+  ASSERT_EQ(num_desired, results["bob"]->size());
+  for (size_t i = 0; i < num_desired; i++) {
+    BeaverTriple<uint32_t> const l = results["alice"]->get();
+    BeaverTriple<uint32_t> const r = results["bob"]->get();
+    uint32_t const a = modAdd(l.a, r.a, p);
+    uint32_t const b = modAdd(l.b, r.b, p);
+    EXPECT_EQ(modMul(a, b, p), modAdd(l.c, r.c, p));
+  }
+}
+
 struct Uint32Info;
 
 struct Uint32Rand {
@@ -296,6 +470,256 @@ TEST(Randomness, dealer_patron_immediate_await) {
   }
 };
 
+TEST(Randomness, dealer_patron_join) {
+  using Dispenser = RandomnessDispenser<Uint32Rand, Uint32Info>;
+  using Patron = RandomnessPatron<TEST_TYPES, Uint32Rand, Uint32Info>;
+  std::map<std::string, std::unique_ptr<Fronctocol>> test;
+
+  std::vector<Uint32Info> infos(2);
+  infos[1].prime = 7;
+  size_t const num_desired = 20;
+
+  std::map<std::string, PromiseJoin> joins;
+  std::map<std::string, std::vector<std::unique_ptr<Dispenser>>>
+      results;
+  size_t num_houses_completed = 0;
+
+  test["dealer"] = std::unique_ptr<Fronctocol>(new Tester(
+      [&](Fronctocol * self) {
+        for (size_t i = 0; i < infos.size(); i++) {
+          std::unique_ptr<Fronctocol> rd(new RandomnessHouse<
+                                         TEST_TYPES,
+                                         Uint32Rand,
+                                         Uint32Info>());
+          self->invoke(std::move(rd), self->getPeers());
+        }
+      },
+      [&](Fronctocol &, Fronctocol * self) {
+        num_houses_completed++;
+        if (num_houses_completed == infos.size()) {
+          self->complete();
+        }
+      }));
+
+  for (char const * party : {"alice", "bob"}) {
+    PromiseJoin & join = joins[party];
+    std::vector<std::unique_ptr<Dispenser>> & result = results[party];
+    result.resize(infos.size());
+
+    test[party] = std::unique_ptr<Fronctocol>(new Tester(
+        [&](Fronctocol * self) {
+          for (size_t i = 0; i < infos.size(); i++) {
+            join.add(
+                *self,
+                std::unique_ptr<PromiseFronctocol<Dispenser>>(
+                    new Patron("dealer", num_desired, infos[i])),
+                self->getPeers(),
+                &result[i]);
+          }
+          EXPECT_EQ(infos.size(), join.remaining());
+        },
+        failTestOnComplete,
+        failTestOnReceive,
+        [&](Fronctocol & f, Fronctocol * self) {
+          EXPECT_TRUE(join.collect(f));
+          if (join.done()) {
+            self->complete();
+          }
+        }));
+  }
+
+  EXPECT_TRUE(runTests(test));
+
+  std::vector<std::unique_ptr<Dispenser>> & r1 = results["alice"];
+  std::vector<std::unique_ptr<Dispenser>> & r2 = results["bob"];
+  for (size_t i = 0; i < infos.size(); i++) {
+    ASSERT_NE(nullptr, r1[i]);
+    ASSERT_NE(nullptr, r2[i]);
+    EXPECT_EQ(num_desired, r1[i]->size());
+    EXPECT_EQ(num_desired, r2[i]->size());
+    EXPECT_TRUE(r1[i]->info == infos[i]);
+    EXPECT_TRUE(r2[i]->info == infos[i]);
+
+    for (size_t j = 0; j < num_desired; j++) {
+      Uint32Rand const l = r1[i]->get();
+      EXPECT_EQ(l.rand, r2[i]->get().rand);
+      EXPECT_LT(l.rand, infos[i].prime);
+    }
+  }
+}
+
+TEST(Randomness, sharded_dealers) {
+  using Dispenser = RandomnessDispenser<Uint32Rand, Uint32Info>;
+  using House =
+      ShardedRandomnessHouse<TEST_TYPES, Uint32Rand, Uint32Info>;
+  std::map<std::string, std::unique_ptr<Fronctocol>> test;
+
+  Uint32Info info;
+  size_t const num_desired = 21;
+  std::vector<std::string> const dealers = {
+      "dealer0", "dealer1", "dealer2"};
+
+  std::map<std::string, std::unique_ptr<Dispenser>> results;
+  std::map<std::string, std::unique_ptr<Promise<Dispenser>>> promises;
+  std::map<std::string, size_t> dealt;
+
+  for (std::string const & dealer : dealers) {
+    test[dealer] = std::unique_ptr<Fronctocol>(new Tester(
+        [&](Fronctocol * self) {
+          std::unique_ptr<Fronctocol> house(new House(dealers));
+          self->invoke(std::move(house), self->getPeers());
+        },
+        [&](Fronctocol & f, Fronctocol * self) {
+          dealt[dealer] = static_cast<House &>(f).numDealt;
+          self->complete();
+        }));
+  }
+
+  for (char const * party : {"alice", "bob"}) {
+    std::unique_ptr<Promise<Dispenser>> & promise = promises[party];
+    std::unique_ptr<Dispenser> & result = results[party];
+
+    test[party] = std::unique_ptr<Fronctocol>(new Tester(
+        [&](Fronctocol * self) {
+          promise = self->promise(
+              std::unique_ptr<PromiseFronctocol<Dispenser>>(
+                  new ShardedRandomnessPatron<
+                      TEST_TYPES,
+                      Uint32Rand,
+                      Uint32Info>(dealers, num_desired, info)),
+              self->getPeers());
+          self->await(*promise);
+        },
+        failTestOnComplete,
+        failTestOnReceive,
+        [&](Fronctocol & f, Fronctocol * self) {
+          result = promise->getResult(f);
+          EXPECT_NE(nullptr, result);
+          self->complete();
+        }));
+  }
+
+  ff::tester::RunStats<std::string> stats;
+  EXPECT_TRUE(runTests(test, 1, &stats));
+
+  // Each dealer deals its own, non-empty range, and together the
+  // ranges cover the instances exactly once.
+  size_t total_dealt = 0;
+  for (std::string const & dealer : dealers) {
+    EXPECT_LT(0, dealt[dealer]);
+    EXPECT_LT(0, stats.bytesBySender[dealer]);
+    total_dealt += dealt[dealer];
+  }
+  EXPECT_EQ(num_desired, total_dealt);
+
+  std::unique_ptr<Dispenser> & r1 = results["alice"];
+  std::unique_ptr<Dispenser> & r2 = results["bob"];
+  ASSERT_NE(nullptr, r1);
+  ASSERT_NE(nullptr, r2);
+  EXPECT_EQ(num_desired, r1->size());
+  EXPECT_EQ(num_desired, r2->size());
+
+  for (size_t i = 0; i < num_desired; i++) {
+    Uint32Rand const l = r1->get();
+    EXPECT_EQ(l.rand, r2->get().rand);
+    EXPECT_LT(l.rand, info.prime);
+  }
+}
+
+struct StreamConsumer : Fronctocol {
+  RandomnessStream<TEST_TYPES, Uint32Rand, Uint32Info> stream;
+  size_t numDesired;
+  size_t numChunks;
+
+  std::vector<uint32_t> * consumed;
+
+  std::string name() override {
+    return std::string("StreamConsumer");
+  }
+
+  StreamConsumer(
+      Uint32Info const & info,
+      size_t nd,
+      size_t nc,
+      std::vector<uint32_t> * c) :
+      stream(info),
+      numDesired(nd),
+      numChunks(nc),
+      consumed(c) {
+  }
+
+  void init() override {
+    this->stream.request(
+        *this,
+        "dealer",
+        this->numDesired,
+        this->numChunks,
+        this->getPeers());
+  }
+
+  void handleReceive(IncomingMessage &) override {
+    log_error("unexpected handle receive in StreamConsumer");
+  }
+
+  void handleComplete(Fronctocol &) override {
+    log_error("unexpected handle complete in StreamConsumer");
+  }
+
+  void handlePromise(Fronctocol & f) override {
+    if (!this->stream.collect(f)) {
+      log_error("unexpected promise in StreamConsumer");
+      this->abort();
+      return;
+    }
+
+    // Consume whatever has arrived, without waiting for the rest.
+    while (this->stream.available() > 0) {
+      this->consumed->push_back(this->stream.dispenser().get().rand);
+    }
+
+    if (this->stream.done()) {
+      this->complete();
+    }
+  }
+};
+
+TEST(Randomness, stream) {
+  std::map<std::string, std::unique_ptr<Fronctocol>> test;
+
+  Uint32Info info;
+  size_t const num_desired = 40;
+  size_t const num_chunks = 4;
+
+  std::map<std::string, std::vector<uint32_t>> consumed;
+
+  test["dealer"] = std::unique_ptr<Fronctocol>(new Tester(
+      [&](Fronctocol * self) {
+        std::unique_ptr<Fronctocol> house(new RandomnessStreamHouse<
+                                          TEST_TYPES,
+                                          Uint32Rand,
+                                          Uint32Info>(num_chunks));
+        self->invoke(std::move(house), self->getPeers());
+      },
+      finishTestOnComplete));
+
+  for (char const * party : {"alice", "bob"}) {
+    std::vector<uint32_t> * values = &consumed[party];
+
+    test[party] = std::unique_ptr<Fronctocol>(new Tester(
+        [=](Fronctocol * self) {
+          std::unique_ptr<Fronctocol> consumer(new StreamConsumer(
+              info, num_desired, num_chunks, values));
+          self->invoke(std::move(consumer), self->getPeers());
+        },
+        finishTestOnComplete));
+  }
+
+  EXPECT_TRUE(runTests(test));
+
+  EXPECT_EQ(num_desired, consumed["alice"].size());
+  EXPECT_EQ(consumed["alice"], consumed["bob"]);
+}
+
 template<typename Result_T>
 struct RoundTripsThenAwait : Fronctocol {
   std::unique_ptr<Promise<Result_T>> promise;
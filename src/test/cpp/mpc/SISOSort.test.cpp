@@ -247,7 +247,8 @@ void testSISOParams(
     size_t const n_keys,
     size_t const n_arith,
     size_t const n_xor,
-    Large_T const prime) {
+    Large_T const prime,
+    size_t const n_dealers = 1) {
   LOG_ORGANIZATION = std::string("test");
 
   ObservationList<Large_T> og;
@@ -342,18 +343,24 @@ void testSISOParams(
   std::string dealer_id("dealer");
   std::string revealer_id(PARTY_NAMES[0]);
 
-  // Add the dealer
-  test[dealer_id] = std::unique_ptr<
-      SISOSortRandomnessHouse<TEST_TYPES, Large_T, Small_T>>(
-      new SISOSortRandomnessHouse<TEST_TYPES, Large_T, Small_T>(
-          n_records, prime, &revealer_id, &dealer_id));
+  // Add the dealers, which share the work if there are several
+  std::vector<std::string> dealers(1, dealer_id);
+  for (size_t i = 1; i < n_dealers; i++) {
+    dealers.push_back(dealer_id + std::to_string(i));
+  }
+  for (std::string const & dealer : dealers) {
+    test[dealer] = std::unique_ptr<
+        SISOSortRandomnessHouse<TEST_TYPES, Large_T, Small_T>>(
+        new SISOSortRandomnessHouse<TEST_TYPES, Large_T, Small_T>(
+            n_records, prime, &revealer_id, &dealer_id, dealers));
+  }
 
   // Add the dataowners
   ASSERT_TRUE(n_parties <= PARTY_NAMES.size());
   for (size_t i = 0; i < n_parties; i++) {
     test[PARTY_NAMES[i]] = std::unique_ptr<Fronctocol>(
         new SISOSort<TEST_TYPES, Large_T, Small_T>(
-            input_shares[i], prime, &revealer_id, &dealer_id));
+            input_shares[i], prime, &revealer_id, &dealer_id, dealers));
   }
 
   log_info(
@@ -473,6 +480,15 @@ TEST(SISO_Sort, SISOSort_with_random_parameters_uint64_uint64) {
   }
 }
 
+TEST(SISO_Sort, SISOSort_sharded_dealers) {
+  const uint64_t prime = (1ULL << 61) - 1; // mersenne prime
+  for (size_t n_dealers = 2; n_dealers < 4; n_dealers++) {
+    testSISOParams<uint64_t, uint64_t>(
+        3, 11, 2, 2, 2, prime, n_dealers);
+    log_info("==========");
+  }
+}
+
 TEST(SISO_Sort, SISOSort_with_random_parameters_largenum_uint32) {
   const LargeNum prime = (LargeNum(1) << 89) - 1; // mersenne prime
   for (size_t i = 0; i < 5; i++) {
@@ -5,10 +5,12 @@
 /* C and POSIX Headers */
 
 /* C++ Headers */
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 /* 3rd Party Headers */
 #include <gtest/gtest.h>
@@ -17,6 +19,8 @@
 #include <mock.h>
 
 #include <ff/Fronctocol.h>
+#include <mpc/BatchedTypeCast.h>
+#include <mpc/ModConvUp.h>
 #include <mpc/Multiply.h>
 #include <mpc/TypeCastBit.h>
 #include <mpc/templates.h>
@@ -184,3 +188,124 @@ TEST(TypeCastBit, small_type_cast_bit_2parties) {
 
   EXPECT_EQ(1, (output_income ^ output_univ1));
 };
+
+/**
+ * Runs a BatchedTypeCastFromBit for each party, built by make, and
+ * collects each party's outputBitShares.
+ */
+template<typename Number_T, typename Make_T>
+static void runBatchedTypeCast(
+    std::vector<std::string> const & parties,
+    Make_T make,
+    std::vector<std::vector<std::vector<Number_T>>> & outputs) {
+  using Cast = BatchedTypeCastFromBit<TEST_TYPES, Number_T>;
+  outputs.resize(parties.size());
+  std::map<std::string, std::unique_ptr<Fronctocol>> test;
+  for (size_t i = 0; i < parties.size(); i++) {
+    test[parties[i]] = std::unique_ptr<Fronctocol>(new Tester(
+        [&make, i](Fronctocol * self) {
+          self->invoke(make(i), self->getPeers());
+        },
+        [&outputs, i](Fronctocol & f, Fronctocol * self) {
+          outputs[i] = static_cast<Cast &>(f).outputBitShares;
+          self->complete();
+        },
+        failTestOnReceive,
+        failTestOnPromise));
+  }
+  EXPECT_TRUE(runTests(test));
+}
+
+TEST(TypeCastBit, batched_type_cast_from_bit) {
+  std::vector<std::string> const parties = {"income", "univ1", "univ2"};
+  std::string const & revealer = parties[0];
+  size_t const n_bits = 19;
+  SmallNum const p = 97;
+
+  std::vector<Boolean_t> bits;
+  std::vector<std::vector<Boolean_t>> bit_shares(parties.size());
+  std::vector<std::vector<TypeCastTriple<SmallNum>>> triples(
+      parties.size());
+  TypeCastFromBitInfo<SmallNum> const info(p);
+  for (size_t j = 0; j < n_bits; j++) {
+    bits.push_back(randomModP<Boolean_t>(2));
+    std::vector<Boolean_t> shares;
+    xorSecretShare<Boolean_t>(parties.size(), bits[j], shares);
+    std::vector<TypeCastTriple<SmallNum>> instance;
+    info.generate(parties.size(), 1, instance);
+    for (size_t i = 0; i < parties.size(); i++) {
+      bit_shares[i].push_back(shares[i]);
+      triples[i].push_back(instance[i]);
+    }
+  }
+
+  std::vector<std::vector<std::vector<SmallNum>>> outputs;
+  runBatchedTypeCast<SmallNum>(
+      parties,
+      [&](size_t i) {
+        return std::unique_ptr<Fronctocol>(
+            new BatchedTypeCastFromBit<TEST_TYPES, SmallNum>(
+                bit_shares[i], p, &revealer, triples[i]));
+      },
+      outputs);
+
+  for (size_t j = 0; j < n_bits; j++) {
+    SmallNum sum = 0;
+    for (size_t i = 0; i < parties.size(); i++) {
+      ASSERT_EQ(1, outputs[i].size());
+      ASSERT_EQ(n_bits, outputs[i][0].size());
+      sum = modAdd(sum, outputs[i][0][j], p);
+    }
+    EXPECT_EQ(bits[j], sum);
+  }
+}
+
+TEST(TypeCastBit, batched_type_cast_from_bit_multi_moduli) {
+  std::vector<std::string> const parties = {"income", "univ1", "univ2"};
+  std::string const & revealer = parties[0];
+  size_t const n_bits = 21;
+  // A small s and a large p, cast from one opening.
+  std::vector<uint64_t> const moduli = {97, (1UL << 61) - 1};
+
+  std::vector<Boolean_t> bits;
+  std::vector<std::vector<Boolean_t>> bit_shares(parties.size());
+  std::vector<std::vector<MultiTypeCastTriple<uint64_t>>> triples(
+      parties.size());
+  MultiTypeCastFromBitInfo<uint64_t> const info(moduli);
+  for (size_t j = 0; j < n_bits; j++) {
+    bits.push_back(randomModP<Boolean_t>(2));
+    std::vector<Boolean_t> shares;
+    xorSecretShare<Boolean_t>(parties.size(), bits[j], shares);
+    std::vector<MultiTypeCastTriple<uint64_t>> instance;
+    info.generate(parties.size(), 1, instance);
+    for (size_t i = 0; i < parties.size(); i++) {
+      bit_shares[i].push_back(shares[i]);
+      triples[i].push_back(instance[i]);
+    }
+  }
+
+  std::vector<std::vector<std::vector<uint64_t>>> outputs;
+  runBatchedTypeCast<uint64_t>(
+      parties,
+      [&](size_t i) {
+        return std::unique_ptr<Fronctocol>(
+            new BatchedTypeCastFromBit<TEST_TYPES, uint64_t>(
+                bit_shares[i],
+                moduli,
+                &revealer,
+                triples[i],
+                Opening(OpeningStrategy::tree, 2)));
+      },
+      outputs);
+
+  for (size_t m = 0; m < moduli.size(); m++) {
+    for (size_t j = 0; j < n_bits; j++) {
+      uint64_t sum = 0;
+      for (size_t i = 0; i < parties.size(); i++) {
+        ASSERT_EQ(moduli.size(), outputs[i].size());
+        sum = modAdd(sum, outputs[i][m][j], moduli[m]);
+      }
+      EXPECT_EQ(bits[j], sum);
+    }
+  }
+}
@@ -213,6 +213,90 @@ TEST(Compare, unbounded_fanin_or_largenum) {
       correct_result, (share_univ1 + share_univ2 + share_income) % p);
 };
 
+TEST(Compare, batched_unbounded_fanin_or_smallnum) {
+  std::map<std::string, std::unique_ptr<Fronctocol>> test;
+
+  const SmallNum p = 65521;
+  const size_t n_parties = 3;
+  std::string revealer("income");
+  std::vector<std::string> const parties = {"income", "univ1", "univ2"};
+
+  UnboundedFaninOrInfo<std::string, SmallNum> info(p, &revealer);
+  BeaverInfo<SmallNum> beaver_info(info.s);
+
+  // Groups of differing sizes, including all-zero and all-one groups.
+  std::vector<std::vector<SmallNum>> og_groups = {
+      {0, 0, 0},
+      {1, 1},
+      {0, 0, 0, 0, 1},
+      {0},
+      {randomModP(2U), randomModP(2U), randomModP(2U), randomModP(2U)}};
+
+  std::vector<std::vector<SmallNum>> polynomials;
+  for (std::vector<SmallNum> const & group : og_groups) {
+    polynomials.emplace_back(computeLagrangeCoeffsForPrefixOr(
+        p, static_cast<SmallNum>(group.size())));
+  }
+
+  std::map<std::string, std::vector<SmallNum>> outputs;
+  std::map<
+      std::string,
+      std::unique_ptr<BatchedUnboundedFaninOr<TEST_TYPES, SmallNum>>>
+      fanins;
+  for (std::string const & party : parties) {
+    fanins[party] = std::unique_ptr<
+        BatchedUnboundedFaninOr<TEST_TYPES, SmallNum>>(
+        new BatchedUnboundedFaninOr<TEST_TYPES, SmallNum>(
+            &outputs[party], &info));
+  }
+
+  for (size_t k = 0; k < og_groups.size(); k++) {
+    std::vector<SmallNum> sums(n_parties, 0);
+    for (SmallNum const & val : og_groups[k]) {
+      std::vector<SmallNum> shares;
+      arithmeticSecretShare(n_parties, p, val, shares);
+      for (size_t j = 0; j < n_parties; j++) {
+        sums[j] = (sums[j] + shares[j]) % p;
+      }
+    }
+
+    ExponentSeriesInfo<SmallNum> exp_info(p, og_groups[k].size());
+    std::vector<ExponentSeries<SmallNum>> es;
+    exp_info.generate(n_parties, 0, es);
+
+    std::vector<BeaverTriple<SmallNum>> beavers;
+    beaver_info.generate(n_parties, 0, beavers);
+
+    for (size_t j = 0; j < n_parties; j++) {
+      fanins[parties[j]]->addGroup(
+          sums[j],
+          std::move(es[j]),
+          std::move(beavers[j]),
+          polynomials[k]);
+    }
+  }
+
+  for (std::string const & party : parties) {
+    test[party] = std::move(fanins[party]);
+  }
+
+  EXPECT_TRUE(runTests(test));
+
+  for (size_t k = 0; k < og_groups.size(); k++) {
+    SmallNum correct_result = 0;
+    for (SmallNum const & val : og_groups[k]) {
+      correct_result = correct_result | val;
+    }
+
+    SmallNum result = 0;
+    for (std::string const & party : parties) {
+      ASSERT_EQ(og_groups.size(), outputs[party].size());
+      result = (result + outputs[party][k]) % p;
+    }
+    EXPECT_EQ(correct_result, result);
+  }
+};
+
 template<typename Number_T>
 Number_T sum(std::vector<Number_T> & vec) {
   Number_T val = 0;
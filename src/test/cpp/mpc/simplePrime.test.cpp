@@ -0,0 +1,74 @@
+/**
+ * Copyright Stealth Software Technologies, Inc.
+ */
+
+/* C and POSIX Headers */
+
+/* C++ Headers */
+#include <cstdint>
+#include <vector>
+
+/* 3rd Party Headers */
+#include <gtest/gtest.h>
+
+/* Fortissimo Headers */
+#include <mpc/simplePrime.h>
+#include <mpc/templates.h>
+
+/* Logging Configuration */
+#include <ff/logging.h>
+
+using namespace ff::mpc;
+
+/* A reference using plain trial division. */
+static bool trialDivisionIsPrime(uint64_t value) {
+  if (value < 2) {
+    return false;
+  }
+  for (uint64_t i = 2; i * i <= value; i++) {
+    if (value % i == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+TEST(SimplePrime, is_prime_small_values) {
+  for (uint32_t i = 0; i < 20000; i++) {
+    EXPECT_EQ(trialDivisionIsPrime(i), isPrime<uint32_t>(i)) << i;
+    EXPECT_EQ(trialDivisionIsPrime(i), isPrime<uint64_t>(i)) << i;
+  }
+}
+
+TEST(SimplePrime, is_prime_large_values) {
+  EXPECT_TRUE(isPrime<uint32_t>(4294967291U)); // largest 32 bit prime
+  EXPECT_FALSE(isPrime<uint32_t>(4294967295U));
+  // A strong pseudoprime to the bases 2, 3, 5 and 7.
+  EXPECT_FALSE(isPrime<uint32_t>(3215031751U));
+
+  EXPECT_TRUE(isPrime<uint64_t>(18446744073709551557ULL));
+  EXPECT_TRUE(isPrime<uint64_t>((1ULL << 61) - 1));
+  EXPECT_FALSE(isPrime<uint64_t>(3825123056546413051ULL));
+  EXPECT_FALSE(isPrime<uint64_t>(4294967291ULL * 4294967279ULL));
+
+  EXPECT_TRUE(isPrime<LargeNum>((LargeNum(1) << 89) - LargeNum(1)));
+  EXPECT_FALSE(isPrime<LargeNum>((LargeNum(1) << 89) + LargeNum(1)));
+}
+
+TEST(SimplePrime, next_prime) {
+  for (uint32_t i = 0; i < 20000; i += 7) {
+    uint32_t expected = i < 3 ? 3 : i;
+    while (!trialDivisionIsPrime(expected)) {
+      expected++;
+    }
+    EXPECT_EQ(expected, nextPrime<uint32_t>(i)) << i;
+    EXPECT_EQ((uint64_t)expected, nextPrime<uint64_t>(i)) << i;
+    EXPECT_EQ(LargeNum(expected), nextPrime<LargeNum>(LargeNum(i)))
+        << i;
+  }
+
+  EXPECT_EQ((1ULL << 61) - 1, nextPrime<uint64_t>((1ULL << 61) - 30));
+  EXPECT_EQ(
+      (LargeNum(1) << 89) - LargeNum(99),
+      nextPrime<LargeNum>((LargeNum(1) << 89) - LargeNum(100)));
+}